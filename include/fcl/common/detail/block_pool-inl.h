@@ -0,0 +1,74 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FCL_COMMON_DETAIL_BLOCKPOOL_INL_H
+#define FCL_COMMON_DETAIL_BLOCKPOOL_INL_H
+
+#include "fcl/common/detail/block_pool.h"
+
+#include <new>
+#include <utility>
+
+namespace fcl {
+namespace detail {
+
+//==============================================================================
+template <typename T, typename... Args>
+T* newPooled(Args&&... args)
+{
+  static_assert(sizeof(T) <= maxPooledBlockSize(),
+                "The type is too large for the block pools");
+  static_assert(alignof(T) <= alignof(std::max_align_t),
+                "The type is over-aligned for the block pools");
+
+  void* block = threadLocalBlockPool(sizeof(T)).allocate();
+  return new (block) T(std::forward<Args>(args)...);
+}
+
+//==============================================================================
+template <typename T>
+void deletePooled(T* object)
+{
+  if (!object)
+    return;
+
+  object->~T();
+  threadLocalBlockPool(sizeof(T)).release(object);
+}
+
+} // namespace detail
+} // namespace fcl
+
+#endif
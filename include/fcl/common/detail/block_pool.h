@@ -0,0 +1,123 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FCL_COMMON_DETAIL_BLOCKPOOL_H
+#define FCL_COMMON_DETAIL_BLOCKPOOL_H
+
+#include <cstddef>
+#include <vector>
+
+#include "fcl/export.h"
+
+namespace fcl {
+namespace detail {
+
+/// @brief A free list of fixed-size memory blocks. The blocks are carved out
+/// of chunks that the pool keeps until it is destroyed, so once the pool has
+/// grown to the working set of its user, allocate() and release() do not
+/// touch the heap. The pool is not thread safe; threadLocalBlockPool() gives
+/// each thread its own pools.
+class FCL_EXPORT BlockPool
+{
+public:
+
+  /// @brief Pool of blocks of block_size bytes, rounded up to a multiple of
+  /// the fundamental alignment
+  explicit BlockPool(std::size_t block_size);
+
+  BlockPool(const BlockPool&) = delete;
+
+  BlockPool& operator=(const BlockPool&) = delete;
+
+  ~BlockPool();
+
+  /// @brief Returns an uninitialized block, aligned for any fundamental type
+  void* allocate();
+
+  /// @brief Gives back a block returned by allocate() of this pool
+  void release(void* block);
+
+  /// @brief Size of the blocks in bytes
+  std::size_t blockSize() const;
+
+  /// @brief Number of blocks the pool has obtained from the heap
+  std::size_t capacity() const;
+
+private:
+
+  struct Block
+  {
+    Block* next;
+  };
+
+  /// @brief Allocates a new chunk holding as many blocks as the pool already
+  /// has, and threads its blocks onto the free list
+  void grow();
+
+  std::size_t block_size_;
+
+  Block* free_list_;
+
+  std::vector<void*> chunks_;
+
+  std::size_t capacity_;
+};
+
+/// @brief The largest block size served by threadLocalBlockPool()
+constexpr std::size_t maxPooledBlockSize() { return 512; }
+
+/// @brief The pool of the calling thread for blocks of at least size bytes,
+/// where 0 < size <= maxPooledBlockSize(). The pools live in the fcl library,
+/// so blocks allocated in inline code of a client and released in the
+/// library, or the other way around, come from the same pool. A block must be
+/// released on the thread that allocated it.
+FCL_EXPORT
+BlockPool& threadLocalBlockPool(std::size_t size);
+
+/// @brief Constructs an object of type T in a block of the thread local pool
+template <typename T, typename... Args>
+T* newPooled(Args&&... args);
+
+/// @brief Destroys an object created by newPooled() and gives its block back
+/// to the pool; does nothing for nullptr
+template <typename T>
+void deletePooled(T* object);
+
+} // namespace detail
+} // namespace fcl
+
+#include "fcl/common/detail/block_pool-inl.h"
+
+#endif
@@ -0,0 +1,78 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FCL_COMMON_DETAIL_WORKSTEALINGPOOL_H
+#define FCL_COMMON_DETAIL_WORKSTEALINGPOOL_H
+
+#include <cstddef>
+#include <functional>
+
+#include "fcl/export.h"
+
+namespace fcl {
+namespace detail {
+
+/// @brief Runs a set of independent tasks on a fixed number of threads. Each
+/// thread owns a queue of tasks, which it processes from the front; a thread
+/// whose queue is empty steals tasks from the back of the other queues, so
+/// that the threads stay busy when the tasks have uneven costs.
+class FCL_EXPORT WorkStealingPool
+{
+public:
+
+  /// @brief Pool of num_threads threads; 0 means one thread per hardware
+  /// thread
+  explicit WorkStealingPool(unsigned int num_threads);
+
+  /// @brief Number of threads used by run()
+  unsigned int numThreads() const;
+
+  /// @brief Calls task(i) for each i in [0, num_tasks) and returns when all
+  /// of them are done. The task i is first queued on the thread
+  /// i % numThreads(), so the tasks that are ordered by priority are started
+  /// roughly in that order. The calling thread is one of the threads of the
+  /// pool. task must be safe to call concurrently.
+  void run(std::size_t num_tasks,
+           const std::function<void(std::size_t)>& task) const;
+
+private:
+
+  unsigned int num_threads_;
+};
+
+} // namespace detail
+} // namespace fcl
+
+#endif
@@ -66,11 +66,16 @@ BVHModel<BV>::BVHModel() : vertices(nullptr),
   build_state(BVH_BUILD_STATE_EMPTY),
   bv_splitter(new detail::BVSplitter<BV>(detail::SPLIT_METHOD_MEAN)),
   bv_fitter(new detail::BVFitter<BV>()),
+  lazy_refit(false),
   num_tris_allocated(0),
   num_vertices_allocated(0),
   num_bvs_allocated(0),
   num_vertex_updated(0),
   primitive_indices(nullptr),
+  refit_pending(false),
+  refit_pending_bottomup(true),
+  external_data(nullptr),
+  external_size(0),
   bvs(nullptr),
   num_bvs(0)
 {
@@ -86,8 +91,16 @@ BVHModel<BV>::BVHModel(const BVHModel<BV>& other)
     build_state(other.build_state),
     bv_splitter(other.bv_splitter),
     bv_fitter(other.bv_fitter),
+    lazy_refit(false),
     num_tris_allocated(other.num_tris),
-    num_vertices_allocated(other.num_vertices)
+    num_vertices_allocated(other.num_vertices),
+    tri_indices_storage(other.tri_indices_storage),
+    primitive_indices_storage(other.primitive_indices_storage),
+    refit_pending(other.refit_pending.load()),
+    refit_pending_bottomup(other.refit_pending_bottomup),
+    external_data(nullptr),
+    external_size(0),
+    lod_proxies(other.lod_proxies)
 {
   if(other.vertices)
   {
@@ -97,7 +110,9 @@ BVHModel<BV>::BVHModel(const BVHModel<BV>& other)
   else
     vertices = nullptr;
 
-  if(other.tri_indices)
+  if(tri_indices_storage)
+    tri_indices = other.tri_indices;
+  else if(other.tri_indices)
   {
     tri_indices = new Triangle[num_tris];
     memcpy(tri_indices, other.tri_indices, sizeof(Triangle) * num_tris);
@@ -113,7 +128,9 @@ BVHModel<BV>::BVHModel(const BVHModel<BV>& other)
   else
     prev_vertices = nullptr;
 
-  if(other.primitive_indices)
+  if(primitive_indices_storage)
+    primitive_indices = other.primitive_indices;
+  else if(other.primitive_indices)
   {
     int num_primitives = 0;
     switch(other.getModelType())
@@ -148,12 +165,12 @@ BVHModel<BV>::BVHModel(const BVHModel<BV>& other)
 template <typename BV>
 BVHModel<BV>::~BVHModel()
 {
-  delete [] vertices;
-  delete [] tri_indices;
-  delete [] bvs;
+  releaseArray(vertices);
+  releaseArray(bvs);
 
-  delete [] prev_vertices;
-  delete [] primitive_indices;
+  releaseArray(prev_vertices);
+
+  clearTopology();
 }
 
 //==============================================================================
@@ -207,11 +224,13 @@ int BVHModel<BV>::beginModel(int num_tris_, int num_vertices_)
 {
   if(build_state != BVH_BUILD_STATE_EMPTY)
   {
-    delete [] vertices; vertices = nullptr;
-    delete [] tri_indices; tri_indices = nullptr;
-    delete [] bvs; bvs = nullptr;
-    delete [] prev_vertices; prev_vertices = nullptr;
-    delete [] primitive_indices; primitive_indices = nullptr;
+    releaseArray(vertices);
+    releaseArray(bvs);
+    releaseArray(prev_vertices);
+    clearTopology();
+    releaseExternalStorage();
+    lod_proxies.reset();
+    refit_pending = false;
 
     num_vertices_allocated = num_vertices = num_tris_allocated = num_tris = num_bvs_allocated = num_bvs = 0;
   }
@@ -508,6 +527,7 @@ int BVHModel<BV>::endModel()
   num_bvs = 0;
 
   buildTree();
+  shareTopology();
 
   // finish constructing
   build_state = BVH_BUILD_STATE_PROCESSED;
@@ -525,11 +545,7 @@ int BVHModel<BV>::beginReplaceModel()
     return BVH_ERR_BUILD_EMPTY_PREVIOUS_FRAME;
   }
 
-  if(prev_vertices)
-  {
-    delete [] prev_vertices;
-    prev_vertices = nullptr;
-  }
+  releaseArray(prev_vertices);
 
   num_vertex_updated = 0;
 
@@ -606,11 +622,12 @@ int BVHModel<BV>::endReplaceModel(bool refit, bool bottomup)
 
   if(refit)  // refit, do not change BVH structure
   {
-    refitTree(bottomup);
+    refitTreeOrDefer(bottomup);
   }
   else // reconstruct bvh tree based on current frame data
   {
     buildTree();
+    refit_pending = false;
   }
 
   build_state = BVH_BUILD_STATE_PROCESSED;
@@ -715,7 +732,7 @@ int BVHModel<BV>::endUpdateModel(bool refit, bool bottomup)
 
   if(refit)  // refit, do not change BVH structure
   {
-    refitTree(bottomup);
+    refitTreeOrDefer(bottomup);
   }
   else // reconstruct bvh tree based on current frame data
   {
@@ -724,6 +741,7 @@ int BVHModel<BV>::endUpdateModel(bool refit, bool bottomup)
     // then refit
 
     refitTree(bottomup);
+    refit_pending = false;
   }
 
 
@@ -732,6 +750,125 @@ int BVHModel<BV>::endUpdateModel(bool refit, bool bottomup)
   return BVH_OK;
 }
 
+//==============================================================================
+template <typename BV>
+bool BVHModel<BV>::isRefitPending() const
+{
+  return refit_pending.load();
+}
+
+//==============================================================================
+template <typename BV>
+void BVHModel<BV>::refitIfPending() const
+{
+  if(!refit_pending.load(std::memory_order_acquire))
+    return;
+
+  std::lock_guard<std::mutex> lock(refit_mutex);
+  if(!refit_pending.load(std::memory_order_relaxed))
+    return;
+
+  // Refitting only updates the bounds stored in the BV nodes, which is what
+  // the deferred endReplaceModel()/endUpdateModel() call would have done.
+  const_cast<BVHModel<BV>*>(this)->refitTree(refit_pending_bottomup);
+  refit_pending.store(false, std::memory_order_release);
+}
+
+//==============================================================================
+template <typename BV>
+bool BVHModel<BV>::isTopologyShared() const
+{
+  return (tri_indices_storage && tri_indices_storage.use_count() > 1)
+      || (primitive_indices_storage && primitive_indices_storage.use_count() > 1);
+}
+
+//==============================================================================
+template <typename BV>
+int BVHModel<BV>::computeLODProxies()
+{
+  if(build_state != BVH_BUILD_STATE_PROCESSED && build_state != BVH_BUILD_STATE_UPDATED)
+  {
+    std::cerr << "BVH Error! Call computeLODProxies() on a BVHModel that is not finalized." << std::endl;
+    return BVH_ERR_BUILD_OUT_OF_SEQUENCE;
+  }
+
+  refitIfPending();
+
+  const BVHModelType type = getModelType();
+  auto proxies = std::make_shared<std::vector<BVNodeProxy<S>>>(num_bvs);
+
+  // Vertices of the primitives in a node, with the primitive they belong to
+  std::vector<std::pair<int, int>> node_vertices;
+
+  for(int i = 0; i < num_bvs; ++i)
+  {
+    const BVNodeBase& node = bvs[i];
+    BVNodeProxy<S>& proxy = (*proxies)[i];
+
+    node_vertices.clear();
+    for(int j = 0; j < node.num_primitives; ++j)
+    {
+      const int primitive = primitive_indices[node.first_primitive + j];
+      if(type == BVH_MODEL_TRIANGLES)
+      {
+        for(int k = 0; k < 3; ++k)
+          node_vertices.emplace_back(tri_indices[primitive][k], primitive);
+      }
+      else
+      {
+        node_vertices.emplace_back(primitive, primitive);
+      }
+    }
+
+    // The proxy is the vertex closest to the centroid of the node, which keeps
+    // the radius close to the smallest possible one
+    Vector3<S> centroid = Vector3<S>::Zero();
+    for(const auto& v : node_vertices)
+      centroid += vertices[v.first];
+    centroid /= static_cast<S>(node_vertices.size());
+
+    S min_sqr_dist = std::numeric_limits<S>::max();
+    for(const auto& v : node_vertices)
+    {
+      const S sqr_dist = (vertices[v.first] - centroid).squaredNorm();
+      if(sqr_dist < min_sqr_dist)
+      {
+        min_sqr_dist = sqr_dist;
+        proxy.vertex = v.first;
+        proxy.primitive = v.second;
+      }
+    }
+
+    // The geometry in the node is in the convex hull of its vertices, so the
+    // farthest vertex bounds the distance to all of it
+    S max_sqr_dist = 0;
+    for(const auto& v : node_vertices)
+    {
+      max_sqr_dist = std::max(
+            max_sqr_dist, (vertices[v.first] - vertices[proxy.vertex]).squaredNorm());
+    }
+    proxy.radius = std::sqrt(max_sqr_dist);
+  }
+
+  lod_proxies = proxies;
+
+  return BVH_OK;
+}
+
+//==============================================================================
+template <typename BV>
+bool BVHModel<BV>::hasLODProxies() const
+{
+  return lod_proxies != nullptr;
+}
+
+//==============================================================================
+template <typename BV>
+const BVNodeProxy<typename BV::S>& BVHModel<BV>::getLODProxy(int id) const
+{
+  return (*lod_proxies)[id];
+}
+
 //==============================================================================
 template <typename BV>
 int BVHModel<BV>::memUsage(int msg) const
@@ -747,6 +884,8 @@ int BVHModel<BV>::memUsage(int msg) const
     std::cerr << "BVs: " << num_bvs << " allocated." << std::endl;
     std::cerr << "Tris: " << num_tris << " allocated." << std::endl;
     std::cerr << "Vertices: " << num_vertices << " allocated." << std::endl;
+    if(isTopologyShared())
+      std::cerr << "Tris and primitive indices are shared with other models." << std::endl;
   }
 
   return BVH_OK;
@@ -831,6 +970,9 @@ Matrix3<typename BV::S> BVHModel<BV>::computeMomentofInertia() const
 template <typename BV>
 int BVHModel<BV>::buildTree()
 {
+  detachPrimitiveIndices();
+  lod_proxies.reset();
+
   // set BVFitter
   bv_fitter->set(vertices, tri_indices, getModelType());
   // set SplitRule
@@ -946,6 +1088,99 @@ int BVHModel<BV>::refitTree(bool bottomup)
     return refitTree_topdown();
 }
 
+//==============================================================================
+template <typename BV>
+int BVHModel<BV>::refitTreeOrDefer(bool bottomup)
+{
+  if(lazy_refit)
+  {
+    std::lock_guard<std::mutex> lock(refit_mutex);
+    refit_pending_bottomup = bottomup;
+    refit_pending = true;
+    return BVH_OK;
+  }
+
+  refit_pending = false;
+  return refitTree(bottomup);
+}
+
+//==============================================================================
+template <typename BV>
+void BVHModel<BV>::clearTopology()
+{
+  if(tri_indices_storage)
+    tri_indices_storage.reset();
+  else
+    delete [] tri_indices;
+  tri_indices = nullptr;
+
+  if(primitive_indices_storage)
+    primitive_indices_storage.reset();
+  else
+    delete [] primitive_indices;
+  primitive_indices = nullptr;
+}
+
+//==============================================================================
+template <typename BV>
+void BVHModel<BV>::shareTopology()
+{
+  if(tri_indices && !tri_indices_storage)
+    tri_indices_storage.reset(tri_indices, std::default_delete<Triangle[]>());
+
+  if(primitive_indices && !primitive_indices_storage)
+  {
+    primitive_indices_storage.reset(
+          primitive_indices, std::default_delete<unsigned int[]>());
+  }
+}
+
+//==============================================================================
+template <typename BV>
+void BVHModel<BV>::detachPrimitiveIndices()
+{
+  if(!primitive_indices_storage || primitive_indices_storage.use_count() == 1)
+    return;
+
+  int num_primitives = 0;
+  switch(getModelType())
+  {
+    case BVH_MODEL_TRIANGLES:
+      num_primitives = num_tris;
+      break;
+    case BVH_MODEL_POINTCLOUD:
+      num_primitives = num_vertices;
+      break;
+    default:
+      ;
+  }
+
+  unsigned int* temp = new unsigned int[num_primitives];
+  memcpy(temp, primitive_indices, sizeof(unsigned int) * num_primitives);
+  primitive_indices_storage.reset(temp, std::default_delete<unsigned int[]>());
+  primitive_indices = temp;
+}
+
+//==============================================================================
+template <typename BV>
+template <typename T>
+void BVHModel<BV>::releaseArray(T*& array)
+{
+  const char* p = reinterpret_cast<const char*>(array);
+  if(!external_data || p < external_data || p >= external_data + external_size)
+    delete [] array;
+  array = nullptr;
+}
+
+//==============================================================================
+template <typename BV>
+void BVHModel<BV>::releaseExternalStorage()
+{
+  external_storage.reset();
+  external_data = nullptr;
+  external_size = 0;
+}
+
 //==============================================================================
 template <typename BV>
 int BVHModel<BV>::refitTree_bottomup()
@@ -1257,6 +1492,16 @@ struct GetNodeTypeImpl<KDOP<S, 24>>
   }
 };
 
+//==============================================================================
+template <typename S>
+struct GetNodeTypeImpl<FloatAABB<S>>
+{
+  static NODE_TYPE run()
+  {
+    return BV_FloatAABB;
+  }
+};
+
 } // namespace fcl
 
 #endif
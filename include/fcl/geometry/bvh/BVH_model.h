@@ -38,11 +38,14 @@
 #ifndef FCL_BVH_MODEL_H
 #define FCL_BVH_MODEL_H
 
+#include <atomic>
 #include <vector>
 #include <memory>
+#include <mutex>
 
 #include "fcl/math/bv/OBB.h"
 #include "fcl/math/bv/kDOP.h"
+#include "fcl/math/bv/FloatAABB.h"
 #include "fcl/geometry/collision_geometry.h"
 #include "fcl/geometry/bvh/BVH_internal.h"
 #include "fcl/geometry/bvh/BV_node.h"
@@ -52,6 +55,14 @@
 namespace fcl
 {
 
+namespace detail
+{
+
+template <typename BV>
+struct BVHModelFile;
+
+} // namespace detail
+
 /// @brief A class describing the bounding hierarchy of a mesh model or a point cloud model (which is viewed as a degraded version of mesh)
 template <typename BV>
 class FCL_EXPORT BVHModel : public CollisionGeometry<typename BV::S>
@@ -66,7 +77,11 @@ public:
   /// @brief Constructing an empty BVH
   BVHModel();
 
-  /// @brief copy from another BVH
+  /// @brief copy from another BVH. If the other BVH has been finalized (i.e.,
+  /// endModel() was called), the triangle indices and the primitive ordering
+  /// are shared with it instead of being copied; only the vertices and the BV
+  /// nodes are owned by the new model, so that many instances of the same
+  /// (deformable) mesh can be refitted independently.
   BVHModel(const BVHModel& other);
 
   /// @brief deconstruction, delete mesh data related.
@@ -144,6 +159,35 @@ public:
   /// @brief End BVH model update, will also refit or rebuild the bounding volume hierarchy
   int endUpdateModel(bool refit = true, bool bottomup = true);
 
+  /// @brief Whether a refit deferred by lazy_refit has not been performed yet
+  bool isRefitPending() const;
+
+  /// @brief Perform the refit deferred by lazy_refit, if any. This is called
+  /// by the collision and distance queries before the hierarchy is traversed,
+  /// and is safe to call concurrently on the same model.
+  void refitIfPending() const;
+
+  /// @brief Whether the triangle indices and primitive ordering are shared
+  /// with another BVHModel
+  bool isTopologyShared() const;
+
+  /// @brief Compute the level-of-detail proxy of every BV node (see
+  /// BVNodeProxy), which lets distance queries with a positive
+  /// DistanceRequest::lod_tolerance stop the traversal above the leaves. The
+  /// proxies are shared with the copies of the model. They only depend on the
+  /// vertex indices and on the distances between the vertices, so they stay
+  /// valid when the model is moved rigidly through beginReplaceModel() or
+  /// beginUpdateModel() with refit; they are discarded when the hierarchy is
+  /// rebuilt, and must be computed again after the model is deformed.
+  int computeLODProxies();
+
+  /// @brief Whether the level-of-detail proxies have been computed
+  bool hasLODProxies() const;
+
+  /// @brief Access the level-of-detail proxy of the BV node with the given
+  /// index; only valid if hasLODProxies() is true
+  const BVNodeProxy<S>& getLODProxy(int id) const;
+
   /// @brief Check the number of memory used
   int memUsage(int msg) const;
 
@@ -182,6 +226,12 @@ public:
   /// @brief Fitting rule to fit a BV node to a set of geometry primitives
   std::shared_ptr<detail::BVFitterBase<BV>> bv_fitter;
 
+  /// @brief If true, endReplaceModel() and endUpdateModel() with refit = true
+  /// only mark the hierarchy as stale, and the refit is postponed until the
+  /// model is first used in a query (see refitIfPending()). This is not
+  /// inherited by copies of the model.
+  bool lazy_refit;
+
 private:
 
   int num_tris_allocated;
@@ -190,6 +240,28 @@ private:
   int num_vertex_updated; /// for ccd vertex update
   unsigned int* primitive_indices;
 
+  /// @brief Owners of tri_indices and primitive_indices once the model is
+  /// finalized; these arrays are shared between the copies of the model
+  std::shared_ptr<Triangle> tri_indices_storage;
+  std::shared_ptr<unsigned int> primitive_indices_storage;
+
+  /// @brief Whether a refit has been deferred, and how it should be performed
+  mutable std::atomic<bool> refit_pending;
+  bool refit_pending_bottomup;
+  mutable std::mutex refit_mutex;
+
+  /// @brief Memory the arrays of the model point into when it has been loaded
+  /// from a file (see loadBVHModel()); arrays inside [external_data,
+  /// external_data + external_size) are released with the storage instead of
+  /// being deleted
+  std::shared_ptr<void> external_storage;
+  const char* external_data;
+  std::size_t external_size;
+
+  /// @brief Level-of-detail proxies of the BV nodes, shared with the copies
+  /// of the model
+  std::shared_ptr<const std::vector<BVNodeProxy<S>>> lod_proxies;
+
   /// @brief Bounding volume hierarchy
   BVNode<BV>* bvs;
 
@@ -202,6 +274,29 @@ private:
   /// @brief Refit the bounding volume hierarchy
   int refitTree(bool bottomup);
 
+  /// @brief Refit the bounding volume hierarchy now, or defer it if lazy_refit
+  /// is set
+  int refitTreeOrDefer(bool bottomup);
+
+  /// @brief Release the triangle indices and the primitive ordering
+  void clearTopology();
+
+  /// @brief Hand the triangle indices and the primitive ordering over to the
+  /// shared storage, so that they can be shared by copies of the model
+  void shareTopology();
+
+  /// @brief Make sure that primitive_indices is not shared before it is
+  /// modified by a rebuild of the hierarchy
+  void detachPrimitiveIndices();
+
+  /// @brief Delete an array owned by the model, unless it lives in the
+  /// external storage, and reset the pointer
+  template <typename T>
+  void releaseArray(T*& array);
+
+  /// @brief Release the external storage the model has been loaded into
+  void releaseExternalStorage();
+
   /// @brief Refit the bounding volume hierarchy in a top-down way (slow but more compact)
   int refitTree_topdown();
 
@@ -224,6 +319,9 @@ private:
 
   template <typename, typename>
   friend struct MakeParentRelativeRecurseImpl;
+
+  template <typename>
+  friend struct detail::BVHModelFile;
 };
 
 } // namespace fcl
@@ -0,0 +1,327 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FCL_BVH_QUANTIZED_MODEL_INL_H
+#define FCL_BVH_QUANTIZED_MODEL_INL_H
+
+#include "fcl/geometry/bvh/BVH_quantized_model.h"
+
+#include <cmath>
+#include <limits>
+
+namespace fcl
+{
+
+//==============================================================================
+extern template
+class FCL_EXPORT QuantizedBVHModel<double>;
+
+//==============================================================================
+template <typename S>
+QuantizedBVHModel<S>::QuantizedBVHModel()
+  : CollisionGeometry<S>()
+{
+  // Do nothing
+}
+
+//==============================================================================
+template <typename S>
+template <typename BV>
+int QuantizedBVHModel<S>::build(const BVHModel<BV>& model)
+{
+  if(model.getModelType() != BVH_MODEL_TRIANGLES)
+  {
+    std::cerr << "Warning! A quantized BVH can only be built from a triangle model." << std::endl;
+    return BVH_ERR_UNSUPPORTED_FUNCTION;
+  }
+
+  if(model.build_state != BVH_BUILD_STATE_PROCESSED && model.build_state != BVH_BUILD_STATE_UPDATED)
+  {
+    std::cerr << "Warning! Call endModel() on the source model before building a quantized BVH from it." << std::endl;
+    return BVH_ERR_BUILD_OUT_OF_SEQUENCE;
+  }
+
+  const int num_bvs = model.getNumBVs();
+  if(num_bvs == 0)
+    return BVH_ERR_BUILD_EMPTY_MODEL;
+
+  vertices.assign(model.vertices, model.vertices + model.num_vertices);
+  tri_indices.assign(model.tri_indices, model.tri_indices + model.num_tris);
+
+  // Exact boxes of the nodes, bottom-up: children are stored after their parent
+  std::vector<AABB<S>> node_bvs(num_bvs);
+  for(int i = num_bvs - 1; i >= 0; --i)
+  {
+    const BVNode<BV>& node = model.getBV(i);
+    if(node.isLeaf())
+    {
+      const Triangle& tri = tri_indices[node.primitiveId()];
+      node_bvs[i] = AABB<S>(vertices[tri[0]], vertices[tri[1]], vertices[tri[2]]);
+    }
+    else
+    {
+      node_bvs[i] = node_bvs[node.leftChild()] + node_bvs[node.rightChild()];
+    }
+  }
+
+  // Quantization, top-down: each box is quantized inside the dequantized box
+  // of its parent, which contains it
+  bvs.resize(num_bvs);
+  root_bv = node_bvs[0];
+  quantizeBV(0, root_bv, node_bvs[0]);
+  for(int i = 0; i < num_bvs; ++i)
+  {
+    const BVNode<BV>& node = model.getBV(i);
+    bvs[i].first_child = node.first_child;
+    if(!node.isLeaf())
+    {
+      quantizeBV(node.leftChild(), node_bvs[i], node_bvs[node.leftChild()]);
+      quantizeBV(node.rightChild(), node_bvs[i], node_bvs[node.rightChild()]);
+    }
+  }
+
+  computeLocalAABB();
+
+  return BVH_OK;
+}
+
+//==============================================================================
+template <typename S>
+int QuantizedBVHModel<S>::build(
+    const std::vector<Vector3<S>>& points,
+    const std::vector<Triangle>& triangles)
+{
+  BVHModel<AABB<S>> model;
+
+  int result = model.beginModel(triangles.size(), points.size());
+  if(result != BVH_OK)
+    return result;
+
+  result = model.addSubModel(points, triangles);
+  if(result != BVH_OK)
+    return result;
+
+  result = model.endModel();
+  if(result != BVH_OK)
+    return result;
+
+  return build(model);
+}
+
+//==============================================================================
+template <typename S>
+OBJECT_TYPE QuantizedBVHModel<S>::getObjectType() const
+{
+  return OT_BVH;
+}
+
+//==============================================================================
+template <typename S>
+NODE_TYPE QuantizedBVHModel<S>::getNodeType() const
+{
+  return BV_QuantizedAABB;
+}
+
+//==============================================================================
+template <typename S>
+void QuantizedBVHModel<S>::computeLocalAABB()
+{
+  this->aabb_center = root_bv.center();
+
+  this->aabb_radius = 0;
+  for(const Vector3<S>& v : vertices)
+  {
+    S r = (this->aabb_center - v).squaredNorm();
+    if(r > this->aabb_radius) this->aabb_radius = r;
+  }
+
+  this->aabb_radius = std::sqrt(this->aabb_radius);
+
+  this->aabb_local = root_bv;
+}
+
+//==============================================================================
+template <typename S>
+int QuantizedBVHModel<S>::getNumBVs() const
+{
+  return static_cast<int>(bvs.size());
+}
+
+//==============================================================================
+template <typename S>
+const QuantizedBVNode& QuantizedBVHModel<S>::getBV(int id) const
+{
+  return bvs[id];
+}
+
+//==============================================================================
+template <typename S>
+const AABB<S>& QuantizedBVHModel<S>::getRootBV() const
+{
+  return root_bv;
+}
+
+//==============================================================================
+template <typename S>
+AABB<S> QuantizedBVHModel<S>::dequantizeBV(int id, const AABB<S>& parent_bv) const
+{
+  const QuantizedBVNode& node = bvs[id];
+
+  AABB<S> bv;
+  for(int i = 0; i < 3; ++i)
+  {
+    bv.min_[i] = detail::dequantizeBound(parent_bv.min_[i], parent_bv.max_[i], node.min_[i]);
+    bv.max_[i] = detail::dequantizeBound(parent_bv.min_[i], parent_bv.max_[i], node.max_[i]);
+  }
+
+  return bv;
+}
+
+//==============================================================================
+template <typename S>
+int QuantizedBVHModel<S>::getNumVertices() const
+{
+  return static_cast<int>(vertices.size());
+}
+
+//==============================================================================
+template <typename S>
+int QuantizedBVHModel<S>::getNumTriangles() const
+{
+  return static_cast<int>(tri_indices.size());
+}
+
+//==============================================================================
+template <typename S>
+const Vector3<S>* QuantizedBVHModel<S>::getVertices() const
+{
+  return vertices.data();
+}
+
+//==============================================================================
+template <typename S>
+const Triangle* QuantizedBVHModel<S>::getTriangles() const
+{
+  return tri_indices.data();
+}
+
+//==============================================================================
+template <typename S>
+int QuantizedBVHModel<S>::memUsage(int msg) const
+{
+  int mem_bv_list = sizeof(QuantizedBVNode) * bvs.size();
+  int mem_tri_list = sizeof(Triangle) * tri_indices.size();
+  int mem_vertex_list = sizeof(Vector3<S>) * vertices.size();
+
+  int total_mem = mem_bv_list + mem_tri_list + mem_vertex_list + sizeof(QuantizedBVHModel<S>);
+  if(msg)
+  {
+    std::cerr << "Total for model " << total_mem << " bytes." << std::endl;
+    std::cerr << "BVs: " << bvs.size() << " allocated." << std::endl;
+    std::cerr << "Tris: " << tri_indices.size() << " allocated." << std::endl;
+    std::cerr << "Vertices: " << vertices.size() << " allocated." << std::endl;
+  }
+
+  return BVH_OK;
+}
+
+//==============================================================================
+template <typename S>
+void QuantizedBVHModel<S>::quantizeBV(int id, const AABB<S>& parent_bv, AABB<S>& bv)
+{
+  QuantizedBVNode& node = bvs[id];
+  for(int i = 0; i < 3; ++i)
+  {
+    node.min_[i] = detail::quantizeLowerBound(parent_bv.min_[i], parent_bv.max_[i], bv.min_[i]);
+    node.max_[i] = detail::quantizeUpperBound(parent_bv.min_[i], parent_bv.max_[i], bv.max_[i]);
+  }
+
+  bv = dequantizeBV(id, parent_bv);
+}
+
+namespace detail
+{
+
+//==============================================================================
+template <typename S>
+S dequantizeBound(S lo, S hi, std::uint16_t q)
+{
+  const std::uint16_t q_max = std::numeric_limits<std::uint16_t>::max();
+  if(q == q_max)
+    return hi;
+
+  return lo + (hi - lo) * (static_cast<S>(q) / static_cast<S>(q_max));
+}
+
+//==============================================================================
+template <typename S>
+std::uint16_t quantizeLowerBound(S lo, S hi, S x)
+{
+  const std::uint16_t q_max = std::numeric_limits<std::uint16_t>::max();
+  if(!(hi > lo))
+    return 0;
+
+  S t = std::floor((x - lo) / (hi - lo) * q_max);
+  std::uint16_t q = (t <= 0) ? 0 : ((t >= q_max) ? q_max : static_cast<std::uint16_t>(t));
+
+  // Rounding may put the estimate one step too high
+  while(q > 0 && dequantizeBound(lo, hi, q) > x)
+    --q;
+
+  return q;
+}
+
+//==============================================================================
+template <typename S>
+std::uint16_t quantizeUpperBound(S lo, S hi, S x)
+{
+  const std::uint16_t q_max = std::numeric_limits<std::uint16_t>::max();
+  if(!(hi > lo))
+    return q_max;
+
+  S t = std::ceil((x - lo) / (hi - lo) * q_max);
+  std::uint16_t q = (t <= 0) ? 0 : ((t >= q_max) ? q_max : static_cast<std::uint16_t>(t));
+
+  // Rounding may put the estimate one step too low
+  while(q < q_max && dequantizeBound(lo, hi, q) < x)
+    ++q;
+
+  return q;
+}
+
+} // namespace detail
+} // namespace fcl
+
+#endif
@@ -0,0 +1,155 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FCL_BVH_QUANTIZED_MODEL_H
+#define FCL_BVH_QUANTIZED_MODEL_H
+
+#include <cstdint>
+#include <vector>
+
+#include "fcl/geometry/bvh/BVH_model.h"
+#include "fcl/geometry/bvh/BV_node_quantized.h"
+
+namespace fcl
+{
+
+/// @brief A static triangle mesh whose hierarchy is made of 16-bit quantized
+/// AABB nodes (see QuantizedBVNode), for huge environment meshes that must
+/// stay resident in memory. The model is built once from a finalized
+/// BVHModel and cannot be updated afterwards. Queries keep the mesh in its own
+/// frame and dequantize the node boxes on the fly while traversing the tree.
+template <typename S>
+class FCL_EXPORT QuantizedBVHModel : public CollisionGeometry<S>
+{
+public:
+
+  QuantizedBVHModel();
+
+  /// @brief Build the model from a finalized triangle BVHModel. The tree of
+  /// the BVHModel is kept, and its bounding volumes are replaced by quantized
+  /// AABBs that contain the geometry of each node.
+  /// @return BVH_OK on success, or a BVHReturnCode describing the failure
+  template <typename BV>
+  int build(const BVHModel<BV>& model);
+
+  /// @brief Build the model from a triangle soup, through a BVHModel<AABB<S>>
+  /// @return BVH_OK on success, or a BVHReturnCode describing the failure
+  int build(const std::vector<Vector3<S>>& points,
+            const std::vector<Triangle>& triangles);
+
+  /// @brief Get the object type: it is a BVH
+  OBJECT_TYPE getObjectType() const override;
+
+  /// @brief Get the BV type: quantized AABB
+  NODE_TYPE getNodeType() const override;
+
+  /// @brief Compute the AABB for the model in its local coordinate system
+  void computeLocalAABB() override;
+
+  /// @brief Number of nodes in the hierarchy
+  int getNumBVs() const;
+
+  /// @brief Access the quantized node of the given id
+  const QuantizedBVNode& getBV(int id) const;
+
+  /// @brief Box of the whole model, in full precision. It is the box the root
+  /// node is quantized in.
+  const AABB<S>& getRootBV() const;
+
+  /// @brief Dequantize the box of the node of the given id, given the
+  /// dequantized box of its parent (getRootBV() for the root node). The result
+  /// always contains the geometry of the node.
+  AABB<S> dequantizeBV(int id, const AABB<S>& parent_bv) const;
+
+  /// @brief Number of vertices
+  int getNumVertices() const;
+
+  /// @brief Number of triangles
+  int getNumTriangles() const;
+
+  /// @brief Geometry point data
+  const Vector3<S>* getVertices() const;
+
+  /// @brief Geometry triangle index data
+  const Triangle* getTriangles() const;
+
+  /// @brief Check the number of memory used
+  int memUsage(int msg) const;
+
+private:
+
+  /// @brief Quantize the box bv of the node id inside parent_bv, and replace
+  /// bv by its dequantized value
+  void quantizeBV(int id, const AABB<S>& parent_bv, AABB<S>& bv);
+
+  std::vector<Vector3<S>> vertices;
+
+  std::vector<Triangle> tri_indices;
+
+  std::vector<QuantizedBVNode> bvs;
+
+  AABB<S> root_bv;
+};
+
+using QuantizedBVHModelf = QuantizedBVHModel<float>;
+using QuantizedBVHModeld = QuantizedBVHModel<double>;
+
+namespace detail
+{
+
+/// @brief The coordinate of the quantized bound q inside [lo, hi]. It is lo
+/// for q = 0 and hi for q = 65535.
+template <typename S>
+FCL_EXPORT
+S dequantizeBound(S lo, S hi, std::uint16_t q);
+
+/// @brief The largest q whose dequantized coordinate is not greater than x,
+/// where x is in [lo, hi]
+template <typename S>
+FCL_EXPORT
+std::uint16_t quantizeLowerBound(S lo, S hi, S x);
+
+/// @brief The smallest q whose dequantized coordinate is not less than x,
+/// where x is in [lo, hi]
+template <typename S>
+FCL_EXPORT
+std::uint16_t quantizeUpperBound(S lo, S hi, S x);
+
+} // namespace detail
+} // namespace fcl
+
+#include "fcl/geometry/bvh/BVH_quantized_model-inl.h"
+
+#endif
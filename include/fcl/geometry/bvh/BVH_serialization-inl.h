@@ -0,0 +1,309 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FCL_BVH_SERIALIZATION_INL_H
+#define FCL_BVH_SERIALIZATION_INL_H
+
+#include "fcl/geometry/bvh/BVH_serialization.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+#include "fcl/geometry/bvh/detail/BVH_mapped_file.h"
+
+namespace fcl
+{
+
+//==============================================================================
+template <typename BV>
+FCL_EXPORT
+int saveBVHModel(const BVHModel<BV>& model, const std::string& filename)
+{
+  return detail::BVHModelFile<BV>::save(model, filename);
+}
+
+//==============================================================================
+template <typename BV>
+FCL_EXPORT
+std::shared_ptr<BVHModel<BV>> loadBVHModel(const std::string& filename)
+{
+  return detail::BVHModelFile<BV>::load(filename);
+}
+
+namespace detail
+{
+
+//==============================================================================
+inline std::uint64_t alignBVHFileOffset(std::uint64_t offset)
+{
+  const std::uint64_t a = BVHFileHeader::alignment;
+  return (offset + a - 1) / a * a;
+}
+
+//==============================================================================
+inline const char* getBVHFileMagic()
+{
+  return "FCLBVH\0";
+}
+
+//==============================================================================
+template <typename BV>
+int BVHModelFile<BV>::save(
+    const BVHModel<BV>& model, const std::string& filename)
+{
+  using S = typename BV::S;
+
+  if(model.build_state != BVH_BUILD_STATE_PROCESSED
+     && model.build_state != BVH_BUILD_STATE_UPDATED)
+  {
+    std::cerr << "BVH Error! Only a finalized model can be saved to a file." << std::endl;
+    return BVH_ERR_BUILD_OUT_OF_SEQUENCE;
+  }
+
+  model.refitIfPending();
+
+  int num_primitives = 0;
+  switch(model.getModelType())
+  {
+    case BVH_MODEL_TRIANGLES:
+      num_primitives = model.num_tris;
+      break;
+    case BVH_MODEL_POINTCLOUD:
+      num_primitives = model.num_vertices;
+      break;
+    default:
+      std::cerr << "BVH Error: Model type not supported!" << std::endl;
+      return BVH_ERR_UNSUPPORTED_FUNCTION;
+  }
+
+  BVHFileHeader header;
+  std::memset(&header, 0, sizeof(header));
+  std::memcpy(header.magic, getBVHFileMagic(), sizeof(header.magic));
+  header.version = BVHFileHeader::current_version;
+  header.endianness = BVHFileHeader::endianness_tag;
+  header.node_type = model.getNodeType();
+  header.scalar_size = sizeof(S);
+  header.vertex_size = sizeof(Vector3<S>);
+  header.triangle_size = sizeof(Triangle);
+  header.node_size = sizeof(BVNode<BV>);
+  header.model_type = model.getModelType();
+  header.num_vertices = model.num_vertices;
+  header.num_tris = model.num_tris;
+  header.num_primitives = num_primitives;
+  header.num_bvs = model.num_bvs;
+
+  std::uint64_t offset = alignBVHFileOffset(sizeof(header));
+  header.vertices_offset = offset;
+  offset = alignBVHFileOffset(offset + sizeof(Vector3<S>) * model.num_vertices);
+  header.tri_indices_offset = offset;
+  offset = alignBVHFileOffset(offset + sizeof(Triangle) * model.num_tris);
+  header.primitive_indices_offset = offset;
+  offset = alignBVHFileOffset(offset + sizeof(unsigned int) * num_primitives);
+  header.bvs_offset = offset;
+
+  AABB<S> aabb;
+  for(int i = 0; i < model.num_vertices; ++i)
+    aabb += model.vertices[i];
+  const Vector3<S> center = aabb.center();
+  S radius = 0;
+  for(int i = 0; i < model.num_vertices; ++i)
+    radius = std::max(radius, (center - model.vertices[i]).squaredNorm());
+  for(int i = 0; i < 3; ++i)
+  {
+    header.aabb_min[i] = aabb.min_[i];
+    header.aabb_max[i] = aabb.max_[i];
+    header.aabb_center[i] = center[i];
+  }
+  header.aabb_radius = std::sqrt(radius);
+
+  std::ofstream out(filename.c_str(), std::ios::out | std::ios::binary);
+  if(!out)
+  {
+    std::cerr << "BVH Error! Cannot open " << filename << " for writing." << std::endl;
+    return BVH_ERR_FILE_IO;
+  }
+
+  auto write = [&out](std::uint64_t offset, const void* data, std::size_t size)
+  {
+    static const char padding[BVHFileHeader::alignment] = {0};
+    std::uint64_t pos = static_cast<std::uint64_t>(out.tellp());
+    while(pos < offset)
+    {
+      std::size_t n = std::min<std::uint64_t>(offset - pos, sizeof(padding));
+      out.write(padding, n);
+      pos += n;
+    }
+    if(size)
+      out.write(static_cast<const char*>(data), size);
+  };
+
+  write(0, &header, sizeof(header));
+  write(header.vertices_offset, model.vertices,
+        sizeof(Vector3<S>) * model.num_vertices);
+  write(header.tri_indices_offset, model.tri_indices,
+        sizeof(Triangle) * model.num_tris);
+  write(header.primitive_indices_offset, model.primitive_indices,
+        sizeof(unsigned int) * num_primitives);
+  write(header.bvs_offset, model.bvs, sizeof(BVNode<BV>) * model.num_bvs);
+
+  if(!out)
+  {
+    std::cerr << "BVH Error! Failed to write " << filename << "." << std::endl;
+    return BVH_ERR_FILE_IO;
+  }
+
+  return BVH_OK;
+}
+
+//==============================================================================
+template <typename BV>
+std::shared_ptr<BVHModel<BV>> BVHModelFile<BV>::load(
+    const std::string& filename)
+{
+  using S = typename BV::S;
+
+  std::shared_ptr<MappedFile> file = std::make_shared<MappedFile>(filename);
+  if(!file->isOpen() || file->size() < sizeof(BVHFileHeader))
+  {
+    std::cerr << "BVH Error! Cannot map " << filename << "." << std::endl;
+    return nullptr;
+  }
+
+  char* data = file->data();
+  BVHFileHeader header;
+  std::memcpy(&header, data, sizeof(header));
+
+  if(std::memcmp(header.magic, getBVHFileMagic(), sizeof(header.magic)) != 0)
+  {
+    std::cerr << "BVH Error! " << filename << " is not a BVH file." << std::endl;
+    return nullptr;
+  }
+
+  if(header.version != BVHFileHeader::current_version)
+  {
+    std::cerr << "BVH Error! " << filename << " has unsupported version "
+              << header.version << "." << std::endl;
+    return nullptr;
+  }
+
+  if(header.endianness != BVHFileHeader::endianness_tag)
+  {
+    std::cerr << "BVH Error! " << filename << " was written on a machine with a different endianness." << std::endl;
+    return nullptr;
+  }
+
+  std::shared_ptr<BVHModel<BV>> model = std::make_shared<BVHModel<BV>>();
+
+  if(header.node_type != static_cast<std::uint32_t>(model->getNodeType())
+     || header.scalar_size != sizeof(S)
+     || header.vertex_size != sizeof(Vector3<S>)
+     || header.triangle_size != sizeof(Triangle)
+     || header.node_size != sizeof(BVNode<BV>))
+  {
+    std::cerr << "BVH Error! " << filename << " holds a model of a different BV or scalar type." << std::endl;
+    return nullptr;
+  }
+
+  auto inside = [&file](std::uint64_t offset, std::uint64_t size)
+  {
+    return offset % BVHFileHeader::alignment == 0
+        && offset <= file->size() && size <= file->size() - offset;
+  };
+
+  if(header.num_vertices < 0 || header.num_tris < 0
+     || header.num_primitives < 0 || header.num_bvs <= 0
+     || !inside(header.vertices_offset,
+                sizeof(Vector3<S>) * static_cast<std::uint64_t>(header.num_vertices))
+     || !inside(header.tri_indices_offset,
+                sizeof(Triangle) * static_cast<std::uint64_t>(header.num_tris))
+     || !inside(header.primitive_indices_offset,
+                sizeof(unsigned int) * static_cast<std::uint64_t>(header.num_primitives))
+     || !inside(header.bvs_offset,
+                sizeof(BVNode<BV>) * static_cast<std::uint64_t>(header.num_bvs)))
+  {
+    std::cerr << "BVH Error! " << filename << " is truncated or corrupted." << std::endl;
+    return nullptr;
+  }
+
+  model->vertices = reinterpret_cast<Vector3<S>*>(data + header.vertices_offset);
+  model->num_vertices = model->num_vertices_allocated = header.num_vertices;
+
+  // The triangles and the primitive ordering are shared with the copies of
+  // the model, so they keep the mapping alive on their own
+  if(header.num_tris > 0)
+  {
+    Triangle* tri_indices
+        = reinterpret_cast<Triangle*>(data + header.tri_indices_offset);
+    model->tri_indices = tri_indices;
+    model->tri_indices_storage
+        = std::shared_ptr<Triangle>(tri_indices, [file](Triangle*) {});
+  }
+  model->num_tris = model->num_tris_allocated = header.num_tris;
+
+  unsigned int* primitive_indices = reinterpret_cast<unsigned int*>(
+        data + header.primitive_indices_offset);
+  model->primitive_indices = primitive_indices;
+  model->primitive_indices_storage = std::shared_ptr<unsigned int>(
+        primitive_indices, [file](unsigned int*) {});
+
+  model->bvs = reinterpret_cast<BVNode<BV>*>(data + header.bvs_offset);
+  model->num_bvs = model->num_bvs_allocated = header.num_bvs;
+
+  // Copies of the model copy the vertices and the BV nodes, so only this
+  // model needs the mapping for them
+  model->external_storage = file;
+  model->external_data = data;
+  model->external_size = file->size();
+
+  for(int i = 0; i < 3; ++i)
+  {
+    model->aabb_local.min_[i] = header.aabb_min[i];
+    model->aabb_local.max_[i] = header.aabb_max[i];
+    model->aabb_center[i] = header.aabb_center[i];
+  }
+  model->aabb_radius = header.aabb_radius;
+
+  model->build_state = BVH_BUILD_STATE_PROCESSED;
+
+  return model;
+}
+
+} // namespace detail
+} // namespace fcl
+
+#endif
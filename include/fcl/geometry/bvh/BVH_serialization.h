@@ -0,0 +1,132 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FCL_BVH_SERIALIZATION_H
+#define FCL_BVH_SERIALIZATION_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "fcl/geometry/bvh/BVH_model.h"
+
+namespace fcl
+{
+
+/// @brief Write a finalized BVHModel (vertices, triangles, primitive ordering
+/// and BV nodes) to a binary file that can be mapped back into memory by
+/// loadBVHModel(). The file stores the native binary representation of the
+/// model, so it can only be read on a machine with the same endianness and
+/// the same BV and scalar types; these are recorded in the file and checked
+/// when it is loaded.
+/// @return BVH_OK on success, or a BVHReturnCode describing the failure
+template <typename BV>
+FCL_EXPORT
+int saveBVHModel(const BVHModel<BV>& model, const std::string& filename);
+
+/// @brief Load a BVHModel written by saveBVHModel(). The file is mapped into
+/// memory and the model points directly into the mapping, so nothing is
+/// parsed or copied; the mapping is private, i.e., updating the model (e.g.,
+/// with beginReplaceModel()) never modifies the file. The mapping is released
+/// when the model and all its copies have been destroyed.
+/// @return the loaded model, or nullptr if the file cannot be mapped or does
+/// not hold a BVHModel<BV>
+template <typename BV>
+FCL_EXPORT
+std::shared_ptr<BVHModel<BV>> loadBVHModel(const std::string& filename);
+
+namespace detail
+{
+
+/// @brief Header of a file written by saveBVHModel(). Each array follows at
+/// the given offset, aligned to BVHFileHeader::alignment bytes.
+struct FCL_EXPORT BVHFileHeader
+{
+  /// @brief Alignment of the arrays in the file
+  enum { alignment = 64 };
+
+  /// @brief Current version of the file format
+  enum { current_version = 1 };
+
+  /// @brief Value of the endianness field as written on the saving machine
+  enum : std::uint32_t { endianness_tag = 0x01020304u };
+
+  char magic[8];
+  std::uint32_t version;
+  std::uint32_t endianness;
+
+  /// @brief NODE_TYPE of the BV and sizes of the stored types, to reject files
+  /// written for another BV or scalar type, or on another platform
+  std::uint32_t node_type;
+  std::uint32_t scalar_size;
+  std::uint32_t vertex_size;
+  std::uint32_t triangle_size;
+  std::uint32_t node_size;
+  std::uint32_t model_type;
+
+  std::int32_t num_vertices;
+  std::int32_t num_tris;
+  std::int32_t num_primitives;
+  std::int32_t num_bvs;
+
+  std::uint64_t vertices_offset;
+  std::uint64_t tri_indices_offset;
+  std::uint64_t primitive_indices_offset;
+  std::uint64_t bvs_offset;
+
+  /// @brief Local AABB of the model, so that loading does not need to touch
+  /// the vertices
+  double aabb_min[3];
+  double aabb_max[3];
+  double aabb_center[3];
+  double aabb_radius;
+};
+
+/// @brief Implementation of saveBVHModel() and loadBVHModel(), which needs
+/// access to the internals of BVHModel
+template <typename BV>
+struct FCL_EXPORT BVHModelFile
+{
+  static int save(const BVHModel<BV>& model, const std::string& filename);
+
+  static std::shared_ptr<BVHModel<BV>> load(const std::string& filename);
+};
+
+} // namespace detail
+} // namespace fcl
+
+#include "fcl/geometry/bvh/BVH_serialization-inl.h"
+
+#endif
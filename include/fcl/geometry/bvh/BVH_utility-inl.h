@@ -41,6 +41,8 @@
 #include "fcl/geometry/bvh/BVH_utility.h"
 
 #include "fcl/math/bv/utility.h"
+#include "fcl/math/bv/kIOS.h"
+#include "fcl/math/bv/OBBRSS.h"
 
 namespace fcl
 {
@@ -55,6 +57,10 @@ extern template
 void BVHExpand(
     BVHModel<RSS<double>>& model, const Variance3<double>* ucs, double r);
 
+//==============================================================================
+extern template
+void BVHRefitIfPending(const CollisionGeometry<double>* geom);
+
 //==============================================================================
 template <typename S, typename BV>
 FCL_EXPORT
@@ -167,6 +173,48 @@ void BVHExpand(
   }
 }
 
+//==============================================================================
+template <typename S>
+FCL_EXPORT
+void BVHRefitIfPending(const CollisionGeometry<S>* geom)
+{
+  if(geom->getObjectType() != OT_BVH)
+    return;
+
+  switch(geom->getNodeType())
+  {
+  case BV_AABB:
+    static_cast<const BVHModel<AABB<S>>*>(geom)->refitIfPending();
+    break;
+  case BV_OBB:
+    static_cast<const BVHModel<OBB<S>>*>(geom)->refitIfPending();
+    break;
+  case BV_RSS:
+    static_cast<const BVHModel<RSS<S>>*>(geom)->refitIfPending();
+    break;
+  case BV_kIOS:
+    static_cast<const BVHModel<kIOS<S>>*>(geom)->refitIfPending();
+    break;
+  case BV_OBBRSS:
+    static_cast<const BVHModel<OBBRSS<S>>*>(geom)->refitIfPending();
+    break;
+  case BV_KDOP16:
+    static_cast<const BVHModel<KDOP<S, 16>>*>(geom)->refitIfPending();
+    break;
+  case BV_KDOP18:
+    static_cast<const BVHModel<KDOP<S, 18>>*>(geom)->refitIfPending();
+    break;
+  case BV_KDOP24:
+    static_cast<const BVHModel<KDOP<S, 24>>*>(geom)->refitIfPending();
+    break;
+  case BV_FloatAABB:
+    static_cast<const BVHModel<FloatAABB<S>>*>(geom)->refitIfPending();
+    break;
+  default:
+    ;
+  }
+}
+
 } // namespace fcl
 
 #endif
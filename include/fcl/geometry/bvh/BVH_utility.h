@@ -64,6 +64,12 @@ FCL_EXPORT
 void BVHExpand(
     BVHModel<RSS<S>>& model, const Variance3<S>* ucs, S r = 1.0);
 
+/// @brief Perform the refit deferred by BVHModel::lazy_refit, if the geometry
+/// is a BVHModel with a pending refit
+template <typename S>
+FCL_EXPORT
+void BVHRefitIfPending(const CollisionGeometry<S>* geom);
+
 } // namespace fcl
 
 #include "fcl/geometry/bvh/BVH_utility-inl.h"
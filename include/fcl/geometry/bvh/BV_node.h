@@ -73,6 +73,25 @@ struct FCL_EXPORT BVNode : public BVNodeBase
   Matrix3<S> getOrientation() const;
 };
 
+/// @brief Level-of-detail proxy of a BV node: a vertex of the geometry in the
+/// node, and the radius of the ball around that vertex which contains all the
+/// geometry in the node. Replacing the geometry of two nodes by their proxy
+/// vertices overestimates the distance between them by at most the sum of the
+/// two radii.
+template <typename S>
+struct FCL_EXPORT BVNodeProxy
+{
+  /// @brief Index of the proxy vertex
+  int vertex;
+
+  /// @brief Index of a primitive of the node the proxy vertex belongs to
+  int primitive;
+
+  /// @brief Maximum distance between the proxy vertex and the geometry in the
+  /// node
+  S radius;
+};
+
 } // namespace fcl
 
 #include "fcl/geometry/bvh/BV_node-inl.h"
@@ -0,0 +1,79 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FCL_BV_BVNODEQUANTIZED_H
+#define FCL_BV_BVNODEQUANTIZED_H
+
+#include <cstdint>
+
+#include "fcl/export.h"
+
+namespace fcl
+{
+
+/// @brief Node of a QuantizedBVHModel. The node box is stored as 16-bit
+/// offsets inside the box of its parent node, so a node takes 16 bytes
+/// instead of the 64 bytes of a BVNode<AABB<double>>; the box is recovered
+/// during traversal from the already dequantized box of the parent.
+struct FCL_EXPORT QuantizedBVNode
+{
+  /// @brief The min point of the node box, quantized inside the parent box
+  std::uint16_t min_[3];
+
+  /// @brief The max point of the node box, quantized inside the parent box
+  std::uint16_t max_[3];
+
+  /// @brief An index for first child node or primitive
+  /// If the value is positive, it is the index of the first child node, and
+  /// the second child is stored right after it
+  /// If the value is negative, it is -(primitive index + 1)
+  std::int32_t first_child;
+
+  /// @brief Whether current node is a leaf node (i.e. contains a primitive index
+  bool isLeaf() const;
+
+  /// @brief Return the primitive index. The index is referred to the triangles in QuantizedBVHModel
+  int primitiveId() const;
+
+  /// @brief Return the index of the first child
+  int leftChild() const;
+
+  /// @brief Return the index of the second child
+  int rightChild() const;
+};
+
+} // namespace fcl
+
+#endif
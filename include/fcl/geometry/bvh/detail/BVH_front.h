@@ -38,7 +38,7 @@
 #ifndef FCL_BVH_FRONT_H
 #define FCL_BVH_FRONT_H
 
-#include <list>
+#include <vector>
 #include "fcl/export.h"
 
 namespace fcl
@@ -65,8 +65,10 @@ struct FCL_EXPORT BVHFrontNode
   BVHFrontNode(int left_, int right_);
 };
 
-/// @brief BVH front list is a list of front nodes.
-using BVHFrontList = std::list<BVHFrontNode>;
+/// @brief BVH front list is a list of front nodes. The nodes are stored
+/// contiguously, so that the front can be reused across queries without
+/// allocating once its capacity has grown to the size of the front.
+using BVHFrontList = std::vector<BVHFrontNode>;
 
 /// @brief Add new front node into the front list
 FCL_EXPORT
@@ -0,0 +1,85 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FCL_BVH_DETAIL_MAPPEDFILE_H
+#define FCL_BVH_DETAIL_MAPPEDFILE_H
+
+#include <cstddef>
+#include <string>
+#include "fcl/export.h"
+
+namespace fcl
+{
+
+namespace detail
+{
+
+/// @brief A whole file mapped into memory. The mapping is private
+/// (copy-on-write): the pages are shared with the file system cache until
+/// they are written to, and writing through the mapping never modifies the
+/// file.
+class FCL_EXPORT MappedFile
+{
+public:
+  /// @brief Map the given file; isOpen() tells whether this succeeded
+  explicit MappedFile(const std::string& filename);
+
+  ~MappedFile();
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  /// @brief Whether the file is mapped
+  bool isOpen() const;
+
+  /// @brief Beginning of the mapped file
+  char* data() const;
+
+  /// @brief Size of the mapped file, in bytes
+  std::size_t size() const;
+
+private:
+  char* data_;
+  std::size_t size_;
+
+  /// @brief Platform handles of the file and the mapping (Windows only)
+  void* file_handle_;
+  void* mapping_handle_;
+};
+
+} // namespace detail
+} // namespace fcl
+
+#endif
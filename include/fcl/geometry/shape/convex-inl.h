@@ -41,6 +41,9 @@
 
 #include "fcl/geometry/shape/convex.h"
 
+#include <algorithm>
+#include <utility>
+
 namespace fcl
 {
 
@@ -66,6 +69,35 @@ Convex<S>::Convex(
     sum += vertex;
   }
   interior_point_ = sum * (S)(1.0 / vertices_->size());
+
+  // Build the vertex adjacency graph from the edges of the faces; each edge
+  // is shared by two faces, and triangulated faces add their diagonals.
+  const std::vector<int>& face_data = *faces_;
+  std::vector<std::pair<int, int>> edges;
+  edges.reserve(face_data.size() * 2);
+  int face_index = 0;
+  for (int i = 0; i < num_faces_; ++i) {
+    const int vertex_count = face_data[face_index];
+    for (int j = 1; j <= vertex_count; ++j) {
+      const int a = face_data[face_index + j];
+      const int b = face_data[face_index + (j % vertex_count) + 1];
+      edges.emplace_back(a, b);
+      edges.emplace_back(b, a);
+    }
+    face_index += vertex_count + 1;
+  }
+  std::sort(edges.begin(), edges.end());
+  edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+
+  neighbor_offsets_.assign(vertices_->size() + 1, 0);
+  neighbors_.reserve(edges.size());
+  for (const auto& edge : edges) {
+    ++neighbor_offsets_[edge.first + 1];
+    neighbors_.push_back(edge.second);
+  }
+  for (std::size_t i = 1; i < neighbor_offsets_.size(); ++i) {
+    neighbor_offsets_[i] += neighbor_offsets_[i - 1];
+  }
 }
 
 //==============================================================================
@@ -248,6 +280,46 @@ std::vector<Vector3<S>> Convex<S>::getBoundVertices(
   return result;
 }
 
+//==============================================================================
+template <typename S>
+int Convex<S>::findExtremeVertex(const Vector3<S>& dir, int start) const {
+  const std::vector<Vector3<S>>& vertices = *vertices_;
+  const int num_vertices = static_cast<int>(vertices.size());
+
+  // Below this size, the linear scan is as fast as the hill climbing.
+  const int kMinHillClimbingVertices = 32;
+
+  if (num_vertices < kMinHillClimbingVertices || neighbors_.empty()) {
+    int best = 0;
+    S max_dot = dir.dot(vertices[0]);
+    for (int i = 1; i < num_vertices; ++i) {
+      const S dot = dir.dot(vertices[i]);
+      if (dot > max_dot) {
+        best = i;
+        max_dot = dot;
+      }
+    }
+    return best;
+  }
+
+  int best = (start >= 0 && start < num_vertices) ? start : 0;
+  S max_dot = dir.dot(vertices[best]);
+  int current = -1;
+  while (current != best) {
+    current = best;
+    for (int i = neighbor_offsets_[current];
+         i < neighbor_offsets_[current + 1]; ++i) {
+      const int neighbor = neighbors_[i];
+      const S dot = dir.dot(vertices[neighbor]);
+      if (dot > max_dot) {
+        best = neighbor;
+        max_dot = dot;
+      }
+    }
+  }
+  return best;
+}
+
 } // namespace fcl
 
 #endif
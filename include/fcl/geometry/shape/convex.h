@@ -158,11 +158,33 @@ public:
   /// a specific configuration
   std::vector<Vector3<S>> getBoundVertices(const Transform3<S>& tf) const;
 
+  /// @brief Finds the index of a vertex with the largest projection on the
+  /// direction `dir`, i.e., the support vertex of the polytope in that
+  /// direction.
+  ///
+  /// Small polytopes are scanned linearly. Larger ones are searched by hill
+  /// climbing on the graph of the face edges, from the vertex `start`: the
+  /// search moves to the best neighbor until none improves, which on a convex
+  /// polytope is a global maximum. Starting from the support vertex of a
+  /// nearby direction, as GJK and EPA do from one iteration to the next, the
+  /// search visits a few vertices only.
+  ///
+  /// @param dir    The direction; it need not be unit length.
+  /// @param start  The index of the vertex the search starts from; ignored by
+  ///               the linear scan.
+  int findExtremeVertex(const Vector3<S>& dir, int start = 0) const;
+
 private:
   const std::shared_ptr<const std::vector<Vector3<S>>> vertices_;
   const int num_faces_;
   const std::shared_ptr<const std::vector<int>> faces_;
   Vector3<S> interior_point_;
+
+  // The vertex adjacency graph built from the face edges, in compressed rows:
+  // the neighbors of vertex i are neighbors_[neighbor_offsets_[i]] up to
+  // neighbors_[neighbor_offsets_[i + 1]] (excluded).
+  std::vector<int> neighbor_offsets_;
+  std::vector<int> neighbors_;
 };
 
 // Workaround for https://gcc.gnu.org/bugzilla/show_bug.cgi?id=57728 which
@@ -84,6 +84,10 @@ void constructBox(const KDOP<double, 18>& bv, Box<double>& box, Transform3<doubl
 extern template
 void constructBox(const KDOP<double, 24>& bv, Box<double>& box, Transform3<double>& tf);
 
+//==============================================================================
+extern template
+void constructBox(const FloatAABB<double>& bv, Box<double>& box, Transform3<double>& tf);
+
 //==============================================================================
 extern template
 void constructBox(const AABB<double>& bv, const Transform3<double>& tf_bv, Box<double>& box, Transform3<double>& tf);
@@ -116,6 +120,10 @@ void constructBox(const KDOP<double, 18>& bv, const Transform3<double>& tf_bv, B
 extern template
 void constructBox(const KDOP<double, 24>& bv, const Transform3<double>& tf_bv, Box<double>& box, Transform3<double>& tf);
 
+//==============================================================================
+extern template
+void constructBox(const FloatAABB<double>& bv, const Transform3<double>& tf_bv, Box<double>& box, Transform3<double>& tf);
+
 //==============================================================================
 namespace detail {
 //==============================================================================
@@ -933,6 +941,18 @@ struct FCL_EXPORT ComputeBVImpl<S, AABB<S>, TriangleP<S>>
   }
 };
 
+//==============================================================================
+template <typename S, typename Shape>
+struct FCL_EXPORT ComputeBVImpl<S, FloatAABB<S>, Shape>
+{
+  static void run(const Shape& s, const Transform3<S>& tf, FloatAABB<S>& bv)
+  {
+    AABB<S> bv_;
+    computeBV(s, tf, bv_);
+    bv = FloatAABB<S>(bv_);
+  }
+};
+
 //==============================================================================
 extern template
 struct ComputeBVImpl<double, AABB<double>, Box<double>>;
@@ -1135,6 +1155,13 @@ void constructBox(const KDOP<S, 24>& bv, Box<S>& box, Transform3<S>& tf)
   tf.translation() = bv.center();
 }
 
+//==============================================================================
+template <typename S>
+void constructBox(const FloatAABB<S>& bv, Box<S>& box, Transform3<S>& tf)
+{
+  constructBox(bv.toAABB(), box, tf);
+}
+
 //==============================================================================
 template <typename S>
 void constructBox(const AABB<S>& bv, const Transform3<S>& tf_bv, Box<S>& box, Transform3<S>& tf)
@@ -1209,6 +1236,13 @@ void constructBox(const KDOP<S, 24>& bv, const Transform3<S>& tf_bv, Box<S>& box
   tf = tf_bv * Translation3<S>(bv.center());
 }
 
+//==============================================================================
+template <typename S>
+void constructBox(const FloatAABB<S>& bv, const Transform3<S>& tf_bv, Box<S>& box, Transform3<S>& tf)
+{
+  constructBox(bv.toAABB(), tf_bv, box, tf);
+}
+
 } // namespace fcl
 
 #endif
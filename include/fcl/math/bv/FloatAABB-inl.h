@@ -0,0 +1,263 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FCL_BV_FLOATAABB_INL_H
+#define FCL_BV_FLOATAABB_INL_H
+
+#include "fcl/math/bv/FloatAABB.h"
+
+#include <cmath>
+#include <limits>
+
+namespace fcl
+{
+
+//==============================================================================
+extern template
+class FCL_EXPORT FloatAABB<double>;
+
+namespace detail
+{
+
+//==============================================================================
+extern template
+float roundDownToFloat(double x);
+
+//==============================================================================
+extern template
+float roundUpToFloat(double x);
+
+//==============================================================================
+template <typename S>
+float roundDownToFloat(S x)
+{
+  float f = static_cast<float>(x);
+  if(static_cast<S>(f) > x)
+    f = std::nextafter(f, -std::numeric_limits<float>::infinity());
+  return f;
+}
+
+//==============================================================================
+template <typename S>
+float roundUpToFloat(S x)
+{
+  float f = static_cast<float>(x);
+  if(static_cast<S>(f) < x)
+    f = std::nextafter(f, std::numeric_limits<float>::infinity());
+  return f;
+}
+
+} // namespace detail
+
+//==============================================================================
+template <typename S>
+FloatAABB<S>::FloatAABB()
+  : min_(Vector3<float>::Constant(std::numeric_limits<float>::max())),
+    max_(Vector3<float>::Constant(-std::numeric_limits<float>::max()))
+{
+  // Do nothing
+}
+
+//==============================================================================
+template <typename S>
+FloatAABB<S>::FloatAABB(const Vector3<S>& v)
+{
+  for(int i = 0; i < 3; ++i)
+  {
+    min_[i] = detail::roundDownToFloat(v[i]);
+    max_[i] = detail::roundUpToFloat(v[i]);
+  }
+}
+
+//==============================================================================
+template <typename S>
+FloatAABB<S>::FloatAABB(const Vector3<S>& a, const Vector3<S>& b)
+  : FloatAABB(AABB<S>(a, b))
+{
+  // Do nothing
+}
+
+//==============================================================================
+template <typename S>
+FloatAABB<S>::FloatAABB(const AABB<S>& aabb)
+{
+  for(int i = 0; i < 3; ++i)
+  {
+    min_[i] = detail::roundDownToFloat(aabb.min_[i]);
+    max_[i] = detail::roundUpToFloat(aabb.max_[i]);
+  }
+}
+
+//==============================================================================
+template <typename S>
+bool FloatAABB<S>::overlap(const FloatAABB<S>& other) const
+{
+  if ((min_.array() > other.max_.array()).any())
+    return false;
+
+  if ((max_.array() < other.min_.array()).any())
+    return false;
+
+  return true;
+}
+
+//==============================================================================
+template <typename S>
+bool FloatAABB<S>::contain(const FloatAABB<S>& other) const
+{
+  if ((min_.array() > other.min_.array()).any())
+    return false;
+
+  if ((max_.array() < other.max_.array()).any())
+    return false;
+
+  return true;
+}
+
+//==============================================================================
+template <typename S>
+bool FloatAABB<S>::contain(const Vector3<S>& p) const
+{
+  return toAABB().contain(p);
+}
+
+//==============================================================================
+template <typename S>
+FloatAABB<S>& FloatAABB<S>::operator +=(const Vector3<S>& p)
+{
+  return *this += FloatAABB<S>(p);
+}
+
+//==============================================================================
+template <typename S>
+FloatAABB<S>& FloatAABB<S>::operator +=(const FloatAABB<S>& other)
+{
+  min_ = min_.cwiseMin(other.min_);
+  max_ = max_.cwiseMax(other.max_);
+  return *this;
+}
+
+//==============================================================================
+template <typename S>
+FloatAABB<S> FloatAABB<S>::operator +(const FloatAABB<S>& other) const
+{
+  FloatAABB res(*this);
+  return res += other;
+}
+
+//==============================================================================
+template <typename S>
+S FloatAABB<S>::width() const
+{
+  return static_cast<S>(max_[0]) - static_cast<S>(min_[0]);
+}
+
+//==============================================================================
+template <typename S>
+S FloatAABB<S>::height() const
+{
+  return static_cast<S>(max_[1]) - static_cast<S>(min_[1]);
+}
+
+//==============================================================================
+template <typename S>
+S FloatAABB<S>::depth() const
+{
+  return static_cast<S>(max_[2]) - static_cast<S>(min_[2]);
+}
+
+//==============================================================================
+template <typename S>
+S FloatAABB<S>::volume() const
+{
+  return width() * height() * depth();
+}
+
+//==============================================================================
+template <typename S>
+S FloatAABB<S>::size() const
+{
+  return (max_.template cast<S>() - min_.template cast<S>()).squaredNorm();
+}
+
+//==============================================================================
+template <typename S>
+S FloatAABB<S>::radius() const
+{
+  return (max_.template cast<S>() - min_.template cast<S>()).norm() / 2;
+}
+
+//==============================================================================
+template <typename S>
+Vector3<S> FloatAABB<S>::center() const
+{
+  return (min_.template cast<S>() + max_.template cast<S>()) * 0.5;
+}
+
+//==============================================================================
+template <typename S>
+S FloatAABB<S>::distance(
+    const FloatAABB<S>& other, Vector3<S>* P, Vector3<S>* Q) const
+{
+  return toAABB().distance(other.toAABB(), P, Q);
+}
+
+//==============================================================================
+template <typename S>
+S FloatAABB<S>::distance(const FloatAABB<S>& other) const
+{
+  return toAABB().distance(other.toAABB());
+}
+
+//==============================================================================
+template <typename S>
+bool FloatAABB<S>::equal(const FloatAABB<S>& other) const
+{
+  return min_ == other.min_ && max_ == other.max_;
+}
+
+//==============================================================================
+template <typename S>
+AABB<S> FloatAABB<S>::toAABB() const
+{
+  AABB<S> aabb;
+  aabb.min_ = min_.template cast<S>();
+  aabb.max_ = max_.template cast<S>();
+  return aabb;
+}
+
+} // namespace fcl
+
+#endif
@@ -0,0 +1,150 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FCL_BV_FLOATAABB_H
+#define FCL_BV_FLOATAABB_H
+
+#include "fcl/math/bv/AABB.h"
+
+namespace fcl
+{
+
+/// @brief An AABB whose bounds are stored in single precision, while its
+/// interface (points, distances, conversions) uses the scalar type S. Every
+/// bound is rounded outward when it is stored, by at most one float ULP, so
+/// the box always contains the geometry it was built from, and the overlap
+/// tests between two FloatAABBs never miss a contact. Using FloatAABB<double>
+/// as the BV of a BVHModel halves the size of the BV nodes compared to
+/// AABB<double>, while the vertices and the primitive tests stay in double.
+template <typename S_>
+class FCL_EXPORT FloatAABB
+{
+public:
+
+  using S = S_;
+
+  /// @brief The min point in the AABB, rounded down
+  Vector3<float> min_;
+
+  /// @brief The max point in the AABB, rounded up
+  Vector3<float> max_;
+
+  /// @brief Creating an AABB with zero size (low bound +inf, upper bound -inf)
+  FloatAABB();
+
+  /// @brief Creating the smallest AABB containing the point v
+  FloatAABB(const Vector3<S>& v);
+
+  /// @brief Creating the smallest AABB containing the two points a and b
+  FloatAABB(const Vector3<S>& a, const Vector3<S>& b);
+
+  /// @brief Creating the smallest AABB containing the given AABB
+  explicit FloatAABB(const AABB<S>& aabb);
+
+  /// @brief Check whether two AABB are overlap
+  bool overlap(const FloatAABB<S>& other) const;
+
+  /// @brief Check whether the AABB contains another AABB
+  bool contain(const FloatAABB<S>& other) const;
+
+  /// @brief Check whether the AABB contains a point
+  bool contain(const Vector3<S>& p) const;
+
+  /// @brief Merge the AABB and a point
+  FloatAABB<S>& operator += (const Vector3<S>& p);
+
+  /// @brief Merge the AABB and another AABB
+  FloatAABB<S>& operator += (const FloatAABB<S>& other);
+
+  /// @brief Return the merged AABB of current AABB and the other one
+  FloatAABB<S> operator + (const FloatAABB<S>& other) const;
+
+  /// @brief Width of the AABB
+  S width() const;
+
+  /// @brief Height of the AABB
+  S height() const;
+
+  /// @brief Depth of the AABB
+  S depth() const;
+
+  /// @brief Volume of the AABB
+  S volume() const;
+
+  /// @brief Size of the AABB (used in BV_Splitter to order two AABBs)
+  S size() const;
+
+  /// @brief Radius of the AABB
+  S radius() const;
+
+  /// @brief Center of the AABB
+  Vector3<S> center() const;
+
+  /// @brief Distance between two AABBs; P and Q, should not be nullptr, return
+  /// the nearest points
+  S distance(const FloatAABB<S>& other, Vector3<S>* P, Vector3<S>* Q) const;
+
+  /// @brief Distance between two AABBs
+  S distance(const FloatAABB<S>& other) const;
+
+  /// @brief whether two AABB are equal
+  bool equal(const FloatAABB<S>& other) const;
+
+  /// @brief The AABB in the scalar type S; this conversion is exact
+  AABB<S> toAABB() const;
+};
+
+using FloatAABBf = FloatAABB<float>;
+using FloatAABBd = FloatAABB<double>;
+
+namespace detail
+{
+
+/// @brief The largest float not greater than x
+template <typename S>
+FCL_EXPORT
+float roundDownToFloat(S x);
+
+/// @brief The smallest float not less than x
+template <typename S>
+FCL_EXPORT
+float roundUpToFloat(S x);
+
+} // namespace detail
+} // namespace fcl
+
+#include "fcl/math/bv/FloatAABB-inl.h"
+
+#endif
@@ -40,6 +40,8 @@
 
 #include "fcl/math/bv/OBB.h"
 
+#include <algorithm>
+
 #include "fcl/common/unused.h"
 
 namespace fcl
@@ -76,6 +78,10 @@ bool obbDisjoint(
     const Vector3<double>& a,
     const Vector3<double>& b);
 
+//==============================================================================
+extern template
+struct OBBPairBatch<double>;
+
 //==============================================================================
 template <typename S>
 OBB<S>::OBB()
@@ -220,12 +226,54 @@ template <typename S>
 S OBB<S>::distance(const OBB& other, Vector3<S>* P,
                              Vector3<S>* Q) const
 {
-  FCL_UNUSED(other);
   FCL_UNUSED(P);
   FCL_UNUSED(Q);
 
-  std::cerr << "OBB distance not implemented!" << std::endl;
-  return 0.0;
+  // Express the other OBB in the frame of this one
+  const Matrix3<S> R = axis.transpose() * other.axis;
+  const Vector3<S> T = axis.transpose() * (other.To - To);
+  const Matrix3<S> Rabs = R.cwiseAbs();
+
+  S d = 0;
+
+  // Face normals of this OBB
+  for(int i = 0; i < 3; ++i)
+  {
+    const S gap = std::abs(T[i]) - extent[i] - Rabs.row(i).dot(other.extent);
+    d = std::max(d, gap);
+  }
+
+  // Face normals of the other OBB
+  for(int j = 0; j < 3; ++j)
+  {
+    const S gap = std::abs(T.dot(R.col(j))) - Rabs.col(j).dot(extent)
+        - other.extent[j];
+    d = std::max(d, gap);
+  }
+
+  // Cross products of the edge directions; the axes are not unit, so the gaps
+  // are scaled by their norms. Nearly parallel edges give a degenerate axis,
+  // already covered by the face normals.
+  for(int i = 0; i < 3; ++i)
+  {
+    const int i1 = (i + 1) % 3;
+    const int i2 = (i + 2) % 3;
+    for(int j = 0; j < 3; ++j)
+    {
+      const int j1 = (j + 1) % 3;
+      const int j2 = (j + 2) % 3;
+
+      const S norm = std::sqrt(R(i1, j) * R(i1, j) + R(i2, j) * R(i2, j));
+      if(norm < 1e-6) continue;
+
+      const S gap = std::abs(T[i2] * R(i1, j) - T[i1] * R(i2, j))
+          - extent[i1] * Rabs(i2, j) - extent[i2] * Rabs(i1, j)
+          - other.extent[j1] * Rabs(i, j2) - other.extent[j2] * Rabs(i, j1);
+      d = std::max(d, gap / norm);
+    }
+  }
+
+  return d;
 }
 
 //==============================================================================
@@ -394,6 +442,124 @@ bool overlap(const Eigen::MatrixBase<DerivedA>& R0,
   return !obbDisjoint(R, T, b1.extent, b2.extent);
 }
 
+//==============================================================================
+template <typename S>
+constexpr int OBBPairBatch<S>::capacity;
+
+//==============================================================================
+template <typename S>
+void OBBPairBatch<S>::set(
+    int i,
+    const Matrix3<S>& B_,
+    const Vector3<S>& T_,
+    const Vector3<S>& a_,
+    const Vector3<S>& b_)
+{
+  for(int r = 0; r < 3; ++r)
+  {
+    for(int c = 0; c < 3; ++c)
+      B[3 * r + c][i] = B_(r, c);
+
+    T[r][i] = T_[r];
+    a[r][i] = a_[r];
+    b[r][i] = b_[r];
+  }
+}
+
+//==============================================================================
+template <typename S>
+void OBBPairBatch<S>::set(
+    int i,
+    const Matrix3<S>& R0,
+    const Vector3<S>& T0,
+    const OBB<S>& b1,
+    const OBB<S>& b2)
+{
+  const Matrix3<S> R0b2 = R0 * b2.axis;
+  const Matrix3<S> R = b1.axis.transpose() * R0b2;
+
+  const Vector3<S> Ttemp = R0 * b2.To + T0 - b1.To;
+  const Vector3<S> T = b1.axis.transpose() * Ttemp;
+
+  set(i, R, T, b1.extent, b2.extent);
+}
+
+//==============================================================================
+template <typename S>
+void obbDisjointBatch(const OBBPairBatch<S>& batch, int n, bool disjoint[])
+{
+  for(int i = 0; i < n; ++i)
+    detail::obbDisjointLanes<detail::ScalarLane<S>>(batch, i, disjoint);
+}
+
+namespace detail
+{
+
+//==============================================================================
+template <typename Lane>
+void obbDisjointLanes(
+    const OBBPairBatch<typename Lane::S>& batch, int first, bool disjoint[])
+{
+  // Same tests as obbDisjoint(), without the early exits
+  const Lane reps = Lane::broadcast(1e-6);
+
+  Lane B[3][3];
+  Lane Bf[3][3];
+  for(int r = 0; r < 3; ++r)
+  {
+    for(int c = 0; c < 3; ++c)
+    {
+      B[r][c] = Lane::load(batch.B[3 * r + c] + first);
+      Bf[r][c] = B[r][c].abs() + reps;
+    }
+  }
+
+  Lane T[3];
+  Lane a[3];
+  Lane b[3];
+  for(int k = 0; k < 3; ++k)
+  {
+    T[k] = Lane::load(batch.T[k] + first);
+    a[k] = Lane::load(batch.a[k] + first);
+    b[k] = Lane::load(batch.b[k] + first);
+  }
+
+  // A1 x A2 = A0, A2 x A0 = A1, A0 x A1 = A2
+  typename Lane::Mask mask =
+      T[0].abs() > (a[0] + (Bf[0][0] * b[0] + Bf[0][1] * b[1] + Bf[0][2] * b[2]));
+  for(int k = 1; k < 3; ++k)
+    mask = mask | (T[k].abs() > (a[k] + (Bf[k][0] * b[0] + Bf[k][1] * b[1] + Bf[k][2] * b[2])));
+
+  // B1 x B2 = B0, B2 x B0 = B1, B0 x B1 = B2
+  for(int k = 0; k < 3; ++k)
+  {
+    const Lane s = B[0][k] * T[0] + B[1][k] * T[1] + B[2][k] * T[2];
+    mask = mask | (s.abs() > (b[k] + (Bf[0][k] * a[0] + Bf[1][k] * a[1] + Bf[2][k] * a[2])));
+  }
+
+  // Ai x Bj; (i, i1, i2) is a cyclic permutation of (0, 1, 2), and the other
+  // indices are sorted so that the sums are evaluated as in obbDisjoint()
+  for(int i = 0; i < 3; ++i)
+  {
+    const int i1 = (i + 1) % 3;
+    const int i2 = (i + 2) % 3;
+    const int ilo = std::min(i1, i2);
+    const int ihi = std::max(i1, i2);
+    for(int j = 0; j < 3; ++j)
+    {
+      const int jlo = (j == 0) ? 1 : 0;
+      const int jhi = (j == 2) ? 1 : 2;
+      const Lane s = T[i2] * B[i1][j] - T[i1] * B[i2][j];
+      mask = mask | (s.abs() > (a[ilo] * Bf[ihi][j] + a[ihi] * Bf[ilo][j]
+                                + b[jlo] * Bf[i][jhi] + b[jhi] * Bf[i][jlo]));
+    }
+  }
+
+  Lane::store(mask, disjoint + first);
+}
+
+} // namespace detail
+
 //==============================================================================
 template <typename S>
 bool obbDisjoint(const Matrix3<S>& B, const Vector3<S>& T,
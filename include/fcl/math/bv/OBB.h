@@ -42,6 +42,7 @@
 
 #include "fcl/common/types.h"
 #include "fcl/math/geometry.h"
+#include "fcl/math/detail/simd_lane.h"
 
 namespace fcl
 {
@@ -111,7 +112,9 @@ public:
   /// @brief Center of the OBB
   const Vector3<S> center() const;
 
-  /// @brief Distance between two OBBs, not implemented.
+  /// @brief A lower bound of the distance between two OBBs: the largest gap
+  /// between their projections on the 15 axes of the separating axis test. It
+  /// is 0 when the OBBs overlap. P and Q are not computed.
   S distance(const OBB& other, Vector3<S>* P = nullptr,
                   Vector3<S>* Q = nullptr) const;
 
@@ -172,6 +175,68 @@ bool obbDisjoint(
     const Vector3<S>& a,
     const Vector3<S>& b);
 
+/// @brief A batch of OBB pairs, stored as a structure of arrays so that the
+/// separating axis tests of all the pairs can be evaluated together. Each pair
+/// is in the form taken by obbDisjoint(B, T, a, b).
+template <typename S>
+struct FCL_EXPORT OBBPairBatch
+{
+  /// @brief Maximum number of pairs in a batch
+  static constexpr int capacity = 4;
+
+  /// @brief Store the pair i of the batch
+  void set(int i,
+           const Matrix3<S>& B_,
+           const Vector3<S>& T_,
+           const Vector3<S>& a_,
+           const Vector3<S>& b_);
+
+  /// @brief Store the pair i as overlap(R0, T0, b1, b2) tests it
+  void set(int i,
+           const Matrix3<S>& R0,
+           const Vector3<S>& T0,
+           const OBB<S>& b1,
+           const OBB<S>& b2);
+
+  /// @brief Rotations of the pairs; B[3 * r + c][i] is the entry (r, c) of the
+  /// rotation of the pair i
+  S B[9][capacity];
+
+  /// @brief Translations of the pairs
+  S T[3][capacity];
+
+  /// @brief Half dimensions of the first boxes
+  S a[3][capacity];
+
+  /// @brief Half dimensions of the second boxes
+  S b[3][capacity];
+};
+
+/// @brief obbDisjoint() on the first n pairs of batch; disjoint[i] receives the
+/// result for the pair i. For double, the pairs are tested together with AVX
+/// or SSE2 instructions when the library is built with them enabled (see the
+/// FCL_USE_X64_SSE option), and one by one otherwise.
+template <typename S>
+FCL_EXPORT
+void obbDisjointBatch(const OBBPairBatch<S>& batch, int n, bool disjoint[]);
+
+/// @brief Vectorized obbDisjointBatch() for double, defined in OBB.cpp
+template <>
+FCL_EXPORT
+void obbDisjointBatch(const OBBPairBatch<double>& batch, int n, bool disjoint[]);
+
+namespace detail
+{
+
+/// @brief obbDisjoint() on the pairs [first, first + Lane::width) of batch,
+/// one pair per lane of the vector type Lane
+template <typename Lane>
+FCL_EXPORT
+void obbDisjointLanes(
+    const OBBPairBatch<typename Lane::S>& batch, int first, bool disjoint[]);
+
+} // namespace detail
+
 } // namespace fcl
 
 #include "fcl/math/bv/OBB-inl.h"
@@ -40,6 +40,9 @@
 
 #include "fcl/math/bv/kDOP.h"
 
+#include <algorithm>
+#include <cmath>
+
 #include "fcl/common/unused.h"
 
 namespace fcl
@@ -260,12 +263,27 @@ template <typename S, std::size_t N>
 FCL_EXPORT
 S KDOP<S, N>::distance(const KDOP<S, N>& other, Vector3<S>* P, Vector3<S>* Q) const
 {
-  FCL_UNUSED(other);
   FCL_UNUSED(P);
   FCL_UNUSED(Q);
 
-  std::cerr << "KDOP distance not implemented!" << std::endl;
-  return 0.0;
+  // The axes are x, y, z, then the sums and differences of two of them, then
+  // (for N = 24) the combinations of all three, so their norms are 1, sqrt(2)
+  // and sqrt(3). The gap along any axis bounds the distance from below.
+  const S inv_sqrt2 = 1 / std::sqrt(S(2));
+  const S inv_sqrt3 = 1 / std::sqrt(S(3));
+
+  S d = 0;
+  for(std::size_t i = 0; i < N / 2; ++i)
+  {
+    const S gap = std::max(
+          dist_[i] - other.dist_[i + N / 2], other.dist_[i] - dist_[i + N / 2]);
+    if(gap <= 0) continue;
+
+    const S scaled_gap = (i < 3) ? gap : (i < 9) ? gap * inv_sqrt2 : gap * inv_sqrt3;
+    if(scaled_gap > d) d = scaled_gap;
+  }
+
+  return d;
 }
 
 //==============================================================================
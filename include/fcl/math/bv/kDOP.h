@@ -129,7 +129,9 @@ public:
   /// @brief The (AABB) center
   Vector3<S> center() const;
 
-  /// @brief The distance between two KDOP<S, N>. Not implemented.
+  /// @brief A lower bound of the distance between two KDOP<S, N>: the largest
+  /// gap between their slabs along one of the N / 2 directions. It is 0 when
+  /// the KDOPs overlap. P and Q are not computed.
   S distance(
       const KDOP<S, N>& other,
       Vector3<S>* P = nullptr, Vector3<S>* Q = nullptr) const;
@@ -0,0 +1,156 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FCL_MATH_DETAIL_SIMDLANE_H
+#define FCL_MATH_DETAIL_SIMDLANE_H
+
+#if defined(__AVX__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+#include "fcl/export.h"
+
+namespace fcl
+{
+
+namespace detail
+{
+
+/// @brief Single lane vector type for the batched kernels (obbDisjointLanes(),
+/// triangleDisjointLanes()), with plain scalar arithmetic. The AVX and SSE2
+/// lanes below have the same interface, with one batch element per lane.
+template <typename S_>
+struct FCL_EXPORT ScalarLane
+{
+  using S = S_;
+  using Mask = bool;
+
+  static constexpr int width = 1;
+
+  static ScalarLane load(const S* p) { return {p[0]}; }
+  static ScalarLane broadcast(S x) { return {x}; }
+  static void store(Mask m, bool* p) { p[0] = m; }
+  static bool all(Mask m) { return m; }
+  static ScalarLane min(const ScalarLane& a, const ScalarLane& b) { return {(b.v < a.v) ? b.v : a.v}; }
+  static ScalarLane max(const ScalarLane& a, const ScalarLane& b) { return {(a.v < b.v) ? b.v : a.v}; }
+
+  ScalarLane operator+(const ScalarLane& o) const { return {v + o.v}; }
+  ScalarLane operator-(const ScalarLane& o) const { return {v - o.v}; }
+  ScalarLane operator*(const ScalarLane& o) const { return {v * o.v}; }
+  ScalarLane abs() const { return {(v < 0.0) ? -v : v}; }
+  Mask operator>(const ScalarLane& o) const { return v > o.v; }
+
+  S v;
+};
+
+//==============================================================================
+template <typename S_>
+constexpr int ScalarLane<S_>::width;
+
+// The vector lanes depend on the instruction sets enabled for the translation
+// unit, so they are only used in the sources of the library.
+
+#if defined(__AVX__)
+
+/// @brief Four lanes of double in an AVX register
+struct AVXLane
+{
+  using S = double;
+  using Mask = AVXLane;
+
+  static constexpr int width = 4;
+
+  static AVXLane load(const double* p) { return {_mm256_loadu_pd(p)}; }
+  static AVXLane broadcast(double x) { return {_mm256_set1_pd(x)}; }
+  static void store(Mask m, bool* p)
+  {
+    const int bits = _mm256_movemask_pd(m.v);
+    for(int i = 0; i < width; ++i)
+      p[i] = (bits >> i) & 1;
+  }
+  static bool all(Mask m) { return _mm256_movemask_pd(m.v) == 0xf; }
+  static AVXLane min(const AVXLane& a, const AVXLane& b) { return {_mm256_min_pd(b.v, a.v)}; }
+  static AVXLane max(const AVXLane& a, const AVXLane& b) { return {_mm256_max_pd(b.v, a.v)}; }
+
+  AVXLane operator+(const AVXLane& o) const { return {_mm256_add_pd(v, o.v)}; }
+  AVXLane operator-(const AVXLane& o) const { return {_mm256_sub_pd(v, o.v)}; }
+  AVXLane operator*(const AVXLane& o) const { return {_mm256_mul_pd(v, o.v)}; }
+  AVXLane operator|(const AVXLane& o) const { return {_mm256_or_pd(v, o.v)}; }
+  AVXLane abs() const { return {_mm256_andnot_pd(_mm256_set1_pd(-0.0), v)}; }
+  Mask operator>(const AVXLane& o) const { return {_mm256_cmp_pd(v, o.v, _CMP_GT_OQ)}; }
+
+  __m256d v;
+};
+
+#endif
+
+#if defined(__SSE2__)
+
+/// @brief Two lanes of double in an SSE2 register
+struct SSE2Lane
+{
+  using S = double;
+  using Mask = SSE2Lane;
+
+  static constexpr int width = 2;
+
+  static SSE2Lane load(const double* p) { return {_mm_loadu_pd(p)}; }
+  static SSE2Lane broadcast(double x) { return {_mm_set1_pd(x)}; }
+  static void store(Mask m, bool* p)
+  {
+    const int bits = _mm_movemask_pd(m.v);
+    for(int i = 0; i < width; ++i)
+      p[i] = (bits >> i) & 1;
+  }
+  static bool all(Mask m) { return _mm_movemask_pd(m.v) == 0x3; }
+  static SSE2Lane min(const SSE2Lane& a, const SSE2Lane& b) { return {_mm_min_pd(b.v, a.v)}; }
+  static SSE2Lane max(const SSE2Lane& a, const SSE2Lane& b) { return {_mm_max_pd(b.v, a.v)}; }
+
+  SSE2Lane operator+(const SSE2Lane& o) const { return {_mm_add_pd(v, o.v)}; }
+  SSE2Lane operator-(const SSE2Lane& o) const { return {_mm_sub_pd(v, o.v)}; }
+  SSE2Lane operator*(const SSE2Lane& o) const { return {_mm_mul_pd(v, o.v)}; }
+  SSE2Lane operator|(const SSE2Lane& o) const { return {_mm_or_pd(v, o.v)}; }
+  SSE2Lane abs() const { return {_mm_andnot_pd(_mm_set1_pd(-0.0), v)}; }
+  Mask operator>(const SSE2Lane& o) const { return {_mm_cmpgt_pd(v, o.v)}; }
+
+  __m128d v;
+};
+
+#endif
+
+} // namespace detail
+} // namespace fcl
+
+#endif
@@ -0,0 +1,123 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FCL_BATCHCOLLISION_INL_H
+#define FCL_BATCHCOLLISION_INL_H
+
+#include "fcl/narrowphase/batch_collision.h"
+
+#include "fcl/geometry/bvh/BVH_utility.h"
+#include "fcl/narrowphase/detail/gjk_solver_indep.h"
+#include "fcl/narrowphase/detail/gjk_solver_inline.h"
+#include "fcl/narrowphase/detail/gjk_solver_libccd.h"
+#include "fcl/narrowphase/detail/traversal/collision/mesh_shape_batch_collision_traversal_node.h"
+
+namespace fcl
+{
+
+//==============================================================================
+template <typename BV, typename NarrowPhaseSolver>
+std::size_t collide(
+    const std::vector<const CollisionGeometry<typename BV::S>*>& geometries,
+    const aligned_vector<Transform3<typename BV::S>>& tfs,
+    const BVHModel<BV>* model,
+    const Transform3<typename BV::S>& tf,
+    const NarrowPhaseSolver* nsolver,
+    const CollisionRequest<typename BV::S>& request,
+    std::vector<CollisionResult<typename BV::S>>& results)
+{
+  results.resize(geometries.size());
+
+  if(!model || request.num_max_contacts == 0) return 0;
+
+  BVHRefitIfPending(model);
+
+  detail::MeshShapeBatchCollisionTraversalNode<BV, NarrowPhaseSolver> node;
+  if(!detail::initialize(node, *model, tf, geometries, tfs, nsolver, request, results))
+    return 0;
+
+  node.collide();
+
+  std::size_t num_collisions = 0;
+  for(const auto& result : results)
+  {
+    if(result.isCollision()) ++num_collisions;
+  }
+
+  return num_collisions;
+}
+
+//==============================================================================
+template <typename BV>
+std::size_t collide(
+    const std::vector<const CollisionGeometry<typename BV::S>*>& geometries,
+    const aligned_vector<Transform3<typename BV::S>>& tfs,
+    const BVHModel<BV>* model,
+    const Transform3<typename BV::S>& tf,
+    const CollisionRequest<typename BV::S>& request,
+    std::vector<CollisionResult<typename BV::S>>& results)
+{
+  using S = typename BV::S;
+
+  switch(request.gjk_solver_type)
+  {
+  case GST_LIBCCD:
+    {
+      detail::GJKSolver_libccd<S> solver;
+      solver.collision_tolerance = request.gjk_tolerance;
+      return collide(geometries, tfs, model, tf, &solver, request, results);
+    }
+  case GST_INDEP:
+    {
+      detail::GJKSolver_indep<S> solver;
+      solver.gjk_tolerance = request.gjk_tolerance;
+      solver.epa_tolerance = request.gjk_tolerance;
+      return collide(geometries, tfs, model, tf, &solver, request, results);
+    }
+  case GST_INLINE:
+    {
+      detail::GJKSolver_inline<S> solver;
+      solver.gjk_tolerance = request.gjk_tolerance;
+      solver.epa_tolerance = request.gjk_tolerance;
+      return collide(geometries, tfs, model, tf, &solver, request, results);
+    }
+  default:
+    return 0;
+  }
+}
+
+} // namespace fcl
+
+#endif
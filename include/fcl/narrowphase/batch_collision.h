@@ -0,0 +1,86 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FCL_BATCHCOLLISION_H
+#define FCL_BATCHCOLLISION_H
+
+#include <vector>
+
+#include "fcl/common/types.h"
+#include "fcl/geometry/bvh/BVH_model.h"
+#include "fcl/narrowphase/collision_request.h"
+#include "fcl/narrowphase/collision_result.h"
+
+namespace fcl
+{
+
+/// @brief Batched collision interface between many shapes and one mesh, e.g.,
+/// the tools or the fingers of a robot against a large environment. The BVH
+/// of the mesh is traversed once for the whole batch, instead of once per
+/// shape, with each node tested against the shapes that overlap its parent
+/// only. The result of the i-th shape, at the transform tfs[i], is
+/// results[i], to which the contacts of collide(geometries[i], tfs[i], model,
+/// tf, request, results[i]) are added; results is resized to the number of
+/// shapes. The query cache, the approximate cost and the parallel traversal
+/// of the request are not used. Return value is the number of shapes in
+/// collision with the mesh.
+template <typename BV>
+FCL_EXPORT
+std::size_t collide(
+    const std::vector<const CollisionGeometry<typename BV::S>*>& geometries,
+    const aligned_vector<Transform3<typename BV::S>>& tfs,
+    const BVHModel<BV>* model,
+    const Transform3<typename BV::S>& tf,
+    const CollisionRequest<typename BV::S>& request,
+    std::vector<CollisionResult<typename BV::S>>& results);
+
+/// @brief Batched collision interface between many shapes and one mesh, using
+/// the narrow phase solver nsolver
+template <typename BV, typename NarrowPhaseSolver>
+FCL_EXPORT
+std::size_t collide(
+    const std::vector<const CollisionGeometry<typename BV::S>*>& geometries,
+    const aligned_vector<Transform3<typename BV::S>>& tfs,
+    const BVHModel<BV>* model,
+    const Transform3<typename BV::S>& tf,
+    const NarrowPhaseSolver* nsolver,
+    const CollisionRequest<typename BV::S>& request,
+    std::vector<CollisionResult<typename BV::S>>& results);
+
+} // namespace fcl
+
+#include "fcl/narrowphase/batch_collision-inl.h"
+
+#endif
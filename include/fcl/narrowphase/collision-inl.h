@@ -40,8 +40,10 @@
 
 #include "fcl/narrowphase/collision.h"
 
+#include "fcl/geometry/bvh/BVH_utility.h"
 #include "fcl/narrowphase/detail/collision_func_matrix.h"
 #include "fcl/narrowphase/detail/gjk_solver_indep.h"
+#include "fcl/narrowphase/detail/gjk_solver_inline.h"
 #include "fcl/narrowphase/detail/gjk_solver_libccd.h"
 
 namespace fcl
@@ -115,6 +117,9 @@ std::size_t collide(
   }
   else
   {
+    BVHRefitIfPending(o1);
+    BVHRefitIfPending(o2);
+
     OBJECT_TYPE object_type1 = o1->getObjectType();
     OBJECT_TYPE object_type2 = o2->getObjectType();
     NODE_TYPE node_type1 = o1->getNodeType();
@@ -169,6 +174,13 @@ std::size_t collide(const CollisionObject<S>* o1, const CollisionObject<S>* o2,
       solver.epa_tolerance = request.gjk_tolerance;
       return collide(o1, o2, &solver, request, result);
     }
+  case GST_INLINE:
+    {
+      detail::GJKSolver_inline<S> solver;
+      solver.gjk_tolerance = request.gjk_tolerance;
+      solver.epa_tolerance = request.gjk_tolerance;
+      return collide(o1, o2, &solver, request, result);
+    }
   default:
     return -1; // error
   }
@@ -200,6 +212,13 @@ std::size_t collide(
       solver.epa_tolerance = request.gjk_tolerance;
       return collide(o1, tf1, o2, tf2, &solver, request, result);
     }
+  case GST_INLINE:
+    {
+      detail::GJKSolver_inline<S> solver;
+      solver.gjk_tolerance = request.gjk_tolerance;
+      solver.epa_tolerance = request.gjk_tolerance;
+      return collide(o1, tf1, o2, tf2, &solver, request, result);
+    }
   default:
     std::cerr << "Warning! Invalid GJK solver" << std::endl;
     return -1; // error
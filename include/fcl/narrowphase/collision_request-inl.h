@@ -67,7 +67,11 @@ CollisionRequest<S>::CollisionRequest(
     gjk_solver_type(gjk_solver_type_),
     enable_cached_gjk_guess(false),
     cached_gjk_guess(Vector3<S>::UnitX()),
-    gjk_tolerance(gjk_tolerance_)
+    gjk_tolerance(gjk_tolerance_),
+    query_cache(nullptr),
+    gjk_cache(nullptr),
+    num_threads(1),
+    enable_statistics(false)
 {
   // Do nothing
 }
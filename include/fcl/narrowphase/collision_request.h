@@ -39,7 +39,9 @@
 #define FCL_COLLISIONREQUEST_H
 
 #include "fcl/common/types.h"
+#include "fcl/narrowphase/gjk_cache.h"
 #include "fcl/narrowphase/gjk_solver_type.h"
+#include "fcl/narrowphase/query_cache.h"
 
 namespace fcl
 {
@@ -93,6 +95,30 @@ struct FCL_EXPORT CollisionRequest
   /// a value that is consistent with the precision of `S`.
   Real gjk_tolerance{1e-6};
 
+  /// @brief Cache of the BVH traversal between the two geometries, reused from
+  /// one query to the next when they move little (see QueryCache). The cache
+  /// is updated by the query. The default is nullptr, i.e., no cache.
+  QueryCache<S>* query_cache;
+
+  /// @brief Cache of the final GJK simplices of the pairs of shapes, from
+  /// which the next queries on the same pairs start (see GJKCache). The cache
+  /// is updated by the query. The default is nullptr, i.e., no cache.
+  GJKCache<S>* gjk_cache;
+
+  /// @brief Number of threads used by a single query between two meshes.
+  /// The BVTT is expanded to a set of independent node pairs, which are
+  /// traversed concurrently. The contacts are the same, in the
+  /// same order, as with a sequential traversal. It is
+  /// worth it for large meshes only. 0 means one thread per hardware thread.
+  /// The default is 1, i.e., the traversal is sequential. It is ignored when
+  /// query_cache is set.
+  unsigned int num_threads;
+
+  /// @brief If true, the statistics of the traversal (see QueryStatistics)
+  /// are accumulated in the statistics of the result, and recorded in
+  /// QueryStatisticsSink::global() if it is set. The default is false.
+  bool enable_statistics;
+
   /// @brief Default constructor
   CollisionRequest(size_t num_max_contacts_ = 1,
                    bool enable_contact_ = false,
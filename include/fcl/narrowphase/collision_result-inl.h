@@ -126,6 +126,7 @@ void CollisionResult<S>::clear()
 {
   contacts.clear();
   cost_sources.clear();
+  statistics = QueryStatistics();
 }
 
 } // namespace fcl
@@ -43,6 +43,7 @@
 #include "fcl/common/types.h"
 #include "fcl/narrowphase/contact.h"
 #include "fcl/narrowphase/cost_source.h"
+#include "fcl/narrowphase/query_statistics.h"
 
 namespace fcl
 {
@@ -61,6 +62,10 @@ private:
 public:
   Vector3<S> cached_gjk_guess;
 
+  /// @brief Statistics of the queries that filled the result, if their
+  /// request enabled them
+  QueryStatistics statistics;
+
 public:
   CollisionResult();
 
@@ -376,6 +376,11 @@ S continuousCollideConservativeAdvancement(
       detail::GJKSolver_indep<S> solver;
       return detail::continuousCollideConservativeAdvancement(o1, motion1, o2, motion2, &solver, request, result);
     }
+  case GST_INLINE:
+    {
+      detail::GJKSolver_inline<S> solver;
+      return detail::continuousCollideConservativeAdvancement(o1, motion1, o2, motion2, &solver, request, result);
+    }
   default:
     return -1;
   }
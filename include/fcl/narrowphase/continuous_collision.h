@@ -42,6 +42,7 @@
 #include "fcl/narrowphase/collision_object.h"
 #include "fcl/narrowphase/continuous_collision_object.h"
 #include "fcl/narrowphase/detail/gjk_solver_indep.h"
+#include "fcl/narrowphase/detail/gjk_solver_inline.h"
 #include "fcl/narrowphase/detail/gjk_solver_libccd.h"
 #include "fcl/narrowphase/detail/conservative_advancement_func_matrix.h"
 #include "fcl/narrowphase/detail/traversal/collision/mesh_continuous_collision_traversal_node.h"
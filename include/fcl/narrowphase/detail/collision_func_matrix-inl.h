@@ -59,6 +59,7 @@
 #include "fcl/geometry/shape/utility.h"
 
 #include "fcl/narrowphase/detail/traversal/collision_node.h"
+#include "fcl/narrowphase/detail/traversal/scoped_query_statistics.h"
 
 #include "fcl/narrowphase/detail/traversal/collision/bvh_collision_traversal_node.h"
 #include "fcl/narrowphase/detail/traversal/collision/bvh_shape_collision_traversal_node.h"
@@ -66,6 +67,8 @@
 #include "fcl/narrowphase/detail/traversal/collision/mesh_collision_traversal_node.h"
 #include "fcl/narrowphase/detail/traversal/collision/mesh_continuous_collision_traversal_node.h"
 #include "fcl/narrowphase/detail/traversal/collision/mesh_shape_collision_traversal_node.h"
+#include "fcl/narrowphase/detail/traversal/collision/quantized_mesh_collision_traversal_node.h"
+#include "fcl/narrowphase/detail/traversal/collision/quantized_mesh_shape_collision_traversal_node.h"
 #include "fcl/narrowphase/detail/traversal/collision/shape_bvh_collision_traversal_node.h"
 #include "fcl/narrowphase/detail/traversal/collision/shape_collision_traversal_node.h"
 #include "fcl/narrowphase/detail/traversal/collision/shape_mesh_collision_traversal_node.h"
@@ -109,6 +112,7 @@ std::size_t ShapeOcTreeCollide(
   OcTreeSolver<NarrowPhaseSolver> otsolver(nsolver);
 
   initialize(node, *obj1, tf1, *obj2, tf2, &otsolver, request, result);
+  ScopedQueryStatistics<ShapeOcTreeCollisionTraversalNode<Shape, NarrowPhaseSolver>> statistics(node);
   collide(&node);
 
   return result.numContacts();
@@ -135,6 +139,7 @@ std::size_t OcTreeShapeCollide(
   OcTreeSolver<NarrowPhaseSolver> otsolver(nsolver);
 
   initialize(node, *obj1, tf1, *obj2, tf2, &otsolver, request, result);
+  ScopedQueryStatistics<OcTreeShapeCollisionTraversalNode<Shape, NarrowPhaseSolver>> statistics(node);
   collide(&node);
 
   return result.numContacts();
@@ -161,6 +166,7 @@ std::size_t OcTreeCollide(
   OcTreeSolver<NarrowPhaseSolver> otsolver(nsolver);
 
   initialize(node, *obj1, tf1, *obj2, tf2, &otsolver, request, result);
+  ScopedQueryStatistics<OcTreeCollisionTraversalNode<NarrowPhaseSolver>> statistics(node);
   collide(&node);
 
   return result.numContacts();
@@ -192,6 +198,7 @@ std::size_t OcTreeBVHCollide(
     OcTreeSolver<NarrowPhaseSolver> otsolver(nsolver);
 
     initialize(node, *obj1, tf1, *obj2, tf2, &otsolver, no_cost_request, result);
+    ScopedQueryStatistics<OcTreeMeshCollisionTraversalNode<BV, NarrowPhaseSolver>> statistics(node);
     collide(&node);
 
     Box<S> box;
@@ -213,6 +220,7 @@ std::size_t OcTreeBVHCollide(
     OcTreeSolver<NarrowPhaseSolver> otsolver(nsolver);
 
     initialize(node, *obj1, tf1, *obj2, tf2, &otsolver, request, result);
+    ScopedQueryStatistics<OcTreeMeshCollisionTraversalNode<BV, NarrowPhaseSolver>> statistics(node);
     collide(&node);
   }
 
@@ -245,6 +253,7 @@ std::size_t BVHOcTreeCollide(
     OcTreeSolver<NarrowPhaseSolver> otsolver(nsolver);
 
     initialize(node, *obj1, tf1, *obj2, tf2, &otsolver, no_cost_request, result);
+    ScopedQueryStatistics<MeshOcTreeCollisionTraversalNode<BV, NarrowPhaseSolver>> statistics(node);
     collide(&node);
 
     Box<S> box;
@@ -266,6 +275,7 @@ std::size_t BVHOcTreeCollide(
     OcTreeSolver<NarrowPhaseSolver> otsolver(nsolver);
 
     initialize(node, *obj1, tf1, *obj2, tf2, &otsolver, request, result);
+    ScopedQueryStatistics<MeshOcTreeCollisionTraversalNode<BV, NarrowPhaseSolver>> statistics(node);
     collide(&node);
   }
 
@@ -301,8 +311,15 @@ std::size_t ShapeShapeCollide(
     nsolver->enableCachedGuess(true);
   }
 
+  if(request.gjk_cache)
+    nsolver->setCachedSimplex(&request.gjk_cache->get(o1, o2));
+
   initialize(node, *obj1, tf1, *obj2, tf2, nsolver, request, result);
-  collide(&node);
+  ScopedQueryStatistics<ShapeCollisionTraversalNode<Shape1, Shape2, NarrowPhaseSolver>> statistics(node);
+  collideStatic(&node);
+
+  if(request.gjk_cache)
+    nsolver->setCachedSimplex(nullptr);
 
   if(request.enable_cached_gjk_guess)
     result.cached_gjk_guess = nsolver->getCachedGuess();
@@ -338,8 +355,9 @@ struct BVHShapeCollider
       Transform3<S> tf1_tmp = tf1;
       const Shape* obj2 = static_cast<const Shape*>(o2);
 
-      initialize(node, *obj1_tmp, tf1_tmp, *obj2, tf2, nsolver, no_cost_request, result);
-      fcl::detail::collide(&node);
+      initialize(node, *obj1_tmp, tf1_tmp, *obj2, tf2, nsolver, no_cost_request, result, request.query_cache != nullptr);
+      ScopedQueryStatistics<MeshShapeCollisionTraversalNode<BV, Shape, NarrowPhaseSolver>> statistics(node);
+      collideCached(&node, request.query_cache, o1, o2);
 
       delete obj1_tmp;
 
@@ -362,8 +380,9 @@ struct BVHShapeCollider
       Transform3<S> tf1_tmp = tf1;
       const Shape* obj2 = static_cast<const Shape*>(o2);
 
-      initialize(node, *obj1_tmp, tf1_tmp, *obj2, tf2, nsolver, request, result);
-      fcl::detail::collide(&node);
+      initialize(node, *obj1_tmp, tf1_tmp, *obj2, tf2, nsolver, request, result, request.query_cache != nullptr);
+      ScopedQueryStatistics<MeshShapeCollisionTraversalNode<BV, Shape, NarrowPhaseSolver>> statistics(node);
+      collideCached(&node, request.query_cache, o1, o2);
 
       delete obj1_tmp;
     }
@@ -398,7 +417,8 @@ std::size_t orientedBVHShapeCollide(
     const Shape* obj2 = static_cast<const Shape*>(o2);
 
     initialize(node, *obj1, tf1, *obj2, tf2, nsolver, no_cost_request, result);
-    fcl::detail::collide(&node);
+    ScopedQueryStatistics<OrientMeshShapeCollisionTraveralNode> statistics(node);
+    collideCached(&node, request.query_cache, o1, o2);
 
     Box<S> box;
     Transform3<S> box_tf;
@@ -418,7 +438,8 @@ std::size_t orientedBVHShapeCollide(
     const Shape* obj2 = static_cast<const Shape*>(o2);
 
     initialize(node, *obj1, tf1, *obj2, tf2, nsolver, request, result);
-    fcl::detail::collide(&node);
+    ScopedQueryStatistics<OrientMeshShapeCollisionTraveralNode> statistics(node);
+    collideCached(&node, request.query_cache, o1, o2);
   }
 
   return result.numContacts();
@@ -543,8 +564,14 @@ struct BVHCollideImpl
     BVHModel<BV>* obj2_tmp = new BVHModel<BV>(*obj2);
     Transform3<S> tf2_tmp = tf2;
 
-    initialize(node, *obj1_tmp, tf1_tmp, *obj2_tmp, tf2_tmp, request, result);
-    collide(&node);
+    // The front of a query cache indexes the trees of the models, so they are
+    // refitted in the world frame instead of rebuilt
+    initialize(node, *obj1_tmp, tf1_tmp, *obj2_tmp, tf2_tmp, request, result, request.query_cache != nullptr);
+    ScopedQueryStatistics<MeshCollisionTraversalNode<BV>> statistics(node);
+    if(request.num_threads != 1 && !request.query_cache)
+      collideParallel(&node, request.num_threads);
+    else
+      collideCached(&node, request.query_cache, o1, o2);
 
     delete obj1_tmp;
     delete obj2_tmp;
@@ -584,7 +611,11 @@ std::size_t orientedMeshCollide(
   const BVHModel<BV>* obj2 = static_cast<const BVHModel<BV>* >(o2);
 
   initialize(node, *obj1, tf1, *obj2, tf2, request, result);
-  collide(&node);
+  ScopedQueryStatistics<OrientedMeshCollisionTraversalNode> statistics(node);
+  if(request.num_threads != 1 && !request.query_cache)
+    collideParallel(&node, request.num_threads);
+  else
+    collideCached(&node, request.query_cache, o1, o2);
 
   return result.numContacts();
 }
@@ -659,6 +690,60 @@ std::size_t BVHCollide(
   return BVHCollide<BV>(o1, tf1, o2, tf2, request, result);
 }
 
+//==============================================================================
+template <typename Shape, typename NarrowPhaseSolver>
+std::size_t QuantizedBVHShapeCollide(
+    const CollisionGeometry<typename Shape::S>* o1,
+    const Transform3<typename Shape::S>& tf1,
+    const CollisionGeometry<typename Shape::S>* o2,
+    const Transform3<typename Shape::S>& tf2,
+    const NarrowPhaseSolver* nsolver,
+    const CollisionRequest<typename Shape::S>& request,
+    CollisionResult<typename Shape::S>& result)
+{
+  using S = typename Shape::S;
+
+  if(request.isSatisfied(result)) return result.numContacts();
+
+  QuantizedMeshShapeCollisionTraversalNode<Shape, NarrowPhaseSolver> node;
+  const QuantizedBVHModel<S>* obj1 = static_cast<const QuantizedBVHModel<S>* >(o1);
+  const Shape* obj2 = static_cast<const Shape*>(o2);
+
+  initialize(node, *obj1, tf1, *obj2, tf2, nsolver, request, result);
+  ScopedQueryStatistics<QuantizedMeshShapeCollisionTraversalNode<Shape, NarrowPhaseSolver>> statistics(node);
+  fcl::detail::collide(&node);
+
+  return result.numContacts();
+}
+
+//==============================================================================
+template <typename NarrowPhaseSolver>
+std::size_t QuantizedBVHCollide(
+    const CollisionGeometry<typename NarrowPhaseSolver::S>* o1,
+    const Transform3<typename NarrowPhaseSolver::S>& tf1,
+    const CollisionGeometry<typename NarrowPhaseSolver::S>* o2,
+    const Transform3<typename NarrowPhaseSolver::S>& tf2,
+    const NarrowPhaseSolver* nsolver,
+    const CollisionRequest<typename NarrowPhaseSolver::S>& request,
+    CollisionResult<typename NarrowPhaseSolver::S>& result)
+{
+  FCL_UNUSED(nsolver);
+
+  using S = typename NarrowPhaseSolver::S;
+
+  if(request.isSatisfied(result)) return result.numContacts();
+
+  QuantizedMeshCollisionTraversalNode<S> node;
+  const QuantizedBVHModel<S>* obj1 = static_cast<const QuantizedBVHModel<S>* >(o1);
+  const QuantizedBVHModel<S>* obj2 = static_cast<const QuantizedBVHModel<S>* >(o2);
+
+  initialize(node, *obj1, tf1, *obj2, tf2, request, result);
+  ScopedQueryStatistics<QuantizedMeshCollisionTraversalNode<S>> statistics(node);
+  fcl::detail::collide(&node);
+
+  return result.numContacts();
+}
+
 //==============================================================================
 template <typename NarrowPhaseSolver>
 CollisionFunctionMatrix<NarrowPhaseSolver>::CollisionFunctionMatrix()
@@ -840,6 +925,26 @@ CollisionFunctionMatrix<NarrowPhaseSolver>::CollisionFunctionMatrix()
   collision_matrix[BV_OBBRSS][GEOM_PLANE] = &BVHShapeCollider<OBBRSS<S>, Plane<S>, NarrowPhaseSolver>::collide;
   collision_matrix[BV_OBBRSS][GEOM_HALFSPACE] = &BVHShapeCollider<OBBRSS<S>, Halfspace<S>, NarrowPhaseSolver>::collide;
 
+  collision_matrix[BV_FloatAABB][GEOM_BOX] = &BVHShapeCollider<FloatAABB<S>, Box<S>, NarrowPhaseSolver>::collide;
+  collision_matrix[BV_FloatAABB][GEOM_SPHERE] = &BVHShapeCollider<FloatAABB<S>, Sphere<S>, NarrowPhaseSolver>::collide;
+  collision_matrix[BV_FloatAABB][GEOM_ELLIPSOID] = &BVHShapeCollider<FloatAABB<S>, Ellipsoid<S>, NarrowPhaseSolver>::collide;
+  collision_matrix[BV_FloatAABB][GEOM_CAPSULE] = &BVHShapeCollider<FloatAABB<S>, Capsule<S>, NarrowPhaseSolver>::collide;
+  collision_matrix[BV_FloatAABB][GEOM_CONE] = &BVHShapeCollider<FloatAABB<S>, Cone<S>, NarrowPhaseSolver>::collide;
+  collision_matrix[BV_FloatAABB][GEOM_CYLINDER] = &BVHShapeCollider<FloatAABB<S>, Cylinder<S>, NarrowPhaseSolver>::collide;
+  collision_matrix[BV_FloatAABB][GEOM_CONVEX] = &BVHShapeCollider<FloatAABB<S>, Convex<S>, NarrowPhaseSolver>::collide;
+  collision_matrix[BV_FloatAABB][GEOM_PLANE] = &BVHShapeCollider<FloatAABB<S>, Plane<S>, NarrowPhaseSolver>::collide;
+  collision_matrix[BV_FloatAABB][GEOM_HALFSPACE] = &BVHShapeCollider<FloatAABB<S>, Halfspace<S>, NarrowPhaseSolver>::collide;
+
+  collision_matrix[BV_QuantizedAABB][GEOM_BOX] = &QuantizedBVHShapeCollide<Box<S>, NarrowPhaseSolver>;
+  collision_matrix[BV_QuantizedAABB][GEOM_SPHERE] = &QuantizedBVHShapeCollide<Sphere<S>, NarrowPhaseSolver>;
+  collision_matrix[BV_QuantizedAABB][GEOM_ELLIPSOID] = &QuantizedBVHShapeCollide<Ellipsoid<S>, NarrowPhaseSolver>;
+  collision_matrix[BV_QuantizedAABB][GEOM_CAPSULE] = &QuantizedBVHShapeCollide<Capsule<S>, NarrowPhaseSolver>;
+  collision_matrix[BV_QuantizedAABB][GEOM_CONE] = &QuantizedBVHShapeCollide<Cone<S>, NarrowPhaseSolver>;
+  collision_matrix[BV_QuantizedAABB][GEOM_CYLINDER] = &QuantizedBVHShapeCollide<Cylinder<S>, NarrowPhaseSolver>;
+  collision_matrix[BV_QuantizedAABB][GEOM_CONVEX] = &QuantizedBVHShapeCollide<Convex<S>, NarrowPhaseSolver>;
+  collision_matrix[BV_QuantizedAABB][GEOM_PLANE] = &QuantizedBVHShapeCollide<Plane<S>, NarrowPhaseSolver>;
+  collision_matrix[BV_QuantizedAABB][GEOM_HALFSPACE] = &QuantizedBVHShapeCollide<Halfspace<S>, NarrowPhaseSolver>;
+
   collision_matrix[BV_AABB][BV_AABB] = &BVHCollide<AABB<S>, NarrowPhaseSolver>;
   collision_matrix[BV_OBB][BV_OBB] = &BVHCollide<OBB<S>, NarrowPhaseSolver>;
   collision_matrix[BV_RSS][BV_RSS] = &BVHCollide<RSS<S>, NarrowPhaseSolver>;
@@ -848,6 +953,8 @@ CollisionFunctionMatrix<NarrowPhaseSolver>::CollisionFunctionMatrix()
   collision_matrix[BV_KDOP24][BV_KDOP24] = &BVHCollide<KDOP<S, 24>, NarrowPhaseSolver>;
   collision_matrix[BV_kIOS][BV_kIOS] = &BVHCollide<kIOS<S>, NarrowPhaseSolver>;
   collision_matrix[BV_OBBRSS][BV_OBBRSS] = &BVHCollide<OBBRSS<S>, NarrowPhaseSolver>;
+  collision_matrix[BV_FloatAABB][BV_FloatAABB] = &BVHCollide<FloatAABB<S>, NarrowPhaseSolver>;
+  collision_matrix[BV_QuantizedAABB][BV_QuantizedAABB] = &QuantizedBVHCollide<NarrowPhaseSolver>;
 
 #if FCL_HAVE_OCTOMAP
   collision_matrix[GEOM_OCTREE][GEOM_BOX] = &OcTreeShapeCollide<Box<S>, NarrowPhaseSolver>;
@@ -51,16 +51,24 @@ extern template
 struct EPA<double>;
 
 //==============================================================================
-template <typename S>
-EPA<S>::SimplexList::SimplexList()
+template <typename S, typename MinkowskiDiffT>
+EPA<S, MinkowskiDiffT>::SimplexList::SimplexList()
   : root(nullptr), count(0)
 {
   // Do nothing
 }
 
 //==============================================================================
-template <typename S>
-void EPA<S>::SimplexList::append(typename EPA<S>::SimplexF* face)
+template <typename S, typename MinkowskiDiffT>
+void EPA<S, MinkowskiDiffT>::SimplexList::clear()
+{
+  root = nullptr;
+  count = 0;
+}
+
+//==============================================================================
+template <typename S, typename MinkowskiDiffT>
+void EPA<S, MinkowskiDiffT>::SimplexList::append(typename EPA<S, MinkowskiDiffT>::SimplexF* face)
 {
   face->l[0] = nullptr;
   face->l[1] = root;
@@ -70,8 +78,8 @@ void EPA<S>::SimplexList::append(typename EPA<S>::SimplexF* face)
 }
 
 //==============================================================================
-template <typename S>
-void EPA<S>::SimplexList::remove(typename EPA<S>::SimplexF* face)
+template <typename S, typename MinkowskiDiffT>
+void EPA<S, MinkowskiDiffT>::SimplexList::remove(typename EPA<S, MinkowskiDiffT>::SimplexF* face)
 {
   if(face->l[1]) face->l[1]->l[0] = face->l[0];
   if(face->l[0]) face->l[0]->l[1] = face->l[1];
@@ -80,52 +88,201 @@ void EPA<S>::SimplexList::remove(typename EPA<S>::SimplexF* face)
 }
 
 //==============================================================================
-template <typename S>
-void EPA<S>::bind(SimplexF* fa, size_t ea, SimplexF* fb, size_t eb)
+template <typename S, typename MinkowskiDiffT>
+EPA<S, MinkowskiDiffT>::SimplexHeap::SimplexHeap()
+  : faces(nullptr), appended(0)
+{
+  // Do nothing
+}
+
+//==============================================================================
+template <typename S, typename MinkowskiDiffT>
+void EPA<S, MinkowskiDiffT>::SimplexHeap::append(SimplexF* face)
+{
+  face->heap_index = faces->size();
+  face->heap_order = appended++;
+  faces->push_back(face);
+  siftUp(face->heap_index);
+}
+
+//==============================================================================
+template <typename S, typename MinkowskiDiffT>
+void EPA<S, MinkowskiDiffT>::SimplexHeap::remove(SimplexF* face)
+{
+  const size_t i = face->heap_index;
+  SimplexF* last = faces->back();
+  faces->pop_back();
+  if(last == face)
+    return;
+
+  (*faces)[i] = last;
+  last->heap_index = i;
+  siftUp(i);
+  siftDown(last->heap_index);
+}
+
+//==============================================================================
+template <typename S, typename MinkowskiDiffT>
+typename EPA<S, MinkowskiDiffT>::SimplexF*
+EPA<S, MinkowskiDiffT>::SimplexHeap::top() const
+{
+  return faces->front();
+}
+
+//==============================================================================
+template <typename S, typename MinkowskiDiffT>
+size_t EPA<S, MinkowskiDiffT>::SimplexHeap::size() const
+{
+  return faces->size();
+}
+
+//==============================================================================
+template <typename S, typename MinkowskiDiffT>
+void EPA<S, MinkowskiDiffT>::SimplexHeap::clear()
+{
+  faces->clear();
+  appended = 0;
+}
+
+//==============================================================================
+template <typename S, typename MinkowskiDiffT>
+bool EPA<S, MinkowskiDiffT>::SimplexHeap::closer(
+    const SimplexF* a, const SimplexF* b)
+{
+  const S sqda = a->d * a->d;
+  const S sqdb = b->d * b->d;
+  if(sqda != sqdb)
+    return sqda < sqdb;
+  return a->heap_order > b->heap_order;
+}
+
+//==============================================================================
+template <typename S, typename MinkowskiDiffT>
+void EPA<S, MinkowskiDiffT>::SimplexHeap::siftUp(size_t i)
+{
+  std::vector<SimplexF*>& heap = *faces;
+  SimplexF* face = heap[i];
+  while(i > 0)
+  {
+    const size_t parent = (i - 1) / 2;
+    if(!closer(face, heap[parent]))
+      break;
+    heap[i] = heap[parent];
+    heap[i]->heap_index = i;
+    i = parent;
+  }
+  heap[i] = face;
+  face->heap_index = i;
+}
+
+//==============================================================================
+template <typename S, typename MinkowskiDiffT>
+void EPA<S, MinkowskiDiffT>::SimplexHeap::siftDown(size_t i)
+{
+  std::vector<SimplexF*>& heap = *faces;
+  const size_t n = heap.size();
+  SimplexF* face = heap[i];
+  while(true)
+  {
+    size_t child = 2 * i + 1;
+    if(child >= n)
+      break;
+    if(child + 1 < n && closer(heap[child + 1], heap[child]))
+      ++child;
+    if(!closer(heap[child], face))
+      break;
+    heap[i] = heap[child];
+    heap[i]->heap_index = i;
+    i = child;
+  }
+  heap[i] = face;
+  face->heap_index = i;
+}
+
+//==============================================================================
+template <typename S, typename MinkowskiDiffT>
+typename EPA<S, MinkowskiDiffT>::Workspace&
+EPA<S, MinkowskiDiffT>::threadWorkspace()
+{
+  static thread_local Workspace workspace;
+  return workspace;
+}
+
+//==============================================================================
+template <typename S, typename MinkowskiDiffT>
+void EPA<S, MinkowskiDiffT>::bind(SimplexF* fa, size_t ea, SimplexF* fb, size_t eb)
 {
   fa->e[ea] = eb; fa->f[ea] = fb;
   fb->e[eb] = ea; fb->f[eb] = fa;
 }
 
 //==============================================================================
-template <typename S>
-EPA<S>::EPA(
+template <typename S, typename MinkowskiDiffT>
+EPA<S, MinkowskiDiffT>::EPA(
     unsigned int max_face_num_,
     unsigned int max_vertex_num_,
     unsigned int max_iterations_, S tolerance_)
   : max_face_num(max_face_num_),
     max_vertex_num(max_vertex_num_),
     max_iterations(max_iterations_),
-    tolerance(tolerance_)
+    tolerance(tolerance_),
+    workspace(nullptr),
+    nextfc(0)
 {
   initialize();
 }
 
 //==============================================================================
-template <typename S>
-EPA<S>::~EPA()
+template <typename S, typename MinkowskiDiffT>
+EPA<S, MinkowskiDiffT>::~EPA()
 {
-  delete [] sv_store;
-  delete [] fc_store;
+  workspace->in_use = false;
 }
 
 //==============================================================================
-template <typename S>
-void EPA<S>::initialize()
+template <typename S, typename MinkowskiDiffT>
+void EPA<S, MinkowskiDiffT>::initialize()
 {
-  sv_store = new SimplexV[max_vertex_num];
-  fc_store = new SimplexF[max_face_num];
+  Workspace& thread_workspace = threadWorkspace();
+  if(thread_workspace.in_use)
+  {
+    own_workspace.reset(new Workspace);
+    workspace = own_workspace.get();
+  }
+  else
+  {
+    workspace = &thread_workspace;
+  }
+  workspace->in_use = true;
+
+  while(workspace->vertices.size() < max_vertex_num)
+    workspace->vertices.emplace_back();
+  while(workspace->faces.size() < max_face_num)
+    workspace->faces.emplace_back();
+  workspace->heap.reserve(max_face_num);
+
+  hull.faces = &workspace->heap;
+  hull.clear();
+  stock.clear();
   status = Failed;
   normal = Vector3<S>(0, 0, 0);
   depth = 0;
   nextsv = 0;
-  for(size_t i = 0; i < max_face_num; ++i)
-    stock.append(&fc_store[max_face_num-i-1]);
+  nextfc = 0;
 }
 
 //==============================================================================
-template <typename S>
-bool EPA<S>::getEdgeDist(SimplexF* face, SimplexV* a, SimplexV* b, S& dist)
+template <typename S, typename MinkowskiDiffT>
+typename EPA<S, MinkowskiDiffT>::SimplexV* EPA<S, MinkowskiDiffT>::newVertex()
+{
+  if(nextsv == workspace->vertices.size())
+    workspace->vertices.emplace_back();
+  return &workspace->vertices[nextsv++];
+}
+
+//==============================================================================
+template <typename S, typename MinkowskiDiffT>
+bool EPA<S, MinkowskiDiffT>::getEdgeDist(SimplexF* face, SimplexV* a, SimplexV* b, S& dist)
 {
   Vector3<S> ba = b->w - a->w;
   Vector3<S> n_ab = ba.cross(face->n);
@@ -155,87 +312,79 @@ bool EPA<S>::getEdgeDist(SimplexF* face, SimplexV* a, SimplexV* b, S& dist)
 }
 
 //==============================================================================
-template <typename S>
-typename EPA<S>::SimplexF* EPA<S>::newFace(
-      typename GJK<S>::SimplexV* a,
-      typename GJK<S>::SimplexV* b,
-      typename GJK<S>::SimplexV* c,
+template <typename S, typename MinkowskiDiffT>
+typename EPA<S, MinkowskiDiffT>::SimplexF* EPA<S, MinkowskiDiffT>::newFace(
+      typename GJK<S, MinkowskiDiffT>::SimplexV* a,
+      typename GJK<S, MinkowskiDiffT>::SimplexV* b,
+      typename GJK<S, MinkowskiDiffT>::SimplexV* c,
       bool forced)
 {
+  SimplexF* face;
   if(stock.root)
   {
-    SimplexF* face = stock.root;
+    face = stock.root;
     stock.remove(face);
-    hull.append(face);
-    face->pass = 0;
-    face->c[0] = a;
-    face->c[1] = b;
-    face->c[2] = c;
-    face->n.noalias() = (b->w - a->w).cross(c->w - a->w);
-    S l = face->n.norm();
-
-    if(l > tolerance)
+  }
+  else
+  {
+    if(nextfc == workspace->faces.size())
+      workspace->faces.emplace_back();
+    face = &workspace->faces[nextfc++];
+  }
+
+  face->pass = 0;
+  face->c[0] = a;
+  face->c[1] = b;
+  face->c[2] = c;
+  face->n.noalias() = (b->w - a->w).cross(c->w - a->w);
+  S l = face->n.norm();
+
+  if(l > tolerance)
+  {
+    if(!(getEdgeDist(face, a, b, face->d) ||
+         getEdgeDist(face, b, c, face->d) ||
+         getEdgeDist(face, c, a, face->d)))
     {
-      if(!(getEdgeDist(face, a, b, face->d) ||
-           getEdgeDist(face, b, c, face->d) ||
-           getEdgeDist(face, c, a, face->d)))
-      {
-        face->d = a->w.dot(face->n) / l;
-      }
+      face->d = a->w.dot(face->n) / l;
+    }
 
-      face->n /= l;
-      if(forced || face->d >= -tolerance)
-        return face;
-      else
-        status = NonConvex;
+    face->n /= l;
+    if(forced || face->d >= -tolerance)
+    {
+      hull.append(face);
+      return face;
     }
     else
-      status = Degenerated;
-
-    hull.remove(face);
-    stock.append(face);
-    return nullptr;
+      status = NonConvex;
   }
+  else
+    status = Degenerated;
 
-  status = stock.root ? OutOfVertices : OutOfFaces;
+  stock.append(face);
   return nullptr;
 }
 
 //==============================================================================
 /** @brief Find the best polytope face to split */
-template <typename S>
-typename EPA<S>::SimplexF* EPA<S>::findBest()
+template <typename S, typename MinkowskiDiffT>
+typename EPA<S, MinkowskiDiffT>::SimplexF* EPA<S, MinkowskiDiffT>::findBest()
 {
-  SimplexF* minf = hull.root;
-  S mind = minf->d * minf->d;
-  for(SimplexF* f = minf->l[1]; f; f = f->l[1])
-  {
-    S sqd = f->d * f->d;
-    if(sqd < mind)
-    {
-      minf = f;
-      mind = sqd;
-    }
-  }
-  return minf;
+  return hull.top();
 }
 
 //==============================================================================
-template <typename S>
-typename EPA<S>::Status EPA<S>::evaluate(GJK<S>& gjk, const Vector3<S>& guess)
+template <typename S, typename MinkowskiDiffT>
+typename EPA<S, MinkowskiDiffT>::Status EPA<S, MinkowskiDiffT>::evaluate(GJK<S, MinkowskiDiffT>& gjk, const Vector3<S>& guess)
 {
-  typename GJK<S>::Simplex& simplex = *gjk.getSimplex();
+  typename GJK<S, MinkowskiDiffT>::Simplex& simplex = *gjk.getSimplex();
   if((simplex.rank > 1) && gjk.encloseOrigin())
   {
-    while(hull.root)
-    {
-      SimplexF* f = hull.root;
-      hull.remove(f);
-      stock.append(f);
-    }
+    hull.clear();
+    stock.clear();
 
     status = Valid;
     nextsv = 0;
+    nextfc = 0;
 
     if((simplex.c[0]->w - simplex.c[3]->w).dot((simplex.c[1]->w - simplex.c[3]->w).cross(simplex.c[2]->w - simplex.c[3]->w)) < 0)
     {
@@ -253,7 +402,7 @@ typename EPA<S>::Status EPA<S>::evaluate(GJK<S>& gjk, const Vector3<S>& guess)
                                newFace(simplex.c[2], simplex.c[1], simplex.c[3], true),
                                newFace(simplex.c[0], simplex.c[2], simplex.c[3], true) };
 
-    if(hull.count == 4)
+    if(hull.size() == 4)
     {
       SimplexF* best = findBest(); // find the best face (the face with the minimum distance to origin) to split
       SimplexF outer = *best;
@@ -271,44 +420,37 @@ typename EPA<S>::Status EPA<S>::evaluate(GJK<S>& gjk, const Vector3<S>& guess)
       status = Valid;
       for(; iterations < max_iterations; ++iterations)
       {
-        if(nextsv < max_vertex_num)
+        SimplexHorizon horizon;
+        SimplexV* w = newVertex();
+        bool valid = true;
+        best->pass = ++pass;
+        gjk.getSupport(best->n, *w);
+        S wdist = best->n.dot(w->w) - best->d;
+        if(wdist > tolerance)
         {
-          SimplexHorizon horizon;
-          SimplexV* w = &sv_store[nextsv++];
-          bool valid = true;
-          best->pass = ++pass;
-          gjk.getSupport(best->n, *w);
-          S wdist = best->n.dot(w->w) - best->d;
-          if(wdist > tolerance)
+          for(size_t j = 0; (j < 3) && valid; ++j)
+          {
+            valid &= expand(pass, w, best->f[j], best->e[j], horizon);
+          }
+
+
+          if(valid && horizon.nf >= 3)
           {
-            for(size_t j = 0; (j < 3) && valid; ++j)
-            {
-              valid &= expand(pass, w, best->f[j], best->e[j], horizon);
-            }
-
-
-            if(valid && horizon.nf >= 3)
-            {
-              // need to add the edge connectivity between first and last faces
-              bind(horizon.ff, 2, horizon.cf, 1);
-              hull.remove(best);
-              stock.append(best);
-              best = findBest();
-              outer = *best;
-            }
-            else
-            {
-              status = InvalidHull; break;
-            }
+            // need to add the edge connectivity between first and last faces
+            bind(horizon.ff, 2, horizon.cf, 1);
+            hull.remove(best);
+            stock.append(best);
+            best = findBest();
+            outer = *best;
           }
           else
           {
-            status = AccuracyReached; break;
+            status = InvalidHull; break;
           }
         }
         else
         {
-          status = OutOfVertices; break;
+          status = AccuracyReached; break;
         }
       }
 
@@ -345,8 +487,8 @@ typename EPA<S>::Status EPA<S>::evaluate(GJK<S>& gjk, const Vector3<S>& guess)
 
 //==============================================================================
 /** @brief the goal is to add a face connecting vertex w and face edge f[e] */
-template <typename S>
-bool EPA<S>::expand(size_t pass, SimplexV* w, SimplexF* f, size_t e, SimplexHorizon& horizon)
+template <typename S, typename MinkowskiDiffT>
+bool EPA<S, MinkowskiDiffT>::expand(size_t pass, SimplexV* w, SimplexF* f, size_t e, SimplexHorizon& horizon)
 {
   static const size_t nexti[] = {1, 2, 0};
   static const size_t previ[] = {2, 0, 1};
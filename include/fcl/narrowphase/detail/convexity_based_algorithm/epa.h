@@ -38,6 +38,10 @@
 #ifndef FCL_NARROWPHASE_DETAIL_EPA_H
 #define FCL_NARROWPHASE_DETAIL_EPA_H
 
+#include <deque>
+#include <memory>
+#include <vector>
+
 #include "fcl/narrowphase/detail/convexity_based_algorithm/gjk.h"
 
 namespace fcl
@@ -52,12 +56,13 @@ namespace detail
 //static const size_t EPA_MAX_ITERATIONS = 255;
 // TODO(JS): remove?
 
-/// @brief class for EPA algorithm
-template <typename S>
+/// @brief class for EPA algorithm, expanding the simplex of a GJK on the same
+/// Minkowski difference type
+template <typename S, typename MinkowskiDiffT = MinkowskiDiff<S>>
 struct FCL_EXPORT EPA
 {
 private:
-  using SimplexV = typename GJK<S>::SimplexV;
+  using SimplexV = typename GJK<S, MinkowskiDiffT>::SimplexV;
 
   struct SimplexF
   {
@@ -68,6 +73,8 @@ private:
     SimplexF* l[2]; // the pre and post faces in the list
     size_t e[3];
     size_t pass;
+    size_t heap_index; // the position of the face in the hull heap
+    size_t heap_order; // the order in which the face entered the hull heap
   };
 
   struct SimplexList
@@ -77,11 +84,58 @@ private:
 
     SimplexList();
 
+    void clear();
+
     void append(SimplexF* face);
 
     void remove(SimplexF* face);
   };
 
+  /// @brief The faces of the polytope hull, kept in a binary min-heap on their
+  /// squared distance to the origin. Among faces at the same distance, the one
+  /// most recently added is on top.
+  struct SimplexHeap
+  {
+    std::vector<SimplexF*>* faces;
+    size_t appended;
+
+    SimplexHeap();
+
+    void append(SimplexF* face);
+
+    /// @brief Remove an arbitrary face from the heap
+    void remove(SimplexF* face);
+
+    /// @brief The face nearest to the origin
+    SimplexF* top() const;
+
+    size_t size() const;
+
+    void clear();
+
+  private:
+    static bool closer(const SimplexF* a, const SimplexF* b);
+
+    void siftUp(size_t i);
+
+    void siftDown(size_t i);
+  };
+
+  /// @brief The storage of the polytope vertices and faces. It grows on demand
+  /// and is kept between queries, so that an EPA run in a thread that already
+  /// ran one does not allocate. The deques keep the element addresses stable
+  /// while they grow.
+  struct Workspace
+  {
+    std::deque<SimplexV> vertices;
+    std::deque<SimplexF> faces;
+    std::vector<SimplexF*> heap;
+    bool in_use = false;
+  };
+
+  /// @brief The workspace shared by the EPA instances of the calling thread
+  static Workspace& threadWorkspace();
+
   static void bind(SimplexF* fa, size_t ea, SimplexF* fb, size_t eb);
 
   struct SimplexHorizon
@@ -98,19 +152,30 @@ private:
   unsigned int max_iterations;
   S tolerance;
 
+  /// @brief The thread workspace, or own_workspace if another EPA instance of
+  /// the thread holds it
+  Workspace* workspace;
+  std::unique_ptr<Workspace> own_workspace;
+
+  /// @brief The number of faces taken from the workspace in this query
+  size_t nextfc;
+
+  SimplexV* newVertex();
+
 public:
 
   enum Status {Valid, Touching, Degenerated, NonConvex, InvalidHull, OutOfFaces, OutOfVertices, AccuracyReached, FallBack, Failed};
   
   Status status;
-  typename GJK<S>::Simplex result;
+  typename GJK<S, MinkowskiDiffT>::Simplex result;
   Vector3<S> normal;
   S depth;
-  SimplexV* sv_store;
-  SimplexF* fc_store;
   size_t nextsv;
-  SimplexList hull, stock;
+  SimplexHeap hull;
+  SimplexList stock;
 
+  /// @brief max_face_num_ and max_vertex_num_ are the initial capacity of the
+  /// polytope; it grows beyond them when a query needs more.
   EPA(
       unsigned int max_face_num_,
       unsigned int max_vertex_num_,
@@ -128,7 +193,7 @@ public:
   /// @brief Find the best polytope face to split
   SimplexF* findBest();
 
-  Status evaluate(GJK<S>& gjk, const Vector3<S>& guess);
+  Status evaluate(GJK<S, MinkowskiDiffT>& gjk, const Vector3<S>& guess);
 
   /// @brief the goal is to add a face connecting vertex w and face edge f[e] 
   bool expand(size_t pass, SimplexV* w, SimplexF* f, size_t e, SimplexHorizon& horizon);  
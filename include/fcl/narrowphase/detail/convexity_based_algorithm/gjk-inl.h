@@ -51,16 +51,16 @@ extern template
 struct GJK<double>;
 
 //==============================================================================
-template <typename S>
-GJK<S>::GJK(unsigned int max_iterations_, S tolerance_)
+template <typename S, typename MinkowskiDiffT>
+GJK<S, MinkowskiDiffT>::GJK(unsigned int max_iterations_, S tolerance_)
   : max_iterations(max_iterations_), tolerance(tolerance_)
 {
   initialize();
 }
 
 //==============================================================================
-template <typename S>
-void GJK<S>::initialize()
+template <typename S, typename MinkowskiDiffT>
+void GJK<S, MinkowskiDiffT>::initialize()
 {
   ray.setZero();
   nfree = 0;
@@ -71,15 +71,24 @@ void GJK<S>::initialize()
 }
 
 //==============================================================================
-template <typename S>
-Vector3<S> GJK<S>::getGuessFromSimplex() const
+template <typename S, typename MinkowskiDiffT>
+Vector3<S> GJK<S, MinkowskiDiffT>::getGuessFromSimplex() const
 {
   return ray;
 }
 
 //==============================================================================
-template <typename S>
-typename GJK<S>::Status GJK<S>::evaluate(const MinkowskiDiff<S>& shape_, const Vector3<S>& guess)
+template <typename S, typename MinkowskiDiffT>
+typename GJK<S, MinkowskiDiffT>::Status GJK<S, MinkowskiDiffT>::evaluate(const MinkowskiDiffT& shape_, const Vector3<S>& guess)
+{
+  return evaluate(shape_, guess, nullptr);
+}
+
+//==============================================================================
+template <typename S, typename MinkowskiDiffT>
+typename GJK<S, MinkowskiDiffT>::Status GJK<S, MinkowskiDiffT>::evaluate(
+    const MinkowskiDiffT& shape_, const Vector3<S>& guess,
+    GJKSimplexCache<S>* cache)
 {
   size_t iterations = 0;
   S alpha = 0;
@@ -99,12 +108,19 @@ typename GJK<S>::Status GJK<S>::evaluate(const MinkowskiDiff<S>& shape_, const V
   simplices[0].rank = 0;
   ray = guess;
 
-  appendVertex(simplices[0], (ray.squaredNorm() > 0) ? (-ray).eval() : Vector3<S>::UnitX());
-  simplices[0].p[0] = 1;
-  ray = simplices[0].c[0]->w;
-  lastw[0] = lastw[1] = lastw[2] = lastw[3] = ray; // cache previous support points, the new support point will compare with it to avoid too close support points
+  if(cache && !cache->empty() && warmStart(*cache, lastw))
+  {
+    clastw = simplices[current].rank - 1;
+  }
+  else
+  {
+    appendVertex(simplices[0], (ray.squaredNorm() > 0) ? (-ray).eval() : Vector3<S>::UnitX());
+    simplices[0].p[0] = 1;
+    ray = simplices[0].c[0]->w;
+    lastw[0] = lastw[1] = lastw[2] = lastw[3] = ray; // cache previous support points, the new support point will compare with it to avoid too close support points
+  }
 
-  do
+  while(status == Valid)
   {
     size_t next = 1 - current;
     Simplex& curr_simplex = simplices[current];
@@ -187,7 +203,7 @@ typename GJK<S>::Status GJK<S>::evaluate(const MinkowskiDiff<S>& shape_, const V
 
     status = ((++iterations) < max_iterations) ? status : Failed;
 
-  } while(status == Valid);
+  }
 
   simplex = &simplices[current];
   switch(status)
@@ -196,35 +212,115 @@ typename GJK<S>::Status GJK<S>::evaluate(const MinkowskiDiff<S>& shape_, const V
   case Inside: distance = 0; break;
   default: break;
   }
+
+  if(cache)
+  {
+    cache->rank = (status == Failed) ? 0 : static_cast<unsigned int>(simplex->rank);
+    for(size_t i = 0; i < cache->rank; ++i)
+      cache->directions[i] = simplex->c[i]->d;
+  }
+
   return status;
 }
 
 //==============================================================================
-template <typename S>
-void GJK<S>::getSupport(const Vector3<S>& d, SimplexV& sv) const
+template <typename S, typename MinkowskiDiffT>
+bool GJK<S, MinkowskiDiffT>::warmStart(
+    const GJKSimplexCache<S>& cache, Vector3<S>* lastw)
+{
+  Simplex& curr_simplex = simplices[0];
+  for(size_t i = 0; i < cache.rank; ++i)
+  {
+    appendVertex(curr_simplex, cache.directions[i]);
+
+    // the support points of the directions may have merged since the
+    // simplex was stored
+    const Vector3<S>& w = curr_simplex.c[curr_simplex.rank - 1]->w;
+    for(size_t j = 0; j + 1 < curr_simplex.rank; ++j)
+    {
+      if((w - curr_simplex.c[j]->w).squaredNorm() < tolerance)
+      {
+        removeVertex(curr_simplex);
+        break;
+      }
+    }
+  }
+
+  for(size_t i = 0; i < 4; ++i)
+    lastw[i] = curr_simplex.c[std::min(i, curr_simplex.rank - 1)]->w;
+
+  if(curr_simplex.rank == 1)
+  {
+    curr_simplex.p[0] = 1;
+    ray = curr_simplex.c[0]->w;
+    return true;
+  }
+
+  typename Project<S>::ProjectResult project_res;
+  switch(curr_simplex.rank)
+  {
+  case 2:
+    project_res = Project<S>::projectLineOrigin(curr_simplex.c[0]->w, curr_simplex.c[1]->w); break;
+  case 3:
+    project_res = Project<S>::projectTriangleOrigin(curr_simplex.c[0]->w, curr_simplex.c[1]->w, curr_simplex.c[2]->w); break;
+  case 4:
+    project_res = Project<S>::projectTetrahedraOrigin(curr_simplex.c[0]->w, curr_simplex.c[1]->w, curr_simplex.c[2]->w, curr_simplex.c[3]->w); break;
+  }
+
+  if(project_res.sqr_distance < 0)
+  {
+    while(curr_simplex.rank > 0)
+      removeVertex(curr_simplex);
+    return false;
+  }
+
+  // keep the sub-simplex nearest to the origin, as in the GJK iterations
+  Simplex& next_simplex = simplices[1];
+  next_simplex.rank = 0;
+  ray.setZero();
+  current = 1;
+  for(size_t i = 0; i < curr_simplex.rank; ++i)
+  {
+    if(project_res.encode & (1 << i))
+    {
+      next_simplex.c[next_simplex.rank] = curr_simplex.c[i];
+      next_simplex.p[next_simplex.rank++] = project_res.parameterization[i];
+      ray += curr_simplex.c[i]->w * project_res.parameterization[i];
+    }
+    else
+      free_v[nfree++] = curr_simplex.c[i];
+  }
+  if(project_res.encode == 15) status = Inside;
+
+  return true;
+}
+
+//==============================================================================
+template <typename S, typename MinkowskiDiffT>
+void GJK<S, MinkowskiDiffT>::getSupport(const Vector3<S>& d, SimplexV& sv) const
 {
   sv.d = d.normalized();
   sv.w = shape.support(sv.d);
 }
 
 //==============================================================================
-template <typename S>
-void GJK<S>::getSupport(const Vector3<S>& d, const Vector3<S>& v, SimplexV& sv) const
+template <typename S, typename MinkowskiDiffT>
+void GJK<S, MinkowskiDiffT>::getSupport(const Vector3<S>& d, const Vector3<S>& v, SimplexV& sv) const
 {
   sv.d = d.normalized();
   sv.w = shape.support(sv.d, v);
 }
 
 //==============================================================================
-template <typename S>
-void GJK<S>::removeVertex(Simplex& simplex)
+template <typename S, typename MinkowskiDiffT>
+void GJK<S, MinkowskiDiffT>::removeVertex(Simplex& simplex)
 {
   free_v[nfree++] = simplex.c[--simplex.rank];
 }
 
 //==============================================================================
-template <typename S>
-void GJK<S>::appendVertex(Simplex& simplex, const Vector3<S>& v)
+template <typename S, typename MinkowskiDiffT>
+void GJK<S, MinkowskiDiffT>::appendVertex(Simplex& simplex, const Vector3<S>& v)
 {
   simplex.p[simplex.rank] = 0; // initial weight 0
   simplex.c[simplex.rank] = free_v[--nfree]; // set the memory
@@ -232,8 +328,8 @@ void GJK<S>::appendVertex(Simplex& simplex, const Vector3<S>& v)
 }
 
 //==============================================================================
-template <typename S>
-bool GJK<S>::encloseOrigin()
+template <typename S, typename MinkowskiDiffT>
+bool GJK<S, MinkowskiDiffT>::encloseOrigin()
 {
   switch(simplex->rank)
   {
@@ -298,15 +394,15 @@ bool GJK<S>::encloseOrigin()
 }
 
 //==============================================================================
-template <typename S>
-typename GJK<S>::Simplex* GJK<S>::getSimplex() const
+template <typename S, typename MinkowskiDiffT>
+typename GJK<S, MinkowskiDiffT>::Simplex* GJK<S, MinkowskiDiffT>::getSimplex() const
 {
   return simplex;
 }
 
 //==============================================================================
-template <typename S>
-GJK<S>::Simplex::Simplex()
+template <typename S, typename MinkowskiDiffT>
+GJK<S, MinkowskiDiffT>::Simplex::Simplex()
   : rank(0)
 {
   // Do nothing
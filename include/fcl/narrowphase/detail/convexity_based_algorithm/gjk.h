@@ -39,6 +39,7 @@
 #define FCL_NARROWPHASE_DETAIL_GJK_H
 
 #include "fcl/common/types.h"
+#include "fcl/narrowphase/gjk_cache.h"
 #include "fcl/narrowphase/detail/convexity_based_algorithm/minkowski_diff.h"
 
 namespace fcl
@@ -47,8 +48,10 @@ namespace fcl
 namespace detail
 {
 
-/// @brief class for GJK algorithm
-template <typename S>
+/// @brief class for GJK algorithm. MinkowskiDiffT is the Minkowski difference
+/// the support points are taken from; MinkowskiDiff dispatches on the shape
+/// types at run time, ShapePairMinkowskiDiff resolves them at compile time.
+template <typename S, typename MinkowskiDiffT = MinkowskiDiff<S>>
 struct FCL_EXPORT GJK
 {
   struct SimplexV
@@ -73,7 +76,7 @@ struct FCL_EXPORT GJK
 
   enum Status {Valid, Inside, Failed};
 
-  MinkowskiDiff<S> shape;
+  MinkowskiDiffT shape;
   Vector3<S> ray;
   S distance;
   Simplex simplices[2];
@@ -83,7 +86,12 @@ struct FCL_EXPORT GJK
   void initialize();
 
   /// @brief GJK algorithm, given the initial value guess
-  Status evaluate(const MinkowskiDiff<S>& shape_, const Vector3<S>& guess);
+  Status evaluate(const MinkowskiDiffT& shape_, const Vector3<S>& guess);
+
+  /// @brief GJK algorithm, starting from the simplex stored in cache if any,
+  /// and from the guess otherwise. The final simplex is stored in cache.
+  Status evaluate(const MinkowskiDiffT& shape_, const Vector3<S>& guess,
+                  GJKSimplexCache<S>* cache);
 
   /// @brief apply the support function along a direction, the result is return in sv
   void getSupport(const Vector3<S>& d, SimplexV& sv) const;
@@ -107,6 +115,10 @@ struct FCL_EXPORT GJK
   Vector3<S> getGuessFromSimplex() const;
 
 private:
+  /// @brief set up simplices[current] and the ray from the simplex in cache;
+  /// returns false, with an empty simplex, if the simplex is degenerated
+  bool warmStart(const GJKSimplexCache<S>& cache, Vector3<S>* lastw);
+
   SimplexV store_v[4];
   SimplexV* free_v[4];
   size_t nfree;
@@ -40,10 +40,11 @@
 
 #include "fcl/narrowphase/detail/convexity_based_algorithm/gjk_libccd.h"
 
-#include <unordered_map>
-#include <unordered_set>
+#include <algorithm>
+#include <vector>
 
 #include "fcl/common/unused.h"
+#include "fcl/common/detail/block_pool.h"
 #include "fcl/common/warning.h"
 
 namespace fcl
@@ -173,6 +174,9 @@ template <typename S>
 struct ccd_convex_t : public ccd_obj_t
 {
   const Convex<S>* convex;
+
+  // The last support vertex, from which the next support query starts
+  mutable int support_vertex;
 };
 
 struct ccd_triangle_t : public ccd_obj_t
@@ -1066,6 +1070,45 @@ static bool isOutsidePolytopeFace(const ccd_pt_t* polytope,
   return ccdVec3Dot(&n, &r_VP) > 0;
 }
 
+/**
+ * A set of polytope features stored in a vector. The visible patch of an EPA
+ * expansion holds a handful of faces and edges, for which a linear search is
+ * cheaper than hashing; and unlike a node based set, clear() keeps the
+ * storage, so a set that is reused across expansions stops allocating once it
+ * has grown to the largest patch.
+ */
+template <typename T>
+class PolytopeFeatureSet {
+ public:
+  std::size_t count(T* feature) const {
+    return std::find(features_.begin(), features_.end(), feature) !=
+                   features_.end()
+               ? 1
+               : 0;
+  }
+
+  void insert(T* feature) {
+    if (count(feature) == 0) features_.push_back(feature);
+  }
+
+  void clear() { features_.clear(); }
+
+  bool empty() const { return features_.empty(); }
+
+  std::size_t size() const { return features_.size(); }
+
+  typename std::vector<T*>::const_iterator begin() const {
+    return features_.begin();
+  }
+
+  typename std::vector<T*>::const_iterator end() const {
+    return features_.end();
+  }
+
+ private:
+  std::vector<T*> features_;
+};
+
 #ifndef NDEBUG
 // The function ComputeVisiblePatchRecursiveSanityCheck() is only called in the
 // debug mode. In the release mode, this function is declared/defined but not
@@ -1080,11 +1123,10 @@ static bool isOutsidePolytopeFace(const ccd_pt_t* polytope,
  * For each face, if one of its edges is an internal edge, then the face is
  * visible.
  */
+template <typename EdgeSet, typename FaceSet>
 static bool ComputeVisiblePatchRecursiveSanityCheck(
-    const ccd_pt_t& polytope,
-    const std::unordered_set<ccd_pt_edge_t*>& border_edges,
-    const std::unordered_set<ccd_pt_face_t*>& visible_faces,
-    const std::unordered_set<ccd_pt_edge_t*>& internal_edges) {
+    const ccd_pt_t& polytope, const EdgeSet& border_edges,
+    const FaceSet& visible_faces, const EdgeSet& internal_edges) {
   ccd_pt_face_t* f;
   ccdListForEachEntry(&polytope.faces, f, ccd_pt_face_t, list) {
     bool has_edge_internal = false;
@@ -1126,12 +1168,11 @@ static bool ComputeVisiblePatchRecursiveSanityCheck(
  * function. It should not be called by any function other than
  * ComputeVisiblePatch().
  */
+template <typename EdgeSet, typename FaceSet>
 static void ComputeVisiblePatchRecursive(
     const ccd_pt_t& polytope, ccd_pt_face_t& f, int edge_index,
-    const ccd_vec3_t& query_point,
-    std::unordered_set<ccd_pt_edge_t*>* border_edges,
-    std::unordered_set<ccd_pt_face_t*>* visible_faces,
-    std::unordered_set<ccd_pt_edge_t*>* internal_edges) {
+    const ccd_vec3_t& query_point, EdgeSet* border_edges,
+    FaceSet* visible_faces, EdgeSet* internal_edges) {
   /*
   This function will be called recursively. It first checks if the face `g`
   neighouring face `f` along the common edge `f->edge[edge_index]` can be seen
@@ -1189,6 +1230,9 @@ static void ComputeVisiblePatchRecursive(
  * @param[out] visible_faces   The collection of patch faces.
  * @param[out] internal_edges  The collection of internal edges.
  *
+ * The collections are sets of feature pointers: std::unordered_set or
+ * PolytopeFeatureSet.
+ *
  * @pre The `polytope` is convex.
  * @pre The face `f` is visible from `query_point`.
  * @pre Output parameters are non-null.
@@ -1198,12 +1242,11 @@ static void ComputeVisiblePatchRecursive(
  * status to prevent redundant recalculation -- or by associating the face
  * normal with the face.
  */
+template <typename EdgeSet, typename FaceSet>
 static void ComputeVisiblePatch(
     const ccd_pt_t& polytope, ccd_pt_face_t& f,
-    const ccd_vec3_t& query_point,
-    std::unordered_set<ccd_pt_edge_t*>* border_edges,
-    std::unordered_set<ccd_pt_face_t*>* visible_faces,
-    std::unordered_set<ccd_pt_edge_t*>* internal_edges) {
+    const ccd_vec3_t& query_point, EdgeSet* border_edges,
+    FaceSet* visible_faces, EdgeSet* internal_edges) {
   assert(border_edges);
   assert(visible_faces);
   assert(internal_edges);
@@ -1287,9 +1330,14 @@ static int expandPolytope(ccd_pt_t *polytope, ccd_pt_el_t *el,
     }
   }
 
-  std::unordered_set<ccd_pt_face_t*> visible_faces;
-  std::unordered_set<ccd_pt_edge_t*> internal_edges;
-  std::unordered_set<ccd_pt_edge_t*> border_edges;
+  // The patch sets are kept per thread, so that the expansions of all EPA
+  // queries on a thread share their storage.
+  static thread_local PolytopeFeatureSet<ccd_pt_face_t> visible_faces;
+  static thread_local PolytopeFeatureSet<ccd_pt_edge_t> internal_edges;
+  static thread_local PolytopeFeatureSet<ccd_pt_edge_t> border_edges;
+  visible_faces.clear();
+  internal_edges.clear();
+  border_edges.clear();
   ComputeVisiblePatch(*polytope, *start_face, newv->v, &border_edges,
                       &visible_faces, &internal_edges);
 
@@ -1319,18 +1367,25 @@ static int expandPolytope(ccd_pt_t *polytope, ccd_pt_el_t *el,
   // Now add the new edges and faces, by connecting the new vertex with vertices
   // on border_edges. map_vertex_to_new_edge maps a vertex on the silhouette
   // edges to a new edge, with one end being the new vertex, and the other end
-  // being that vertex on the silhouette edges.
-  std::unordered_map<ccd_pt_vertex_t*, ccd_pt_edge_t*> map_vertex_to_new_edge;
+  // being that vertex on the silhouette edges. The silhouette is short, so
+  // the map is a vector searched linearly.
+  static thread_local std::vector<std::pair<ccd_pt_vertex_t*, ccd_pt_edge_t*>>
+      map_vertex_to_new_edge;
+  map_vertex_to_new_edge.clear();
   for (const auto& border_edge : border_edges) {
     ccd_pt_edge_t* e[2];  // The two new edges added by connecting new_vertex
                           // to the two vertices on border_edge.
     for (int i = 0; i < 2; ++i) {
-      auto it = map_vertex_to_new_edge.find(border_edge->vertex[i]);
+      ccd_pt_vertex_t* v = border_edge->vertex[i];
+      auto it = std::find_if(
+          map_vertex_to_new_edge.begin(), map_vertex_to_new_edge.end(),
+          [v](const std::pair<ccd_pt_vertex_t*, ccd_pt_edge_t*>& entry) {
+            return entry.first == v;
+          });
       if (it == map_vertex_to_new_edge.end()) {
         // This edge has not been added yet.
-        e[i] = ccdPtAddEdge(polytope, new_vertex, border_edge->vertex[i]);
-        map_vertex_to_new_edge.emplace_hint(it, border_edge->vertex[i],
-                                            e[i]);
+        e[i] = ccdPtAddEdge(polytope, new_vertex, v);
+        map_vertex_to_new_edge.emplace_back(v, e[i]);
       } else {
         e[i] = it->second;
       }
@@ -2095,6 +2150,7 @@ static void convexToGJK(const Convex<S>& s, const Transform3<S>& tf,
 {
   shapeToGJK(s, tf, conv);
   conv->convex = &s;
+  conv->support_vertex = 0;
 }
 
 /** Support functions */
@@ -2248,25 +2304,16 @@ static void supportConvex(const void* obj, const ccd_vec3_t* dir_,
                           ccd_vec3_t* v)
 {
   const auto* c = (const ccd_convex_t<S>*)obj;
-  ccd_vec3_t dir, p;
-  ccd_real_t maxdot, dot;
-  const auto& center = c->convex->getInteriorPoint();
+  ccd_vec3_t dir;
 
   ccdVec3Copy(&dir, dir_);
   ccdQuatRotVec(&dir, &c->rot_inv);
 
-  maxdot = -CCD_REAL_MAX;
-
-  for (const auto& vertex : c->convex->getVertices())
-  {
-    ccdVec3Set(&p, vertex[0] - center[0], vertex[1] - center[1],
-               vertex[2] - center[2]);
-    dot = ccdVec3Dot(&dir, &p);
-    if (dot > maxdot) {
-      ccdVec3Set(v, vertex[0], vertex[1], vertex[2]);
-      maxdot = dot;
-    }
-  }
+  c->support_vertex = c->convex->findExtremeVertex(
+      Vector3<S>(ccdVec3X(&dir), ccdVec3Y(&dir), ccdVec3Z(&dir)),
+      c->support_vertex);
+  const Vector3<S>& vertex = c->convex->getVertices()[c->support_vertex];
+  ccdVec3Set(v, vertex[0], vertex[1], vertex[2]);
 
   // transform support vertex
   ccdQuatRotVec(v, &c->rot);
@@ -2481,7 +2528,7 @@ template <typename S>
 void* GJKInitializer<S, Cylinder<S>>::createGJKObject(const Cylinder<S>& s,
                                                       const Transform3<S>& tf)
 {
-  ccd_cyl_t* o = new ccd_cyl_t;
+  ccd_cyl_t* o = newPooled<ccd_cyl_t>();
   cylToGJK(s, tf, o);
   return o;
 }
@@ -2490,7 +2537,7 @@ template <typename S>
 void GJKInitializer<S, Cylinder<S>>::deleteGJKObject(void* o_)
 {
   ccd_cyl_t* o = static_cast<ccd_cyl_t*>(o_);
-  delete o;
+  deletePooled(o);
 }
 
 template <typename S>
@@ -2509,7 +2556,7 @@ template <typename S>
 void* GJKInitializer<S, Sphere<S>>::createGJKObject(const Sphere<S>& s,
                                                     const Transform3<S>& tf)
 {
-  ccd_sphere_t* o = new ccd_sphere_t;
+  ccd_sphere_t* o = newPooled<ccd_sphere_t>();
   sphereToGJK(s, tf, o);
   return o;
 }
@@ -2518,7 +2565,7 @@ template <typename S>
 void GJKInitializer<S, Sphere<S>>::deleteGJKObject(void* o_)
 {
   ccd_sphere_t* o = static_cast<ccd_sphere_t*>(o_);
-  delete o;
+  deletePooled(o);
 }
 
 template <typename S>
@@ -2537,7 +2584,7 @@ template <typename S>
 void* GJKInitializer<S, Ellipsoid<S>>::createGJKObject(const Ellipsoid<S>& s,
                                                        const Transform3<S>& tf)
 {
-  ccd_ellipsoid_t* o = new ccd_ellipsoid_t;
+  ccd_ellipsoid_t* o = newPooled<ccd_ellipsoid_t>();
   ellipsoidToGJK(s, tf, o);
   return o;
 }
@@ -2546,7 +2593,7 @@ template <typename S>
 void GJKInitializer<S, Ellipsoid<S>>::deleteGJKObject(void* o_)
 {
   ccd_ellipsoid_t* o = static_cast<ccd_ellipsoid_t*>(o_);
-  delete o;
+  deletePooled(o);
 }
 
 template <typename S>
@@ -2565,7 +2612,7 @@ template <typename S>
 void* GJKInitializer<S, Box<S>>::createGJKObject(const Box<S>& s,
                                                  const Transform3<S>& tf)
 {
-  ccd_box_t* o = new ccd_box_t;
+  ccd_box_t* o = newPooled<ccd_box_t>();
   boxToGJK(s, tf, o);
   return o;
 }
@@ -2574,7 +2621,7 @@ template <typename S>
 void GJKInitializer<S, Box<S>>::deleteGJKObject(void* o_)
 {
   ccd_box_t* o = static_cast<ccd_box_t*>(o_);
-  delete o;
+  deletePooled(o);
 }
 
 template <typename S>
@@ -2593,7 +2640,7 @@ template <typename S>
 void* GJKInitializer<S, Capsule<S>>::createGJKObject(const Capsule<S>& s,
                                                      const Transform3<S>& tf)
 {
-  ccd_cap_t* o = new ccd_cap_t;
+  ccd_cap_t* o = newPooled<ccd_cap_t>();
   capToGJK(s, tf, o);
   return o;
 }
@@ -2602,7 +2649,7 @@ template <typename S>
 void GJKInitializer<S, Capsule<S>>::deleteGJKObject(void* o_)
 {
   ccd_cap_t* o = static_cast<ccd_cap_t*>(o_);
-  delete o;
+  deletePooled(o);
 }
 
 template <typename S>
@@ -2621,7 +2668,7 @@ template <typename S>
 void* GJKInitializer<S, Cone<S>>::createGJKObject(const Cone<S>& s,
                                                   const Transform3<S>& tf)
 {
-  ccd_cone_t* o = new ccd_cone_t;
+  ccd_cone_t* o = newPooled<ccd_cone_t>();
   coneToGJK(s, tf, o);
   return o;
 }
@@ -2630,7 +2677,7 @@ template <typename S>
 void GJKInitializer<S, Cone<S>>::deleteGJKObject(void* o_)
 {
   ccd_cone_t* o = static_cast<ccd_cone_t*>(o_);
-  delete o;
+  deletePooled(o);
 }
 
 template <typename S>
@@ -2649,7 +2696,7 @@ template <typename S>
 void* GJKInitializer<S, Convex<S>>::createGJKObject(const Convex<S>& s,
                                                     const Transform3<S>& tf)
 {
-  auto* o = new ccd_convex_t<S>;
+  auto* o = newPooled<ccd_convex_t<S>>();
   convexToGJK(s, tf, o);
   return o;
 }
@@ -2658,7 +2705,7 @@ template <typename S>
 void GJKInitializer<S, Convex<S>>::deleteGJKObject(void* o_)
 {
   auto* o = static_cast<ccd_convex_t<S>*>(o_);
-  delete o;
+  deletePooled(o);
 }
 
 inline GJKSupportFunction triGetSupportFunction()
@@ -2675,7 +2722,7 @@ template <typename S>
 void* triCreateGJKObject(const Vector3<S>& P1, const Vector3<S>& P2,
                          const Vector3<S>& P3)
 {
-  ccd_triangle_t* o = new ccd_triangle_t;
+  ccd_triangle_t* o = newPooled<ccd_triangle_t>();
   Vector3<S> center((P1[0] + P2[0] + P3[0]) / 3, (P1[1] + P2[1] + P3[1]) / 3,
       (P1[2] + P2[2] + P3[2]) / 3);
 
@@ -2694,7 +2741,7 @@ template <typename S>
 void* triCreateGJKObject(const Vector3<S>& P1, const Vector3<S>& P2,
                          const Vector3<S>& P3, const Transform3<S>& tf)
 {
-  ccd_triangle_t* o = new ccd_triangle_t;
+  ccd_triangle_t* o = newPooled<ccd_triangle_t>();
   Vector3<S> center((P1[0] + P2[0] + P3[0]) / 3, (P1[1] + P2[1] + P3[1]) / 3,
       (P1[2] + P2[2] + P3[2]) / 3);
 
@@ -2714,7 +2761,7 @@ void* triCreateGJKObject(const Vector3<S>& P1, const Vector3<S>& P2,
 inline void triDeleteGJKObject(void* o_)
 {
   ccd_triangle_t* o = static_cast<ccd_triangle_t*>(o_);
-  delete o;
+  deletePooled(o);
 }
 
 } // namespace detail
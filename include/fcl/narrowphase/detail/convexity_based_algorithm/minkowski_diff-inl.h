@@ -40,17 +40,6 @@
 
 #include "fcl/narrowphase/detail/convexity_based_algorithm/minkowski_diff.h"
 
-#include "fcl/geometry/shape/box.h"
-#include "fcl/geometry/shape/capsule.h"
-#include "fcl/geometry/shape/cone.h"
-#include "fcl/geometry/shape/convex.h"
-#include "fcl/geometry/shape/cylinder.h"
-#include "fcl/geometry/shape/ellipsoid.h"
-#include "fcl/geometry/shape/halfspace.h"
-#include "fcl/geometry/shape/plane.h"
-#include "fcl/geometry/shape/sphere.h"
-#include "fcl/geometry/shape/triangle_p.h"
-
 namespace fcl
 {
 
@@ -66,7 +55,8 @@ template <typename S, typename Derived>
 FCL_EXPORT
 Vector3<S> getSupport(
     const ShapeBase<S>* shape,
-    const Eigen::MatrixBase<Derived>& dir)
+    const Eigen::MatrixBase<Derived>& dir,
+    int* vertex_hint)
 {
   // Check the number of rows is 6 at compile time
   EIGEN_STATIC_ASSERT(
@@ -77,125 +67,22 @@ Vector3<S> getSupport(
   switch(shape->getNodeType())
   {
   case GEOM_TRIANGLE:
-    {
-      const auto* triangle = static_cast<const TriangleP<S>*>(shape);
-      S dota = dir.dot(triangle->a);
-      S dotb = dir.dot(triangle->b);
-      S dotc = dir.dot(triangle->c);
-      if(dota > dotb)
-      {
-        if(dotc > dota)
-          return triangle->c;
-        else
-          return triangle->a;
-      }
-      else
-      {
-        if(dotc > dotb)
-          return triangle->c;
-        else
-          return triangle->b;
-      }
-    }
-    break;
+    return getSupport(*static_cast<const TriangleP<S>*>(shape), dir);
   case GEOM_BOX:
-    {
-      const Box<S>* box = static_cast<const Box<S>*>(shape);
-      return Vector3<S>((dir[0]>0)?(box->side[0]/2):(-box->side[0]/2),
-                   (dir[1]>0)?(box->side[1]/2):(-box->side[1]/2),
-                   (dir[2]>0)?(box->side[2]/2):(-box->side[2]/2));
-    }
-    break;
+    return getSupport(*static_cast<const Box<S>*>(shape), dir);
   case GEOM_SPHERE:
-    {
-      const Sphere<S>* sphere = static_cast<const Sphere<S>*>(shape);
-      return dir * sphere->radius;
-    }
-    break;
+    return getSupport(*static_cast<const Sphere<S>*>(shape), dir);
   case GEOM_ELLIPSOID:
-    {
-      const Ellipsoid<S>* ellipsoid = static_cast<const Ellipsoid<S>*>(shape);
-
-      const S a2 = ellipsoid->radii[0] * ellipsoid->radii[0];
-      const S b2 = ellipsoid->radii[1] * ellipsoid->radii[1];
-      const S c2 = ellipsoid->radii[2] * ellipsoid->radii[2];
-
-      const Vector3<S> v(a2 * dir[0], b2 * dir[1], c2 * dir[2]);
-      const S d = std::sqrt(v.dot(dir));
-
-      return v / d;
-    }
-    break;
+    return getSupport(*static_cast<const Ellipsoid<S>*>(shape), dir);
   case GEOM_CAPSULE:
-    {
-      const Capsule<S>* capsule = static_cast<const Capsule<S>*>(shape);
-      S half_h = capsule->lz * 0.5;
-      Vector3<S> pos1(0, 0, half_h);
-      Vector3<S> pos2(0, 0, -half_h);
-      Vector3<S> v = dir * capsule->radius;
-      pos1 += v;
-      pos2 += v;
-      if(dir.dot(pos1) > dir.dot(pos2))
-        return pos1;
-      else return pos2;
-    }
-    break;
+    return getSupport(*static_cast<const Capsule<S>*>(shape), dir);
   case GEOM_CONE:
-    {
-      const Cone<S>* cone = static_cast<const Cone<S>*>(shape);
-      S zdist = dir[0] * dir[0] + dir[1] * dir[1];
-      S len = zdist + dir[2] * dir[2];
-      zdist = std::sqrt(zdist);
-      len = std::sqrt(len);
-      S half_h = cone->lz * 0.5;
-      S radius = cone->radius;
-
-      S sin_a = radius / std::sqrt(radius * radius + 4 * half_h * half_h);
-
-      if(dir[2] > len * sin_a)
-        return Vector3<S>(0, 0, half_h);
-      else if(zdist > 0)
-      {
-        S rad = radius / zdist;
-        return Vector3<S>(rad * dir[0], rad * dir[1], -half_h);
-      }
-      else
-        return Vector3<S>(0, 0, -half_h);
-    }
-    break;
+    return getSupport(*static_cast<const Cone<S>*>(shape), dir);
   case GEOM_CYLINDER:
-    {
-      const Cylinder<S>* cylinder = static_cast<const Cylinder<S>*>(shape);
-      S zdist = std::sqrt(dir[0] * dir[0] + dir[1] * dir[1]);
-      S half_h = cylinder->lz * 0.5;
-      if(zdist == 0.0)
-      {
-        return Vector3<S>(0, 0, (dir[2]>0)? half_h:-half_h);
-      }
-      else
-      {
-        S d = cylinder->radius / zdist;
-        return Vector3<S>(d * dir[0], d * dir[1], (dir[2]>0)?half_h:-half_h);
-      }
-    }
-    break;
+    return getSupport(*static_cast<const Cylinder<S>*>(shape), dir);
   case GEOM_CONVEX:
-    {
-      const Convex<S>* convex = static_cast<const Convex<S>*>(shape);
-      S maxdot = - std::numeric_limits<S>::max();
-      Vector3<S> bestv = Vector3<S>::Zero();
-      for(const auto& vertex : convex->getVertices())
-      {
-        S dot = dir.dot(vertex);
-        if(dot > maxdot)
-        {
-          bestv = vertex;
-          maxdot = dot;
-        }
-      }
-      return bestv;
-    }
-    break;
+    return getSupport(
+          *static_cast<const Convex<S>*>(shape), dir, vertex_hint);
   case GEOM_PLANE:
   break;
   default:
@@ -205,9 +92,163 @@ Vector3<S> getSupport(
   return Vector3<S>::Zero();
 }
 
+//==============================================================================
+template <typename S, typename Derived>
+Vector3<S> getSupport(
+    const TriangleP<S>& triangle,
+    const Eigen::MatrixBase<Derived>& dir,
+    int* /*vertex_hint*/)
+{
+  S dota = dir.dot(triangle.a);
+  S dotb = dir.dot(triangle.b);
+  S dotc = dir.dot(triangle.c);
+  if(dota > dotb)
+  {
+    if(dotc > dota)
+      return triangle.c;
+    else
+      return triangle.a;
+  }
+  else
+  {
+    if(dotc > dotb)
+      return triangle.c;
+    else
+      return triangle.b;
+  }
+}
+
+//==============================================================================
+template <typename S, typename Derived>
+Vector3<S> getSupport(
+    const Box<S>& box,
+    const Eigen::MatrixBase<Derived>& dir,
+    int* /*vertex_hint*/)
+{
+  return Vector3<S>((dir[0]>0)?(box.side[0]/2):(-box.side[0]/2),
+                    (dir[1]>0)?(box.side[1]/2):(-box.side[1]/2),
+                    (dir[2]>0)?(box.side[2]/2):(-box.side[2]/2));
+}
+
+//==============================================================================
+template <typename S, typename Derived>
+Vector3<S> getSupport(
+    const Sphere<S>& sphere,
+    const Eigen::MatrixBase<Derived>& dir,
+    int* /*vertex_hint*/)
+{
+  return dir * sphere.radius;
+}
+
+//==============================================================================
+template <typename S, typename Derived>
+Vector3<S> getSupport(
+    const Ellipsoid<S>& ellipsoid,
+    const Eigen::MatrixBase<Derived>& dir,
+    int* /*vertex_hint*/)
+{
+  const S a2 = ellipsoid.radii[0] * ellipsoid.radii[0];
+  const S b2 = ellipsoid.radii[1] * ellipsoid.radii[1];
+  const S c2 = ellipsoid.radii[2] * ellipsoid.radii[2];
+
+  const Vector3<S> v(a2 * dir[0], b2 * dir[1], c2 * dir[2]);
+  const S d = std::sqrt(v.dot(dir));
+
+  return v / d;
+}
+
+//==============================================================================
+template <typename S, typename Derived>
+Vector3<S> getSupport(
+    const Capsule<S>& capsule,
+    const Eigen::MatrixBase<Derived>& dir,
+    int* /*vertex_hint*/)
+{
+  S half_h = capsule.lz * 0.5;
+  Vector3<S> pos1(0, 0, half_h);
+  Vector3<S> pos2(0, 0, -half_h);
+  Vector3<S> v = dir * capsule.radius;
+  pos1 += v;
+  pos2 += v;
+  if(dir.dot(pos1) > dir.dot(pos2))
+    return pos1;
+  else return pos2;
+}
+
+//==============================================================================
+template <typename S, typename Derived>
+Vector3<S> getSupport(
+    const Cone<S>& cone,
+    const Eigen::MatrixBase<Derived>& dir,
+    int* /*vertex_hint*/)
+{
+  S zdist = dir[0] * dir[0] + dir[1] * dir[1];
+  S len = zdist + dir[2] * dir[2];
+  zdist = std::sqrt(zdist);
+  len = std::sqrt(len);
+  S half_h = cone.lz * 0.5;
+  S radius = cone.radius;
+
+  S sin_a = radius / std::sqrt(radius * radius + 4 * half_h * half_h);
+
+  if(dir[2] > len * sin_a)
+    return Vector3<S>(0, 0, half_h);
+  else if(zdist > 0)
+  {
+    S rad = radius / zdist;
+    return Vector3<S>(rad * dir[0], rad * dir[1], -half_h);
+  }
+  else
+    return Vector3<S>(0, 0, -half_h);
+}
+
+//==============================================================================
+template <typename S, typename Derived>
+Vector3<S> getSupport(
+    const Cylinder<S>& cylinder,
+    const Eigen::MatrixBase<Derived>& dir,
+    int* /*vertex_hint*/)
+{
+  S zdist = std::sqrt(dir[0] * dir[0] + dir[1] * dir[1]);
+  S half_h = cylinder.lz * 0.5;
+  if(zdist == 0.0)
+  {
+    return Vector3<S>(0, 0, (dir[2]>0)? half_h:-half_h);
+  }
+  else
+  {
+    S d = cylinder.radius / zdist;
+    return Vector3<S>(d * dir[0], d * dir[1], (dir[2]>0)?half_h:-half_h);
+  }
+}
+
+//==============================================================================
+template <typename S, typename Derived>
+Vector3<S> getSupport(
+    const Convex<S>& convex,
+    const Eigen::MatrixBase<Derived>& dir,
+    int* vertex_hint)
+{
+  int start = 0;
+  if(!vertex_hint) vertex_hint = &start;
+  *vertex_hint = convex.findExtremeVertex(dir, *vertex_hint);
+  return convex.getVertices()[*vertex_hint];
+}
+
+//==============================================================================
+template <typename S, typename Derived>
+Vector3<S> getSupport(
+    const ShapeBase<S>& /*shape*/,
+    const Eigen::MatrixBase<Derived>& /*dir*/,
+    int* /*vertex_hint*/)
+{
+  return Vector3<S>::Zero();
+}
+
 //==============================================================================
 template <typename S>
 MinkowskiDiff<S>::MinkowskiDiff()
+  : support_hints{0, 0}
 {
   // Do nothing
 }
@@ -216,14 +257,14 @@ MinkowskiDiff<S>::MinkowskiDiff()
 template <typename S>
 Vector3<S> MinkowskiDiff<S>::support0(const Vector3<S>& d) const
 {
-  return getSupport(shapes[0], d);
+  return getSupport(shapes[0], d, &support_hints[0]);
 }
 
 //==============================================================================
 template <typename S>
 Vector3<S> MinkowskiDiff<S>::support1(const Vector3<S>& d) const
 {
-  return toshape0 * getSupport(shapes[1], toshape1 * d);
+  return toshape0 * getSupport(shapes[1], toshape1 * d, &support_hints[1]);
 }
 
 //==============================================================================
@@ -248,9 +289,9 @@ template <typename S>
 Vector3<S> MinkowskiDiff<S>::support0(const Vector3<S>& d, const Vector3<S>& v) const
 {
   if(d.dot(v) <= 0)
-    return getSupport(shapes[0], d);
+    return getSupport(shapes[0], d, &support_hints[0]);
   else
-    return getSupport(shapes[0], d) + v;
+    return getSupport(shapes[0], d, &support_hints[0]) + v;
 }
 
 //==============================================================================
@@ -270,6 +311,79 @@ Vector3<S> MinkowskiDiff<S>::support(const Vector3<S>& d, const Vector3<S>& v, s
     return support0(d, v);
 }
 
+//==============================================================================
+template <typename S, typename Shape0, typename Shape1>
+ShapePairMinkowskiDiff<S, Shape0, Shape1>::ShapePairMinkowskiDiff()
+  : support_hints{0, 0}
+{
+  // Do nothing
+}
+
+//==============================================================================
+template <typename S, typename Shape0, typename Shape1>
+Vector3<S> ShapePairMinkowskiDiff<S, Shape0, Shape1>::support0(
+    const Vector3<S>& d) const
+{
+  return getSupport(*shape0, d, &support_hints[0]);
+}
+
+//==============================================================================
+template <typename S, typename Shape0, typename Shape1>
+Vector3<S> ShapePairMinkowskiDiff<S, Shape0, Shape1>::support1(
+    const Vector3<S>& d) const
+{
+  return toshape0 * getSupport(*shape1, toshape1 * d, &support_hints[1]);
+}
+
+//==============================================================================
+template <typename S, typename Shape0, typename Shape1>
+Vector3<S> ShapePairMinkowskiDiff<S, Shape0, Shape1>::support(
+    const Vector3<S>& d) const
+{
+  return support0(d) - support1(-d);
+}
+
+//==============================================================================
+template <typename S, typename Shape0, typename Shape1>
+Vector3<S> ShapePairMinkowskiDiff<S, Shape0, Shape1>::support(
+    const Vector3<S>& d, size_t index) const
+{
+  if(index)
+    return support1(d);
+  else
+    return support0(d);
+}
+
+//==============================================================================
+template <typename S, typename Shape0, typename Shape1>
+Vector3<S> ShapePairMinkowskiDiff<S, Shape0, Shape1>::support0(
+    const Vector3<S>& d, const Vector3<S>& v) const
+{
+  if(d.dot(v) <= 0)
+    return getSupport(*shape0, d, &support_hints[0]);
+  else
+    return getSupport(*shape0, d, &support_hints[0]) + v;
+}
+
+//==============================================================================
+template <typename S, typename Shape0, typename Shape1>
+Vector3<S> ShapePairMinkowskiDiff<S, Shape0, Shape1>::support(
+    const Vector3<S>& d, const Vector3<S>& v) const
+{
+  return support0(d, v) - support1(-d);
+}
+
+//==============================================================================
+template <typename S, typename Shape0, typename Shape1>
+Vector3<S> ShapePairMinkowskiDiff<S, Shape0, Shape1>::support(
+    const Vector3<S>& d, const Vector3<S>& v, size_t index) const
+{
+  if(index)
+    return support1(d);
+  else
+    return support0(d, v);
+}
+
 } // namespace detail
 } // namespace fcl
 
@@ -39,7 +39,16 @@
 #define FCL_NARROWPHASE_DETAIL_MINKOWSKIDIFF_H
 
 #include "fcl/math/detail/project.h"
-#include "fcl/geometry/shape/shape_base.h"
+#include "fcl/geometry/shape/box.h"
+#include "fcl/geometry/shape/capsule.h"
+#include "fcl/geometry/shape/cone.h"
+#include "fcl/geometry/shape/convex.h"
+#include "fcl/geometry/shape/cylinder.h"
+#include "fcl/geometry/shape/ellipsoid.h"
+#include "fcl/geometry/shape/halfspace.h"
+#include "fcl/geometry/shape/plane.h"
+#include "fcl/geometry/shape/sphere.h"
+#include "fcl/geometry/shape/triangle_p.h"
 
 namespace fcl
 {
@@ -47,11 +56,74 @@ namespace fcl
 namespace detail
 {
 
-/// @brief the support function for shape
+/// @brief the support function for shape. For a Convex, vertex_hint, if not
+/// nullptr, is the index of the vertex the search of the support vertex starts
+/// from, and is set to the index of the support vertex found.
 template <typename S, typename Derived>
 Vector3<S> getSupport(
     const ShapeBase<S>* shape,
-    const Eigen::MatrixBase<Derived>& dir);
+    const Eigen::MatrixBase<Derived>& dir,
+    int* vertex_hint = nullptr);
+
+/// @brief The support functions of the individual shapes, in the frame of the
+/// shape. They are what getSupport(const ShapeBase<S>*, ...) dispatches to,
+/// and are called directly where the shape type is known at compile time.
+/// vertex_hint is only used by Convex.
+template <typename S, typename Derived>
+Vector3<S> getSupport(
+    const TriangleP<S>& triangle,
+    const Eigen::MatrixBase<Derived>& dir,
+    int* vertex_hint = nullptr);
+
+template <typename S, typename Derived>
+Vector3<S> getSupport(
+    const Box<S>& box,
+    const Eigen::MatrixBase<Derived>& dir,
+    int* vertex_hint = nullptr);
+
+template <typename S, typename Derived>
+Vector3<S> getSupport(
+    const Sphere<S>& sphere,
+    const Eigen::MatrixBase<Derived>& dir,
+    int* vertex_hint = nullptr);
+
+template <typename S, typename Derived>
+Vector3<S> getSupport(
+    const Ellipsoid<S>& ellipsoid,
+    const Eigen::MatrixBase<Derived>& dir,
+    int* vertex_hint = nullptr);
+
+template <typename S, typename Derived>
+Vector3<S> getSupport(
+    const Capsule<S>& capsule,
+    const Eigen::MatrixBase<Derived>& dir,
+    int* vertex_hint = nullptr);
+
+template <typename S, typename Derived>
+Vector3<S> getSupport(
+    const Cone<S>& cone,
+    const Eigen::MatrixBase<Derived>& dir,
+    int* vertex_hint = nullptr);
+
+template <typename S, typename Derived>
+Vector3<S> getSupport(
+    const Cylinder<S>& cylinder,
+    const Eigen::MatrixBase<Derived>& dir,
+    int* vertex_hint = nullptr);
+
+template <typename S, typename Derived>
+Vector3<S> getSupport(
+    const Convex<S>& convex,
+    const Eigen::MatrixBase<Derived>& dir,
+    int* vertex_hint = nullptr);
+
+/// @brief The support of the shapes that have none (Plane and Halfspace),
+/// which is the origin
+template <typename S, typename Derived>
+Vector3<S> getSupport(
+    const ShapeBase<S>& shape,
+    const Eigen::MatrixBase<Derived>& dir,
+    int* vertex_hint = nullptr);
 
 /// @brief Minkowski difference class of two shapes
 template <typename S>
@@ -66,6 +138,10 @@ struct FCL_EXPORT MinkowskiDiff
   /// @brief transform from shape1 to shape0 
   Transform3<S> toshape0;
 
+  /// @brief support vertices of the last support queries on the two shapes,
+  /// from which the next queries start on Convex shapes
+  mutable int support_hints[2];
+
   MinkowskiDiff();
 
   /// @brief support function for shape0
@@ -95,6 +171,54 @@ struct FCL_EXPORT MinkowskiDiff
 using MinkowskiDifff = MinkowskiDiff<float>;
 using MinkowskiDiffd = MinkowskiDiff<double>;
 
+/// @brief Minkowski difference of two shapes whose types are known at compile
+/// time. It has the interface of MinkowskiDiff, but calls the support
+/// functions of Shape0 and Shape1 directly instead of dispatching on the node
+/// type, so that GJK and EPA instantiated on it inline them.
+template <typename S, typename Shape0, typename Shape1>
+struct ShapePairMinkowskiDiff
+{
+  /// @brief points to two shapes
+  const Shape0* shape0;
+
+  const Shape1* shape1;
+
+  /// @brief rotation from shape0 to shape1
+  Matrix3<S> toshape1;
+
+  /// @brief transform from shape1 to shape0
+  Transform3<S> toshape0;
+
+  /// @brief support vertices of the last support queries on the two shapes,
+  /// from which the next queries start on Convex shapes
+  mutable int support_hints[2];
+
+  ShapePairMinkowskiDiff();
+
+  /// @brief support function for shape0
+  Vector3<S> support0(const Vector3<S>& d) const;
+
+  /// @brief support function for shape1
+  Vector3<S> support1(const Vector3<S>& d) const;
+
+  /// @brief support function for the pair of shapes
+  Vector3<S> support(const Vector3<S>& d) const;
+
+  /// @brief support function for the d-th shape (d = 0 or 1)
+  Vector3<S> support(const Vector3<S>& d, size_t index) const;
+
+  /// @brief support function for translating shape0, which is translating at velocity v
+  Vector3<S> support0(const Vector3<S>& d, const Vector3<S>& v) const;
+
+  /// @brief support function for the pair of shapes, where shape0 is translating at velocity v
+  Vector3<S> support(const Vector3<S>& d, const Vector3<S>& v) const;
+
+  /// @brief support function for the d-th shape (d = 0 or 1), where shape0 is translating at velocity v
+  Vector3<S> support(const Vector3<S>& d, const Vector3<S>& v, size_t index) const;
+
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+};
+
 } // namespace detail
 } // namespace fcl
 
@@ -24,6 +24,8 @@
 #include "list.h"
 
 #ifdef __cplusplus
+#include "fcl/common/detail/block_pool.h"
+
 extern "C" {
 #endif /* __cplusplus */
 
@@ -101,8 +103,25 @@ struct _ccd_pt_t {
 typedef struct _ccd_pt_t ccd_pt_t;
 
 
-void ccdPtInit(ccd_pt_t *pt);
-void ccdPtDestroy(ccd_pt_t *pt);
+/**
+ * The vertices, edges and faces of all polytopes of a thread share one pool
+ * of blocks large enough for any of them. The EPA builds and tears down a
+ * polytope on every query, so once the pool has grown to the largest
+ * polytope seen, no query touches the heap. An element must be deleted on
+ * the thread that added it.
+ */
+#define CCD_PT_EL_SIZE \
+    (sizeof(ccd_pt_vertex_t) > sizeof(ccd_pt_edge_t) \
+        ? (sizeof(ccd_pt_vertex_t) > sizeof(ccd_pt_face_t) \
+            ? sizeof(ccd_pt_vertex_t) : sizeof(ccd_pt_face_t)) \
+        : (sizeof(ccd_pt_edge_t) > sizeof(ccd_pt_face_t) \
+            ? sizeof(ccd_pt_edge_t) : sizeof(ccd_pt_face_t)))
+
+_ccd_inline void *ccdPtAllocEl(void);
+_ccd_inline void ccdPtFreeEl(void *el);
+
+_ccd_inline void ccdPtInit(ccd_pt_t *pt);
+_ccd_inline void ccdPtDestroy(ccd_pt_t *pt);
 
 /**
  * Returns vertices surrounding given triangle face.
@@ -134,22 +153,23 @@ _ccd_inline void ccdPtEdgeFaces(const ccd_pt_edge_t *e,
 /**
  * Adds vertex to polytope and returns pointer to newly created vertex.
  */
-ccd_pt_vertex_t *ccdPtAddVertex(ccd_pt_t *pt, const ccd_support_t *v);
+_ccd_inline ccd_pt_vertex_t *ccdPtAddVertex(ccd_pt_t *pt,
+                                            const ccd_support_t *v);
 _ccd_inline ccd_pt_vertex_t *ccdPtAddVertexCoords(ccd_pt_t *pt,
                                                   ccd_real_t x, ccd_real_t y, ccd_real_t z);
 
 /**
  * Adds edge to polytope.
  */
-ccd_pt_edge_t *ccdPtAddEdge(ccd_pt_t *pt, ccd_pt_vertex_t *v1,
-                                          ccd_pt_vertex_t *v2);
+_ccd_inline ccd_pt_edge_t *ccdPtAddEdge(ccd_pt_t *pt, ccd_pt_vertex_t *v1,
+                                                      ccd_pt_vertex_t *v2);
 
 /**
  * Adds face to polytope.
  */
-ccd_pt_face_t *ccdPtAddFace(ccd_pt_t *pt, ccd_pt_edge_t *e1,
-                                          ccd_pt_edge_t *e2,
-                                          ccd_pt_edge_t *e3);
+_ccd_inline ccd_pt_face_t *ccdPtAddFace(ccd_pt_t *pt, ccd_pt_edge_t *e1,
+                                                      ccd_pt_edge_t *e2,
+                                                      ccd_pt_edge_t *e3);
 
 /**
  * Deletes vertex from polytope.
@@ -163,12 +183,12 @@ _ccd_inline int ccdPtDelFace(ccd_pt_t *pt, ccd_pt_face_t *);
 /**
  * Recompute distances from origin for all elements in pt.
  */
-void ccdPtRecomputeDistances(ccd_pt_t *pt);
+_ccd_inline void ccdPtRecomputeDistances(ccd_pt_t *pt);
 
 /**
  * Returns nearest element to origin.
  */
-ccd_pt_el_t *ccdPtNearest(ccd_pt_t *pt);
+_ccd_inline ccd_pt_el_t *ccdPtNearest(ccd_pt_t *pt);
 
 
 void ccdPtDumpSVT(ccd_pt_t *pt, const char *fn);
@@ -176,6 +196,216 @@ void ccdPtDumpSVT2(ccd_pt_t *pt, FILE *);
 
 
 /**** INLINES ****/
+_ccd_inline void *ccdPtAllocEl(void)
+{
+    return fcl::detail::threadLocalBlockPool(CCD_PT_EL_SIZE).allocate();
+}
+
+_ccd_inline void ccdPtFreeEl(void *el)
+{
+    fcl::detail::threadLocalBlockPool(CCD_PT_EL_SIZE).release(el);
+}
+
+_ccd_inline void _ccdPtNearestUpdate(ccd_pt_t *pt, ccd_pt_el_t *el)
+{
+    if (ccdEq(pt->nearest_dist, el->dist)){
+        if (el->type < pt->nearest_type){
+            pt->nearest = el;
+            pt->nearest_dist = el->dist;
+            pt->nearest_type = el->type;
+        }
+    }else if (el->dist < pt->nearest_dist){
+        pt->nearest = el;
+        pt->nearest_dist = el->dist;
+        pt->nearest_type = el->type;
+    }
+}
+
+_ccd_inline void _ccdPtNearestRenew(ccd_pt_t *pt)
+{
+    ccd_pt_vertex_t *v;
+    ccd_pt_edge_t *e;
+    ccd_pt_face_t *f;
+
+    pt->nearest_dist = CCD_REAL_MAX;
+    pt->nearest_type = 3;
+    pt->nearest = NULL;
+
+    ccdListForEachEntry(&pt->vertices, v, ccd_pt_vertex_t, list){
+        _ccdPtNearestUpdate(pt, (ccd_pt_el_t *)v);
+    }
+
+    ccdListForEachEntry(&pt->edges, e, ccd_pt_edge_t, list){
+        _ccdPtNearestUpdate(pt, (ccd_pt_el_t *)e);
+    }
+
+    ccdListForEachEntry(&pt->faces, f, ccd_pt_face_t, list){
+        _ccdPtNearestUpdate(pt, (ccd_pt_el_t *)f);
+    }
+}
+
+_ccd_inline void ccdPtInit(ccd_pt_t *pt)
+{
+    ccdListInit(&pt->vertices);
+    ccdListInit(&pt->edges);
+    ccdListInit(&pt->faces);
+
+    pt->nearest = NULL;
+    pt->nearest_dist = CCD_REAL_MAX;
+    pt->nearest_type = 0;
+}
+
+_ccd_inline void ccdPtDestroy(ccd_pt_t *pt)
+{
+    ccd_pt_face_t *f, *f2;
+    ccd_pt_edge_t *e, *e2;
+    ccd_pt_vertex_t *v, *v2;
+
+    // first delete all faces
+    ccdListForEachEntrySafe(&pt->faces, f, ccd_pt_face_t, f2, ccd_pt_face_t, list){
+        ccdPtDelFace(pt, f);
+    }
+
+    // delete all edges
+    ccdListForEachEntrySafe(&pt->edges, e, ccd_pt_edge_t, e2, ccd_pt_edge_t, list){
+        ccdPtDelEdge(pt, e);
+    }
+
+    // delete all vertices
+    ccdListForEachEntrySafe(&pt->vertices, v, ccd_pt_vertex_t, v2, ccd_pt_vertex_t, list){
+        ccdPtDelVertex(pt, v);
+    }
+}
+
+_ccd_inline ccd_pt_vertex_t *ccdPtAddVertex(ccd_pt_t *pt,
+                                            const ccd_support_t *v)
+{
+    ccd_pt_vertex_t *vert;
+
+    vert = (ccd_pt_vertex_t *)ccdPtAllocEl();
+    vert->type = CCD_PT_VERTEX;
+    ccdSupportCopy(&vert->v, v);
+
+    vert->dist = ccdVec3Len2(&vert->v.v);
+    ccdVec3Copy(&vert->witness, &vert->v.v);
+
+    ccdListInit(&vert->edges);
+
+    // add vertex to list
+    ccdListAppend(&pt->vertices, &vert->list);
+
+    // update position in .nearest array
+    _ccdPtNearestUpdate(pt, (ccd_pt_el_t *)vert);
+
+    return vert;
+}
+
+_ccd_inline ccd_pt_edge_t *ccdPtAddEdge(ccd_pt_t *pt, ccd_pt_vertex_t *v1,
+                                                      ccd_pt_vertex_t *v2)
+{
+    const ccd_vec3_t *a, *b;
+    ccd_pt_edge_t *edge;
+
+    edge = (ccd_pt_edge_t *)ccdPtAllocEl();
+    edge->type = CCD_PT_EDGE;
+    edge->vertex[0] = v1;
+    edge->vertex[1] = v2;
+    edge->faces[0] = edge->faces[1] = NULL;
+
+    a = &edge->vertex[0]->v.v;
+    b = &edge->vertex[1]->v.v;
+    edge->dist = ccdVec3PointSegmentDist2(ccd_vec3_origin, a, b, &edge->witness);
+
+    ccdListAppend(&edge->vertex[0]->edges, &edge->vertex_list[0]);
+    ccdListAppend(&edge->vertex[1]->edges, &edge->vertex_list[1]);
+
+    ccdListAppend(&pt->edges, &edge->list);
+
+    // update position in .nearest array
+    _ccdPtNearestUpdate(pt, (ccd_pt_el_t *)edge);
+
+    return edge;
+}
+
+_ccd_inline ccd_pt_face_t *ccdPtAddFace(ccd_pt_t *pt, ccd_pt_edge_t *e1,
+                                                      ccd_pt_edge_t *e2,
+                                                      ccd_pt_edge_t *e3)
+{
+    const ccd_vec3_t *a, *b, *c;
+    ccd_pt_face_t *face;
+    ccd_pt_edge_t *e;
+    size_t i;
+
+    face = (ccd_pt_face_t *)ccdPtAllocEl();
+    face->type = CCD_PT_FACE;
+    face->edge[0] = e1;
+    face->edge[1] = e2;
+    face->edge[2] = e3;
+
+    // obtain triplet of vertices
+    a = &face->edge[0]->vertex[0]->v.v;
+    b = &face->edge[0]->vertex[1]->v.v;
+    e = face->edge[1];
+    if (e->vertex[0] != face->edge[0]->vertex[0]
+            && e->vertex[0] != face->edge[0]->vertex[1]){
+        c = &e->vertex[0]->v.v;
+    }else{
+        c = &e->vertex[1]->v.v;
+    }
+    face->dist = ccdVec3PointTriDist2(ccd_vec3_origin, a, b, c, &face->witness);
+
+    for (i = 0; i < 3; i++){
+        if (face->edge[i]->faces[0] == NULL){
+            face->edge[i]->faces[0] = face;
+        }else{
+            face->edge[i]->faces[1] = face;
+        }
+    }
+
+    ccdListAppend(&pt->faces, &face->list);
+
+    // update position in .nearest array
+    _ccdPtNearestUpdate(pt, (ccd_pt_el_t *)face);
+
+    return face;
+}
+
+_ccd_inline void ccdPtRecomputeDistances(ccd_pt_t *pt)
+{
+    ccd_pt_vertex_t *v;
+    ccd_pt_edge_t *e;
+    ccd_pt_face_t *f;
+    const ccd_vec3_t *a, *b, *c;
+    ccd_real_t dist;
+
+    ccdListForEachEntry(&pt->vertices, v, ccd_pt_vertex_t, list){
+        dist = ccdVec3Len2(&v->v.v);
+        v->dist = dist;
+        ccdVec3Copy(&v->witness, &v->v.v);
+    }
+
+    ccdListForEachEntry(&pt->edges, e, ccd_pt_edge_t, list){
+        a = &e->vertex[0]->v.v;
+        b = &e->vertex[1]->v.v;
+        dist = ccdVec3PointSegmentDist2(ccd_vec3_origin, a, b, &e->witness);
+        e->dist = dist;
+    }
+
+    ccdListForEachEntry(&pt->faces, f, ccd_pt_face_t, list){
+        ccdPtFaceVec3(f, (ccd_vec3_t **)&a, (ccd_vec3_t **)&b, (ccd_vec3_t **)&c);
+        dist = ccdVec3PointTriDist2(ccd_vec3_origin, a, b, c, &f->witness);
+        f->dist = dist;
+    }
+}
+
+_ccd_inline ccd_pt_el_t *ccdPtNearest(ccd_pt_t *pt)
+{
+    if (!pt->nearest){
+        _ccdPtNearestRenew(pt);
+    }
+    return pt->nearest;
+}
+
 _ccd_inline ccd_pt_vertex_t *ccdPtAddVertexCoords(ccd_pt_t *pt,
                                                   ccd_real_t x, ccd_real_t y, ccd_real_t z)
 {
@@ -197,7 +427,7 @@ _ccd_inline int ccdPtDelVertex(ccd_pt_t *pt, ccd_pt_vertex_t *v)
         pt->nearest = NULL;
     }
 
-    free(v);
+    ccdPtFreeEl(v);
     return 0;
 }
 
@@ -219,7 +449,7 @@ _ccd_inline int ccdPtDelEdge(ccd_pt_t *pt, ccd_pt_edge_t *e)
         pt->nearest = NULL;
     }
 
-    free(e);
+    ccdPtFreeEl(e);
     return 0;
 }
 
@@ -244,7 +474,7 @@ _ccd_inline int ccdPtDelFace(ccd_pt_t *pt, ccd_pt_face_t *f)
         pt->nearest = NULL;
     }
 
-    free(f);
+    ccdPtFreeEl(f);
     return 0;
 }
 
@@ -50,6 +50,7 @@
 #include "fcl/narrowphase/detail/traversal/collision_node.h"
 #include "fcl/narrowphase/detail/gjk_solver_indep.h"
 #include "fcl/narrowphase/detail/gjk_solver_libccd.h"
+#include "fcl/narrowphase/detail/traversal/scoped_query_statistics.h"
 
 #include "fcl/narrowphase/detail/traversal/distance/bvh_distance_traversal_node.h"
 #include "fcl/narrowphase/detail/traversal/distance/bvh_shape_distance_traversal_node.h"
@@ -58,6 +59,7 @@
 #include "fcl/narrowphase/detail/traversal/distance/mesh_conservative_advancement_traversal_node.h"
 #include "fcl/narrowphase/detail/traversal/distance/mesh_shape_distance_traversal_node.h"
 #include "fcl/narrowphase/detail/traversal/distance/mesh_shape_conservative_advancement_traversal_node.h"
+#include "fcl/narrowphase/detail/traversal/distance/quantized_mesh_shape_distance_traversal_node.h"
 #include "fcl/narrowphase/detail/traversal/distance/shape_bvh_distance_traversal_node.h"
 #include "fcl/narrowphase/detail/traversal/distance/shape_distance_traversal_node.h"
 #include "fcl/narrowphase/detail/traversal/distance/shape_conservative_advancement_traversal_node.h"
@@ -101,6 +103,7 @@ typename Shape::S ShapeOcTreeDistance(
   OcTreeSolver<NarrowPhaseSolver> otsolver(nsolver);
 
   initialize(node, *obj1, tf1, *obj2, tf2, &otsolver, request, result);
+  ScopedQueryStatistics<ShapeOcTreeDistanceTraversalNode<Shape, NarrowPhaseSolver>> statistics(node);
   distance(&node);
 
   return result.min_distance;
@@ -125,6 +128,7 @@ typename Shape::S OcTreeShapeDistance(
   OcTreeSolver<NarrowPhaseSolver> otsolver(nsolver);
 
   initialize(node, *obj1, tf1, *obj2, tf2, &otsolver, request, result);
+  ScopedQueryStatistics<OcTreeShapeDistanceTraversalNode<Shape, NarrowPhaseSolver>> statistics(node);
   distance(&node);
 
   return result.min_distance;
@@ -149,6 +153,7 @@ typename NarrowPhaseSolver::S OcTreeDistance(
   OcTreeSolver<NarrowPhaseSolver> otsolver(nsolver);
 
   initialize(node, *obj1, tf1, *obj2, tf2, &otsolver, request, result);
+  ScopedQueryStatistics<OcTreeDistanceTraversalNode<NarrowPhaseSolver>> statistics(node);
   distance(&node);
 
   return result.min_distance;
@@ -173,6 +178,7 @@ typename BV::S BVHOcTreeDistance(
   OcTreeSolver<NarrowPhaseSolver> otsolver(nsolver);
 
   initialize(node, *obj1, tf1, *obj2, tf2, &otsolver, request, result);
+  ScopedQueryStatistics<MeshOcTreeDistanceTraversalNode<BV, NarrowPhaseSolver>> statistics(node);
   distance(&node);
 
   return result.min_distance;
@@ -197,6 +203,7 @@ typename BV::S OcTreeBVHDistance(
   OcTreeSolver<NarrowPhaseSolver> otsolver(nsolver);
 
   initialize(node, *obj1, tf1, *obj2, tf2, &otsolver, request, result);
+  ScopedQueryStatistics<OcTreeMeshDistanceTraversalNode<BV, NarrowPhaseSolver>> statistics(node);
   distance(&node);
 
   return result.min_distance;
@@ -219,8 +226,15 @@ typename Shape1::S ShapeShapeDistance(
   const Shape1* obj1 = static_cast<const Shape1*>(o1);
   const Shape2* obj2 = static_cast<const Shape2*>(o2);
 
+  if(request.gjk_cache)
+    nsolver->setCachedSimplex(&request.gjk_cache->get(o1, o2));
+
   initialize(node, *obj1, tf1, *obj2, tf2, nsolver, request, result);
-  distance(&node);
+  ScopedQueryStatistics<ShapeDistanceTraversalNode<Shape1, Shape2, NarrowPhaseSolver>> statistics(node);
+  distanceStatic(&node);
+
+  if(request.gjk_cache)
+    nsolver->setCachedSimplex(nullptr);
 
   return result.min_distance;
 }
@@ -246,8 +260,9 @@ struct BVHShapeDistancer
     Transform3<S> tf1_tmp = tf1;
     const Shape* obj2 = static_cast<const Shape*>(o2);
 
-    initialize(node, *obj1_tmp, tf1_tmp, *obj2, tf2, nsolver, request, result);
-    ::fcl::distance(&node);
+    initialize(node, *obj1_tmp, tf1_tmp, *obj2, tf2, nsolver, request, result, request.query_cache != nullptr);
+    ScopedQueryStatistics<MeshShapeDistanceTraversalNode<BV, Shape, NarrowPhaseSolver>> statistics(node);
+    distanceCached(&node, request.query_cache, o1, o2, request.best_first_queue_size);
 
     delete obj1_tmp;
     return result.min_distance;
@@ -271,7 +286,8 @@ typename Shape::S orientedBVHShapeDistance(
   const Shape* obj2 = static_cast<const Shape*>(o2);
 
   initialize(node, *obj1, tf1, *obj2, tf2, nsolver, request, result);
-  distance(&node);
+  ScopedQueryStatistics<OrientedMeshShapeDistanceTraversalNode> statistics(node);
+  distanceCached(&node, request.query_cache, o1, o2, request.best_first_queue_size);
 
   return result.min_distance;
 }
@@ -360,8 +376,14 @@ struct BVHDistanceImpl
     BVHModel<BV>* obj2_tmp = new BVHModel<BV>(*obj2);
     Transform3<S> tf2_tmp = tf2;
 
-    initialize(node, *obj1_tmp, tf1_tmp, *obj2_tmp, tf2_tmp, request, result);
-    distance(&node);
+    // The front of a query cache indexes the trees of the models, so they are
+    // refitted in the world frame instead of rebuilt
+    initialize(node, *obj1_tmp, tf1_tmp, *obj2_tmp, tf2_tmp, request, result, request.query_cache != nullptr);
+    ScopedQueryStatistics<MeshDistanceTraversalNode<BV>> statistics(node);
+    if(request.num_threads != 1 && !request.query_cache)
+      distanceParallel(&node, request.num_threads);
+    else
+      distanceCached(&node, request.query_cache, o1, o2, request.best_first_queue_size);
     delete obj1_tmp;
     delete obj2_tmp;
 
@@ -398,7 +420,11 @@ typename BV::S orientedMeshDistance(
   const BVHModel<BV>* obj2 = static_cast<const BVHModel<BV>* >(o2);
 
   initialize(node, *obj1, tf1, *obj2, tf2, request, result);
-  distance(&node);
+  ScopedQueryStatistics<OrientedMeshDistanceTraversalNode> statistics(node);
+  if(request.num_threads != 1 && !request.query_cache)
+    distanceParallel(&node, request.num_threads);
+  else
+    distanceCached(&node, request.query_cache, o1, o2, request.best_first_queue_size);
 
   return result.min_distance;
 }
@@ -473,6 +499,32 @@ typename BV::S BVHDistance(
   return BVHDistance<BV>(o1, tf1, o2, tf2, request, result);
 }
 
+//==============================================================================
+template <typename Shape, typename NarrowPhaseSolver>
+typename Shape::S QuantizedBVHShapeDistance(
+    const CollisionGeometry<typename Shape::S>* o1,
+    const Transform3<typename Shape::S>& tf1,
+    const CollisionGeometry<typename Shape::S>* o2,
+    const Transform3<typename Shape::S>& tf2,
+    const NarrowPhaseSolver* nsolver,
+    const DistanceRequest<typename Shape::S>& request,
+    DistanceResult<typename Shape::S>& result)
+{
+  using S = typename Shape::S;
+
+  if(request.isSatisfied(result)) return result.min_distance;
+
+  QuantizedMeshShapeDistanceTraversalNode<Shape, NarrowPhaseSolver> node;
+  const QuantizedBVHModel<S>* obj1 = static_cast<const QuantizedBVHModel<S>* >(o1);
+  const Shape* obj2 = static_cast<const Shape*>(o2);
+
+  initialize(node, *obj1, tf1, *obj2, tf2, nsolver, request, result);
+  ScopedQueryStatistics<QuantizedMeshShapeDistanceTraversalNode<Shape, NarrowPhaseSolver>> statistics(node);
+  fcl::detail::distance(&node);
+
+  return result.min_distance;
+}
+
 template <typename NarrowPhaseSolver>
 DistanceFunctionMatrix<NarrowPhaseSolver>::DistanceFunctionMatrix()
 {
@@ -571,8 +623,6 @@ DistanceFunctionMatrix<NarrowPhaseSolver>::DistanceFunctionMatrix()
   distance_matrix[GEOM_HALFSPACE][GEOM_PLANE] = &ShapeShapeDistance<Halfspace<S>, Plane<S>, NarrowPhaseSolver>;
   distance_matrix[GEOM_HALFSPACE][GEOM_HALFSPACE] = &ShapeShapeDistance<Halfspace<S>, Halfspace<S>, NarrowPhaseSolver>;
 
-  /* AABB distance not implemented */
-  /*
   distance_matrix[BV_AABB][GEOM_BOX] = &BVHShapeDistancer<AABB<S>, Box<S>, NarrowPhaseSolver>::distance;
   distance_matrix[BV_AABB][GEOM_SPHERE] = &BVHShapeDistancer<AABB<S>, Sphere<S>, NarrowPhaseSolver>::distance;
   distance_matrix[BV_AABB][GEOM_ELLIPSOID] = &BVHShapeDistancer<AABB<S>, Ellipsoid<S>, NarrowPhaseSolver>::distance;
@@ -592,7 +642,6 @@ DistanceFunctionMatrix<NarrowPhaseSolver>::DistanceFunctionMatrix()
   distance_matrix[BV_OBB][GEOM_CONVEX] = &BVHShapeDistancer<OBB<S>, Convex<S>, NarrowPhaseSolver>::distance;
   distance_matrix[BV_OBB][GEOM_PLANE] = &BVHShapeDistancer<OBB<S>, Plane<S>, NarrowPhaseSolver>::distance;
   distance_matrix[BV_OBB][GEOM_HALFSPACE] = &BVHShapeDistancer<OBB<S>, Halfspace<S>, NarrowPhaseSolver>::distance;
-  */
 
   distance_matrix[BV_RSS][GEOM_BOX] = &BVHShapeDistancer<RSS<S>, Box<S>, NarrowPhaseSolver>::distance;
   distance_matrix[BV_RSS][GEOM_SPHERE] = &BVHShapeDistancer<RSS<S>, Sphere<S>, NarrowPhaseSolver>::distance;
@@ -604,8 +653,6 @@ DistanceFunctionMatrix<NarrowPhaseSolver>::DistanceFunctionMatrix()
   distance_matrix[BV_RSS][GEOM_PLANE] = &BVHShapeDistancer<RSS<S>, Plane<S>, NarrowPhaseSolver>::distance;
   distance_matrix[BV_RSS][GEOM_HALFSPACE] = &BVHShapeDistancer<RSS<S>, Halfspace<S>, NarrowPhaseSolver>::distance;
 
-  /* KDOPd distance not implemented */
-  /*
   distance_matrix[BV_KDOP16][GEOM_BOX] = &BVHShapeDistancer<KDOP<S, 16>, Box<S>, NarrowPhaseSolver>::distance;
   distance_matrix[BV_KDOP16][GEOM_SPHERE] = &BVHShapeDistancer<KDOP<S, 16>, Sphere<S>, NarrowPhaseSolver>::distance;
   distance_matrix[BV_KDOP16][GEOM_ELLIPSOID] = &BVHShapeDistancer<KDOP<S, 16>, Ellipsoid<S>, NarrowPhaseSolver>::distance;
@@ -635,7 +682,6 @@ DistanceFunctionMatrix<NarrowPhaseSolver>::DistanceFunctionMatrix()
   distance_matrix[BV_KDOP24][GEOM_CONVEX] = &BVHShapeDistancer<KDOP<S, 24>, Convex<S>, NarrowPhaseSolver>::distance;
   distance_matrix[BV_KDOP24][GEOM_PLANE] = &BVHShapeDistancer<KDOP<S, 24>, Plane<S>, NarrowPhaseSolver>::distance;
   distance_matrix[BV_KDOP24][GEOM_HALFSPACE] = &BVHShapeDistancer<KDOP<S, 24>, Halfspace<S>, NarrowPhaseSolver>::distance;
-  */
 
   distance_matrix[BV_kIOS][GEOM_BOX] = &BVHShapeDistancer<kIOS<S>, Box<S>, NarrowPhaseSolver>::distance;
   distance_matrix[BV_kIOS][GEOM_SPHERE] = &BVHShapeDistancer<kIOS<S>, Sphere<S>, NarrowPhaseSolver>::distance;
@@ -657,10 +703,25 @@ DistanceFunctionMatrix<NarrowPhaseSolver>::DistanceFunctionMatrix()
   distance_matrix[BV_OBBRSS][GEOM_PLANE] = &BVHShapeDistancer<OBBRSS<S>, Plane<S>, NarrowPhaseSolver>::distance;
   distance_matrix[BV_OBBRSS][GEOM_HALFSPACE] = &BVHShapeDistancer<OBBRSS<S>, Halfspace<S>, NarrowPhaseSolver>::distance;
 
+  distance_matrix[BV_QuantizedAABB][GEOM_BOX] = &QuantizedBVHShapeDistance<Box<S>, NarrowPhaseSolver>;
+  distance_matrix[BV_QuantizedAABB][GEOM_SPHERE] = &QuantizedBVHShapeDistance<Sphere<S>, NarrowPhaseSolver>;
+  distance_matrix[BV_QuantizedAABB][GEOM_ELLIPSOID] = &QuantizedBVHShapeDistance<Ellipsoid<S>, NarrowPhaseSolver>;
+  distance_matrix[BV_QuantizedAABB][GEOM_CAPSULE] = &QuantizedBVHShapeDistance<Capsule<S>, NarrowPhaseSolver>;
+  distance_matrix[BV_QuantizedAABB][GEOM_CONE] = &QuantizedBVHShapeDistance<Cone<S>, NarrowPhaseSolver>;
+  distance_matrix[BV_QuantizedAABB][GEOM_CYLINDER] = &QuantizedBVHShapeDistance<Cylinder<S>, NarrowPhaseSolver>;
+  distance_matrix[BV_QuantizedAABB][GEOM_CONVEX] = &QuantizedBVHShapeDistance<Convex<S>, NarrowPhaseSolver>;
+  distance_matrix[BV_QuantizedAABB][GEOM_PLANE] = &QuantizedBVHShapeDistance<Plane<S>, NarrowPhaseSolver>;
+  distance_matrix[BV_QuantizedAABB][GEOM_HALFSPACE] = &QuantizedBVHShapeDistance<Halfspace<S>, NarrowPhaseSolver>;
+
   distance_matrix[BV_AABB][BV_AABB] = &BVHDistance<AABB<S>, NarrowPhaseSolver>;
+  distance_matrix[BV_OBB][BV_OBB] = &BVHDistance<OBB<S>, NarrowPhaseSolver>;
   distance_matrix[BV_RSS][BV_RSS] = &BVHDistance<RSS<S>, NarrowPhaseSolver>;
   distance_matrix[BV_kIOS][BV_kIOS] = &BVHDistance<kIOS<S>, NarrowPhaseSolver>;
   distance_matrix[BV_OBBRSS][BV_OBBRSS] = &BVHDistance<OBBRSS<S>, NarrowPhaseSolver>;
+  distance_matrix[BV_FloatAABB][BV_FloatAABB] = &BVHDistance<FloatAABB<S>, NarrowPhaseSolver>;
+  distance_matrix[BV_KDOP16][BV_KDOP16] = &BVHDistance<KDOP<S, 16>, NarrowPhaseSolver>;
+  distance_matrix[BV_KDOP18][BV_KDOP18] = &BVHDistance<KDOP<S, 18>, NarrowPhaseSolver>;
+  distance_matrix[BV_KDOP24][BV_KDOP24] = &BVHDistance<KDOP<S, 24>, NarrowPhaseSolver>;
 
 #if FCL_HAVE_OCTOMAP
   distance_matrix[GEOM_OCTREE][GEOM_BOX] = &OcTreeShapeDistance<Box<S>, NarrowPhaseSolver>;
@@ -128,7 +128,7 @@ struct ShapeIntersectIndepImpl
     shape.toshape0 = tf1.inverse(Eigen::Isometry) * tf2;
 
     detail::GJK<S> gjk(gjkSolver.gjk_max_iterations, gjkSolver.gjk_tolerance);
-    typename detail::GJK<S>::Status gjk_status = gjk.evaluate(shape, -guess);
+    typename detail::GJK<S>::Status gjk_status = gjk.evaluate(shape, -guess, gjkSolver.cached_simplex);
     if(gjkSolver.enable_cached_guess) gjkSolver.cached_guess = gjk.getGuessFromSimplex();
 
     switch(gjk_status)
@@ -371,7 +371,7 @@ struct ShapeTriangleIntersectIndepImpl
     shape.toshape0 = tf.inverse(Eigen::Isometry);
 
     detail::GJK<S> gjk(gjkSolver.gjk_max_iterations, gjkSolver.gjk_tolerance);
-    typename detail::GJK<S>::Status gjk_status = gjk.evaluate(shape, -guess);
+    typename detail::GJK<S>::Status gjk_status = gjk.evaluate(shape, -guess, gjkSolver.cached_simplex);
     if(gjkSolver.enable_cached_guess) gjkSolver.cached_guess = gjk.getGuessFromSimplex();
 
     switch(gjk_status)
@@ -468,7 +468,7 @@ struct ShapeTransformedTriangleIntersectIndepImpl
     shape.toshape0 = tf1.inverse(Eigen::Isometry) * tf2;
 
     detail::GJK<S> gjk(gjkSolver.gjk_max_iterations, gjkSolver.gjk_tolerance);
-    typename detail::GJK<S>::Status gjk_status = gjk.evaluate(shape, -guess);
+    typename detail::GJK<S>::Status gjk_status = gjk.evaluate(shape, -guess, gjkSolver.cached_simplex);
     if(gjkSolver.enable_cached_guess) gjkSolver.cached_guess = gjk.getGuessFromSimplex();
 
     switch(gjk_status)
@@ -609,7 +609,7 @@ struct ShapeDistanceIndepImpl
     shape.toshape0 = tf1.inverse(Eigen::Isometry) * tf2;
 
     detail::GJK<S> gjk(gjkSolver.gjk_max_iterations, gjkSolver.gjk_tolerance);
-    typename detail::GJK<S>::Status gjk_status = gjk.evaluate(shape, -guess);
+    typename detail::GJK<S>::Status gjk_status = gjk.evaluate(shape, -guess, gjkSolver.cached_simplex);
     if(gjkSolver.enable_cached_guess) gjkSolver.cached_guess = gjk.getGuessFromSimplex();
 
     if(gjk_status == detail::GJK<S>::Valid)
@@ -867,7 +867,7 @@ struct ShapeTriangleDistanceIndepImpl
     shape.toshape0 = tf.inverse(Eigen::Isometry);
 
     detail::GJK<S> gjk(gjkSolver.gjk_max_iterations, gjkSolver.gjk_tolerance);
-    typename detail::GJK<S>::Status gjk_status = gjk.evaluate(shape, -guess);
+    typename detail::GJK<S>::Status gjk_status = gjk.evaluate(shape, -guess, gjkSolver.cached_simplex);
     if(gjkSolver.enable_cached_guess) gjkSolver.cached_guess = gjk.getGuessFromSimplex();
 
     if(gjk_status == detail::GJK<S>::Valid)
@@ -958,7 +958,7 @@ struct ShapeTransformedTriangleDistanceIndepImpl
     shape.toshape0 = tf1.inverse(Eigen::Isometry) * tf2;
 
     detail::GJK<S> gjk(gjkSolver.gjk_max_iterations, gjkSolver.gjk_tolerance);
-    typename detail::GJK<S>::Status gjk_status = gjk.evaluate(shape, -guess);
+    typename detail::GJK<S>::Status gjk_status = gjk.evaluate(shape, -guess, gjkSolver.cached_simplex);
     if(gjkSolver.enable_cached_guess) gjkSolver.cached_guess = gjk.getGuessFromSimplex();
 
     if(gjk_status == detail::GJK<S>::Valid)
@@ -1036,6 +1036,7 @@ GJKSolver_indep<S>::GJKSolver_indep()
   epa_tolerance = constants<S>::gjk_default_tolerance();
   enable_cached_guess = false;
   cached_guess = Vector3<S>(1, 0, 0);
+  cached_simplex = nullptr;
 }
 
 //==============================================================================
@@ -1059,6 +1060,13 @@ Vector3<S> GJKSolver_indep<S>::getCachedGuess() const
   return cached_guess;
 }
 
+//==============================================================================
+template <typename S>
+void GJKSolver_indep<S>::setCachedSimplex(GJKSimplexCache<S>* cache) const
+{
+  cached_simplex = cache;
+}
+
 } // namespace detail
 } // namespace fcl
 
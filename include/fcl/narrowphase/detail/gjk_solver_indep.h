@@ -40,6 +40,7 @@
 
 #include "fcl/common/types.h"
 #include "fcl/narrowphase/contact_point.h"
+#include "fcl/narrowphase/gjk_cache.h"
 
 namespace fcl
 {
@@ -156,10 +157,17 @@ struct FCL_EXPORT GJKSolver_indep
 
   Vector3<S> getCachedGuess() const;
 
-  /// @brief maximum number of simplex face used in EPA algorithm
+  /// @brief Set the simplex cache the GJK runs of the next queries start from
+  /// and store their final simplex in; nullptr, the default, to start them
+  /// from the guess
+  void setCachedSimplex(GJKSimplexCache<S>* cache) const;
+
+  /// @brief initial number of simplex faces reserved for the EPA algorithm;
+  /// the polytope grows beyond it when needed
   unsigned int epa_max_face_num;
 
-  /// @brief maximum number of simplex vertex used in EPA algorithm
+  /// @brief initial number of simplex vertices reserved for the EPA algorithm;
+  /// the polytope grows beyond it when needed
   unsigned int epa_max_vertex_num;
 
   /// @brief maximum number of iterations used for EPA iterations
@@ -179,6 +187,9 @@ struct FCL_EXPORT GJKSolver_indep
 
   /// @brief smart guess
   mutable Vector3<S> cached_guess;
+
+  /// @brief simplex cache of the GJK runs, if not nullptr
+  mutable GJKSimplexCache<S>* cached_simplex;
 };
 
 using GJKSolver_indepf = GJKSolver_indep<float>;
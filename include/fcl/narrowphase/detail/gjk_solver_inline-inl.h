@@ -0,0 +1,561 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FCL_NARROWPHASE_GJKSOLVERINLINE_INL_H
+#define FCL_NARROWPHASE_GJKSOLVERINLINE_INL_H
+
+#include "fcl/narrowphase/detail/gjk_solver_inline.h"
+
+#include "fcl/geometry/shape/triangle_p.h"
+
+#include "fcl/narrowphase/detail/convexity_based_algorithm/gjk.h"
+#include "fcl/narrowphase/detail/convexity_based_algorithm/epa.h"
+#include "fcl/narrowphase/detail/convexity_based_algorithm/minkowski_diff.h"
+
+namespace fcl
+{
+
+namespace detail
+{
+
+//==============================================================================
+/// @brief Sets up the Minkowski difference of s1 and s2, in the frame of s1
+template <typename S, typename Shape1, typename Shape2>
+void initShapePairMinkowskiDiff(
+    ShapePairMinkowskiDiff<S, Shape1, Shape2>& shape,
+    const Shape1& s1,
+    const Transform3<S>& tf1,
+    const Shape2& s2,
+    const Transform3<S>& tf2)
+{
+  shape.shape0 = &s1;
+  shape.shape1 = &s2;
+  shape.toshape1.noalias() = tf2.linear().transpose() * tf1.linear();
+  shape.toshape0 = tf1.inverse(Eigen::Isometry) * tf2;
+}
+
+//==============================================================================
+/// @brief Runs GJK on the Minkowski difference and, if the shapes intersect,
+/// EPA. Returns whether the penetration was found; w0 is then the deepest
+/// point of shape0, and normal and depth the EPA normal and depth, all in the
+/// frame of shape0.
+template <typename S, typename MinkowskiDiffT>
+bool gjkInlinePenetration(
+    const GJKSolver_inline<S>& gjkSolver,
+    const MinkowskiDiffT& shape,
+    Vector3<S>& w0,
+    Vector3<S>& normal,
+    S& depth)
+{
+  Vector3<S> guess(1, 0, 0);
+  if(gjkSolver.enable_cached_guess) guess = gjkSolver.cached_guess;
+
+  using GJKType = detail::GJK<S, MinkowskiDiffT>;
+  using EPAType = detail::EPA<S, MinkowskiDiffT>;
+
+  GJKType gjk(gjkSolver.gjk_max_iterations, gjkSolver.gjk_tolerance);
+  typename GJKType::Status gjk_status = gjk.evaluate(shape, -guess, gjkSolver.cached_simplex);
+  if(gjkSolver.enable_cached_guess) gjkSolver.cached_guess = gjk.getGuessFromSimplex();
+
+  if(gjk_status != GJKType::Inside)
+    return false;
+
+  EPAType epa(gjkSolver.epa_max_face_num, gjkSolver.epa_max_vertex_num, gjkSolver.epa_max_iterations, gjkSolver.epa_tolerance);
+  typename EPAType::Status epa_status = epa.evaluate(gjk, -guess);
+  if(epa_status == EPAType::Failed)
+    return false;
+
+  w0.setZero();
+  for(size_t i = 0; i < epa.result.rank; ++i)
+  {
+    w0.noalias() += shape.support(epa.result.c[i]->d, 0) * epa.result.p[i];
+  }
+  normal = epa.normal;
+  depth = epa.depth;
+  return true;
+}
+
+//==============================================================================
+/// @brief Runs GJK on the Minkowski difference. Returns whether it converged
+/// to a separating simplex; w0 and w1 are then the closest points of shape0
+/// and shape1, in the frame of shape0.
+template <typename S, typename MinkowskiDiffT>
+bool gjkInlineDistance(
+    const GJKSolver_inline<S>& gjkSolver,
+    const MinkowskiDiffT& shape,
+    Vector3<S>& w0,
+    Vector3<S>& w1)
+{
+  Vector3<S> guess(1, 0, 0);
+  if(gjkSolver.enable_cached_guess) guess = gjkSolver.cached_guess;
+
+  using GJKType = detail::GJK<S, MinkowskiDiffT>;
+
+  GJKType gjk(gjkSolver.gjk_max_iterations, gjkSolver.gjk_tolerance);
+  typename GJKType::Status gjk_status = gjk.evaluate(shape, -guess, gjkSolver.cached_simplex);
+  if(gjkSolver.enable_cached_guess) gjkSolver.cached_guess = gjk.getGuessFromSimplex();
+
+  if(gjk_status != GJKType::Valid)
+    return false;
+
+  w0.setZero();
+  w1.setZero();
+  for(size_t i = 0; i < gjk.getSimplex()->rank; ++i)
+  {
+    S p = gjk.getSimplex()->p[i];
+    w0.noalias() += shape.support(gjk.getSimplex()->c[i]->d, 0) * p;
+    w1.noalias() += shape.support(-gjk.getSimplex()->c[i]->d, 1) * p;
+  }
+  return true;
+}
+
+//==============================================================================
+template<typename S, typename Shape1, typename Shape2>
+struct ShapeIntersectInlineImpl
+{
+  static bool run(
+      const GJKSolver_inline<S>& gjkSolver,
+      const Shape1& s1,
+      const Transform3<S>& tf1,
+      const Shape2& s2,
+      const Transform3<S>& tf2,
+      std::vector<ContactPoint<S>>* contacts)
+  {
+    detail::ShapePairMinkowskiDiff<S, Shape1, Shape2> shape;
+    initShapePairMinkowskiDiff(shape, s1, tf1, s2, tf2);
+
+    Vector3<S> w0;
+    Vector3<S> normal;
+    S depth;
+    if(!gjkInlinePenetration(gjkSolver, shape, w0, normal, depth))
+      return false;
+
+    if(contacts)
+    {
+      Vector3<S> point = tf1 * (w0 - normal*(depth *0.5));
+      contacts->emplace_back(normal, point, -depth);
+    }
+    return true;
+  }
+};
+
+//==============================================================================
+template<typename S>
+template<typename Shape1, typename Shape2>
+bool GJKSolver_inline<S>::shapeIntersect(
+    const Shape1& s1,
+    const Transform3<S>& tf1,
+    const Shape2& s2,
+    const Transform3<S>& tf2,
+    std::vector<ContactPoint<S>>* contacts) const
+{
+  return ShapeIntersectInlineImpl<S, Shape1, Shape2>::run(
+        *this, s1, tf1, s2, tf2, contacts);
+}
+
+// The pairs GJKSolver_indep solves without its GJK algorithm (see the tables
+// in gjk_solver_indep-inl.h) are forwarded to the same algorithms.
+
+#define FCL_GJK_INLINE_SHAPE_SHAPE_INTERSECT_REG(SHAPE1, SHAPE2)\
+  template <typename S>\
+  struct ShapeIntersectInlineImpl<S, SHAPE1<S>, SHAPE2<S>>\
+    : ShapeIntersectIndepImpl<S, SHAPE1<S>, SHAPE2<S>> {};
+
+#define FCL_GJK_INLINE_SHAPE_INTERSECT(SHAPE)\
+  FCL_GJK_INLINE_SHAPE_SHAPE_INTERSECT_REG(SHAPE, SHAPE)
+
+#define FCL_GJK_INLINE_SHAPE_SHAPE_INTERSECT(SHAPE1, SHAPE2)\
+  FCL_GJK_INLINE_SHAPE_SHAPE_INTERSECT_REG(SHAPE1, SHAPE2)\
+  FCL_GJK_INLINE_SHAPE_SHAPE_INTERSECT_REG(SHAPE2, SHAPE1)
+
+FCL_GJK_INLINE_SHAPE_INTERSECT(Sphere)
+FCL_GJK_INLINE_SHAPE_INTERSECT(Box)
+
+FCL_GJK_INLINE_SHAPE_SHAPE_INTERSECT(Sphere, Capsule)
+FCL_GJK_INLINE_SHAPE_SHAPE_INTERSECT(Sphere, Box)
+FCL_GJK_INLINE_SHAPE_SHAPE_INTERSECT(Sphere, Cylinder)
+
+FCL_GJK_INLINE_SHAPE_SHAPE_INTERSECT(Sphere, Halfspace)
+FCL_GJK_INLINE_SHAPE_SHAPE_INTERSECT(Ellipsoid, Halfspace)
+FCL_GJK_INLINE_SHAPE_SHAPE_INTERSECT(Box, Halfspace)
+FCL_GJK_INLINE_SHAPE_SHAPE_INTERSECT(Capsule, Halfspace)
+FCL_GJK_INLINE_SHAPE_SHAPE_INTERSECT(Cylinder, Halfspace)
+FCL_GJK_INLINE_SHAPE_SHAPE_INTERSECT(Cone, Halfspace)
+
+FCL_GJK_INLINE_SHAPE_SHAPE_INTERSECT(Sphere, Plane)
+FCL_GJK_INLINE_SHAPE_SHAPE_INTERSECT(Ellipsoid, Plane)
+FCL_GJK_INLINE_SHAPE_SHAPE_INTERSECT(Box, Plane)
+FCL_GJK_INLINE_SHAPE_SHAPE_INTERSECT(Capsule, Plane)
+FCL_GJK_INLINE_SHAPE_SHAPE_INTERSECT(Cylinder, Plane)
+FCL_GJK_INLINE_SHAPE_SHAPE_INTERSECT(Cone, Plane)
+
+FCL_GJK_INLINE_SHAPE_INTERSECT(Halfspace)
+FCL_GJK_INLINE_SHAPE_INTERSECT(Plane)
+FCL_GJK_INLINE_SHAPE_SHAPE_INTERSECT(Plane, Halfspace)
+
+//==============================================================================
+template<typename S, typename Shape>
+struct ShapeTriangleIntersectInlineImpl
+{
+  static bool run(
+      const GJKSolver_inline<S>& gjkSolver,
+      const Shape& s,
+      const Transform3<S>& tf,
+      const Vector3<S>& P1,
+      const Vector3<S>& P2,
+      const Vector3<S>& P3,
+      Vector3<S>* contact_points,
+      S* penetration_depth,
+      Vector3<S>* normal)
+  {
+    TriangleP<S> tri(P1, P2, P3);
+
+    detail::ShapePairMinkowskiDiff<S, Shape, TriangleP<S>> shape;
+    shape.shape0 = &s;
+    shape.shape1 = &tri;
+    shape.toshape1 = tf.linear();
+    shape.toshape0 = tf.inverse(Eigen::Isometry);
+
+    Vector3<S> w0;
+    Vector3<S> epa_normal;
+    S depth;
+    if(!gjkInlinePenetration(gjkSolver, shape, w0, epa_normal, depth))
+      return false;
+
+    if(penetration_depth) *penetration_depth = -depth;
+    if(normal) *normal = -epa_normal;
+    if(contact_points) (*contact_points).noalias() = tf * (w0 - epa_normal*(depth *0.5));
+    return true;
+  }
+};
+
+//==============================================================================
+template<typename S>
+template<typename Shape>
+bool GJKSolver_inline<S>::shapeTriangleIntersect(
+    const Shape& s,
+    const Transform3<S>& tf,
+    const Vector3<S>& P1,
+    const Vector3<S>& P2,
+    const Vector3<S>& P3,
+    Vector3<S>* contact_points,
+    S* penetration_depth,
+    Vector3<S>* normal) const
+{
+  return ShapeTriangleIntersectInlineImpl<S, Shape>::run(
+        *this, s, tf, P1, P2, P3, contact_points, penetration_depth, normal);
+}
+
+//==============================================================================
+template<typename S>
+struct ShapeTriangleIntersectInlineImpl<S, Sphere<S>>
+  : ShapeTriangleIntersectIndepImpl<S, Sphere<S>> {};
+
+//==============================================================================
+template<typename S, typename Shape>
+struct ShapeTransformedTriangleIntersectInlineImpl
+{
+  static bool run(
+      const GJKSolver_inline<S>& gjkSolver,
+      const Shape& s,
+      const Transform3<S>& tf1,
+      const Vector3<S>& P1,
+      const Vector3<S>& P2,
+      const Vector3<S>& P3,
+      const Transform3<S>& tf2,
+      Vector3<S>* contact_points,
+      S* penetration_depth,
+      Vector3<S>* normal)
+  {
+    TriangleP<S> tri(P1, P2, P3);
+
+    detail::ShapePairMinkowskiDiff<S, Shape, TriangleP<S>> shape;
+    initShapePairMinkowskiDiff(shape, s, tf1, tri, tf2);
+
+    Vector3<S> w0;
+    Vector3<S> epa_normal;
+    S depth;
+    if(!gjkInlinePenetration(gjkSolver, shape, w0, epa_normal, depth))
+      return false;
+
+    if(penetration_depth) *penetration_depth = -depth;
+    if(normal) *normal = -epa_normal;
+    if(contact_points) (*contact_points).noalias() = tf1 * (w0 - epa_normal*(depth *0.5));
+    return true;
+  }
+};
+
+//==============================================================================
+template<typename S>
+template<typename Shape>
+bool GJKSolver_inline<S>::shapeTriangleIntersect(
+    const Shape& s,
+    const Transform3<S>& tf1,
+    const Vector3<S>& P1,
+    const Vector3<S>& P2,
+    const Vector3<S>& P3,
+    const Transform3<S>& tf2,
+    Vector3<S>* contact_points,
+    S* penetration_depth,
+    Vector3<S>* normal) const
+{
+  return ShapeTransformedTriangleIntersectInlineImpl<S, Shape>::run(
+        *this, s, tf1, P1, P2, P3, tf2,
+        contact_points, penetration_depth, normal);
+}
+
+//==============================================================================
+template<typename S>
+struct ShapeTransformedTriangleIntersectInlineImpl<S, Sphere<S>>
+  : ShapeTransformedTriangleIntersectIndepImpl<S, Sphere<S>> {};
+
+//==============================================================================
+template<typename S>
+struct ShapeTransformedTriangleIntersectInlineImpl<S, Halfspace<S>>
+  : ShapeTransformedTriangleIntersectIndepImpl<S, Halfspace<S>> {};
+
+//==============================================================================
+template<typename S>
+struct ShapeTransformedTriangleIntersectInlineImpl<S, Plane<S>>
+  : ShapeTransformedTriangleIntersectIndepImpl<S, Plane<S>> {};
+
+//==============================================================================
+template<typename S, typename Shape1, typename Shape2>
+struct ShapeDistanceInlineImpl
+{
+  static bool run(
+      const GJKSolver_inline<S>& gjkSolver,
+      const Shape1& s1,
+      const Transform3<S>& tf1,
+      const Shape2& s2,
+      const Transform3<S>& tf2,
+      S* distance,
+      Vector3<S>* p1,
+      Vector3<S>* p2)
+  {
+    detail::ShapePairMinkowskiDiff<S, Shape1, Shape2> shape;
+    initShapePairMinkowskiDiff(shape, s1, tf1, s2, tf2);
+
+    Vector3<S> w0;
+    Vector3<S> w1;
+    if(!gjkInlineDistance(gjkSolver, shape, w0, w1))
+    {
+      if(distance) *distance = -1;
+      return false;
+    }
+
+    if(distance) *distance = (w0 - w1).norm();
+
+    // Answer is solved in Shape1's local frame; answers are given in the
+    // world frame.
+    if(p1) p1->noalias() = tf1 * w0;
+    if(p2) p2->noalias() = tf1 * w1;
+
+    return true;
+  }
+};
+
+//==============================================================================
+template<typename S>
+template<typename Shape1, typename Shape2>
+bool GJKSolver_inline<S>::shapeDistance(
+    const Shape1& s1,
+    const Transform3<S>& tf1,
+    const Shape2& s2,
+    const Transform3<S>& tf2,
+    S* dist,
+    Vector3<S>* p1,
+    Vector3<S>* p2) const
+{
+  return ShapeDistanceInlineImpl<S, Shape1, Shape2>::run(
+        *this, s1, tf1, s2, tf2, dist, p1, p2);
+}
+
+//==============================================================================
+template<typename S>
+template<typename Shape1, typename Shape2>
+bool GJKSolver_inline<S>::shapeSignedDistance(
+    const Shape1& s1,
+    const Transform3<S>& tf1,
+    const Shape2& s2,
+    const Transform3<S>& tf2,
+    S* dist,
+    Vector3<S>* p1,
+    Vector3<S>* p2) const
+{
+  // The same as GJKSolver_indep::shapeSignedDistance()
+  return ShapeDistanceInlineImpl<S, Shape1, Shape2>::run(
+        *this, s1, tf1, s2, tf2, dist, p1, p2);
+}
+
+#define FCL_GJK_INLINE_SHAPE_SHAPE_DISTANCE_REG(SHAPE1, SHAPE2)\
+  template <typename S>\
+  struct ShapeDistanceInlineImpl<S, SHAPE1<S>, SHAPE2<S>>\
+    : ShapeDistanceIndepImpl<S, SHAPE1<S>, SHAPE2<S>> {};
+
+#define FCL_GJK_INLINE_SHAPE_SHAPE_DISTANCE(SHAPE1, SHAPE2)\
+  FCL_GJK_INLINE_SHAPE_SHAPE_DISTANCE_REG(SHAPE1, SHAPE2)\
+  FCL_GJK_INLINE_SHAPE_SHAPE_DISTANCE_REG(SHAPE2, SHAPE1)
+
+FCL_GJK_INLINE_SHAPE_SHAPE_DISTANCE(Sphere, Box)
+FCL_GJK_INLINE_SHAPE_SHAPE_DISTANCE(Sphere, Capsule)
+FCL_GJK_INLINE_SHAPE_SHAPE_DISTANCE(Sphere, Cylinder)
+FCL_GJK_INLINE_SHAPE_SHAPE_DISTANCE_REG(Sphere, Sphere)
+FCL_GJK_INLINE_SHAPE_SHAPE_DISTANCE_REG(Capsule, Capsule)
+
+//==============================================================================
+template<typename S, typename Shape>
+struct ShapeTriangleDistanceInlineImpl
+{
+  static bool run(
+      const GJKSolver_inline<S>& gjkSolver,
+      const Shape& s,
+      const Transform3<S>& tf,
+      const Vector3<S>& P1,
+      const Vector3<S>& P2,
+      const Vector3<S>& P3,
+      S* distance,
+      Vector3<S>* p1,
+      Vector3<S>* p2)
+  {
+    TriangleP<S> tri(P1, P2, P3);
+
+    detail::ShapePairMinkowskiDiff<S, Shape, TriangleP<S>> shape;
+    shape.shape0 = &s;
+    shape.shape1 = &tri;
+    shape.toshape1 = tf.linear();
+    shape.toshape0 = tf.inverse(Eigen::Isometry);
+
+    Vector3<S> w0;
+    Vector3<S> w1;
+    if(!gjkInlineDistance(gjkSolver, shape, w0, w1))
+    {
+      if(distance) *distance = -1;
+      return false;
+    }
+
+    if(distance) *distance = (w0 - w1).norm();
+    // The same points as GJKSolver_indep reports for this query
+    if(p1) *p1 = w0;
+    if(p2) *p2 = w1;
+    return true;
+  }
+};
+
+//==============================================================================
+template<typename S>
+template<typename Shape>
+bool GJKSolver_inline<S>::shapeTriangleDistance(
+    const Shape& s,
+    const Transform3<S>& tf,
+    const Vector3<S>& P1,
+    const Vector3<S>& P2,
+    const Vector3<S>& P3,
+    S* dist,
+    Vector3<S>* p1,
+    Vector3<S>* p2) const
+{
+  return ShapeTriangleDistanceInlineImpl<S, Shape>::run(
+        *this, s, tf, P1, P2, P3, dist, p1, p2);
+}
+
+//==============================================================================
+template<typename S>
+struct ShapeTriangleDistanceInlineImpl<S, Sphere<S>>
+  : ShapeTriangleDistanceIndepImpl<S, Sphere<S>> {};
+
+//==============================================================================
+template<typename S, typename Shape>
+struct ShapeTransformedTriangleDistanceInlineImpl
+{
+  static bool run(
+      const GJKSolver_inline<S>& gjkSolver,
+      const Shape& s,
+      const Transform3<S>& tf1,
+      const Vector3<S>& P1,
+      const Vector3<S>& P2,
+      const Vector3<S>& P3,
+      const Transform3<S>& tf2,
+      S* distance,
+      Vector3<S>* p1,
+      Vector3<S>* p2)
+  {
+    TriangleP<S> tri(P1, P2, P3);
+
+    detail::ShapePairMinkowskiDiff<S, Shape, TriangleP<S>> shape;
+    initShapePairMinkowskiDiff(shape, s, tf1, tri, tf2);
+
+    Vector3<S> w0;
+    Vector3<S> w1;
+    if(!gjkInlineDistance(gjkSolver, shape, w0, w1))
+    {
+      if(distance) *distance = -1;
+      return false;
+    }
+
+    if(distance) *distance = (w0 - w1).norm();
+    if(p1) p1->noalias() = tf1 * w0;
+    if(p2) p2->noalias() = tf1 * w1;
+    return true;
+  }
+};
+
+//==============================================================================
+template<typename S>
+template<typename Shape>
+bool GJKSolver_inline<S>::shapeTriangleDistance(
+    const Shape& s,
+    const Transform3<S>& tf1,
+    const Vector3<S>& P1,
+    const Vector3<S>& P2,
+    const Vector3<S>& P3,
+    const Transform3<S>& tf2,
+    S* dist,
+    Vector3<S>* p1,
+    Vector3<S>* p2) const
+{
+  return ShapeTransformedTriangleDistanceInlineImpl<S, Shape>::run(
+        *this, s, tf1, P1, P2, P3, tf2, dist, p1, p2);
+}
+
+//==============================================================================
+template<typename S>
+struct ShapeTransformedTriangleDistanceInlineImpl<S, Sphere<S>>
+  : ShapeTransformedTriangleDistanceIndepImpl<S, Sphere<S>> {};
+
+} // namespace detail
+} // namespace fcl
+
+#endif
@@ -0,0 +1,148 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FCL_NARROWPHASE_GJKSOLVERINLINE_H
+#define FCL_NARROWPHASE_GJKSOLVERINLINE_H
+
+#include "fcl/narrowphase/detail/gjk_solver_indep.h"
+
+namespace fcl
+{
+
+namespace detail
+{
+
+/// @brief collision and distance solver running the GJK and EPA of
+/// GJKSolver_indep on the pair of shape types of each query. The support
+/// functions of the two shapes are called directly instead of through a
+/// switch on the node type, so that the compiler can inline them into the GJK
+/// and EPA loops. The pairs GJKSolver_indep solves in closed form are solved
+/// the same way here; the settings are those of GJKSolver_indep.
+template <typename S_>
+struct FCL_EXPORT GJKSolver_inline : public GJKSolver_indep<S_>
+{
+  using S = S_;
+
+  /// @brief intersection checking between two shapes
+  template<typename Shape1, typename Shape2>
+  bool shapeIntersect(
+      const Shape1& s1,
+      const Transform3<S>& tf1,
+      const Shape2& s2,
+      const Transform3<S>& tf2,
+      std::vector<ContactPoint<S>>* contacts = nullptr) const;
+
+  /// @brief intersection checking between one shape and a triangle
+  template<typename Shape>
+  bool shapeTriangleIntersect(
+      const Shape& s,
+      const Transform3<S>& tf,
+      const Vector3<S>& P1,
+      const Vector3<S>& P2,
+      const Vector3<S>& P3,
+      Vector3<S>* contact_points = nullptr,
+      S* penetration_depth = nullptr,
+      Vector3<S>* normal = nullptr) const;
+
+  //// @brief intersection checking between one shape and a triangle with transformation
+  template<typename Shape>
+  bool shapeTriangleIntersect(
+      const Shape& s,
+      const Transform3<S>& tf1,
+      const Vector3<S>& P1,
+      const Vector3<S>& P2,
+      const Vector3<S>& P3,
+      const Transform3<S>& tf2,
+      Vector3<S>* contact_points = nullptr,
+      S* penetration_depth = nullptr,
+      Vector3<S>* normal = nullptr) const;
+
+  /// @brief distance computation between two shapes
+  template<typename Shape1, typename Shape2>
+  bool shapeDistance(
+      const Shape1& s1,
+      const Transform3<S>& tf1,
+      const Shape2& s2,
+      const Transform3<S>& tf2,
+      S* distance = nullptr,
+      Vector3<S>* p1 = nullptr,
+      Vector3<S>* p2 = nullptr) const;
+
+  /// @brief distance computation between two shapes
+  template<typename Shape1, typename Shape2>
+  bool shapeSignedDistance(
+      const Shape1& s1,
+      const Transform3<S>& tf1,
+      const Shape2& s2,
+      const Transform3<S>& tf2,
+      S* distance = nullptr,
+      Vector3<S>* p1 = nullptr,
+      Vector3<S>* p2 = nullptr) const;
+
+  /// @brief distance computation between one shape and a triangle
+  template<typename Shape>
+  bool shapeTriangleDistance(
+      const Shape& s,
+      const Transform3<S>& tf,
+      const Vector3<S>& P1,
+      const Vector3<S>& P2,
+      const Vector3<S>& P3,
+      S* distance = nullptr,
+      Vector3<S>* p1 = nullptr,
+      Vector3<S>* p2 = nullptr) const;
+
+  /// @brief distance computation between one shape and a triangle with transformation
+  template<typename Shape>
+  bool shapeTriangleDistance(
+      const Shape& s,
+      const Transform3<S>& tf1,
+      const Vector3<S>& P1,
+      const Vector3<S>& P2,
+      const Vector3<S>& P3,
+      const Transform3<S>& tf2,
+      S* distance = nullptr,
+      Vector3<S>* p1 = nullptr,
+      Vector3<S>* p2 = nullptr) const;
+};
+
+using GJKSolver_inlinef = GJKSolver_inline<float>;
+using GJKSolver_inlined = GJKSolver_inline<double>;
+
+} // namespace detail
+} // namespace fcl
+
+#include "fcl/narrowphase/detail/gjk_solver_inline-inl.h"
+
+#endif
@@ -992,6 +992,15 @@ Vector3<S> GJKSolver_libccd<S>::getCachedGuess() const
   return Vector3<S>(-1, 0, 0);
 }
 
+//==============================================================================
+template<typename S>
+void GJKSolver_libccd<S>::setCachedSimplex(GJKSimplexCache<S>* cache) const
+{
+  FCL_UNUSED(cache);
+
+  // TODO: need change libccd to exploit spatial coherence
+}
+
 } // namespace detail
 } // namespace fcl
 
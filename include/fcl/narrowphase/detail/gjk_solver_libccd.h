@@ -40,6 +40,7 @@
 
 #include "fcl/common/types.h"
 #include "fcl/narrowphase/contact_point.h"
+#include "fcl/narrowphase/gjk_cache.h"
 
 namespace fcl
 {
@@ -156,6 +157,8 @@ struct FCL_EXPORT GJKSolver_libccd
 
   Vector3<S> getCachedGuess() const;
 
+  void setCachedSimplex(GJKSimplexCache<S>* cache) const;
+
   /// @brief maximum number of iterations used in GJK algorithm for collision
   unsigned int max_collision_iterations;
 
@@ -56,8 +56,6 @@ BVHShapeCollisionTraversalNode<Shape, BV>::BVHShapeCollisionTraversalNode()
   model1 = nullptr;
   model2 = nullptr;
 
-  num_bv_tests = 0;
-  num_leaf_tests = 0;
   query_time_seconds = 0.0;
 }
 
@@ -88,7 +86,7 @@ bool BVHShapeCollisionTraversalNode<Shape, BV>::BVTesting(int b1, int b2) const
 {
   FCL_UNUSED(b2);
 
-  if(this->enable_statistics) num_bv_tests++;
+  if(this->enable_statistics) this->num_bv_tests++;
   return !model1->getBV(b1).bv.overlap(model2_bv);
 }
 
@@ -52,6 +52,14 @@ namespace detail
 extern template
 class FCL_EXPORT CollisionTraversalNodeBase<double>;
 
+//==============================================================================
+template <typename S>
+constexpr bool CollisionTraversalNodeBase<S>::batched_bv_testing;
+
+//==============================================================================
+template <typename S>
+constexpr int CollisionTraversalNodeBase<S>::leaf_block_size;
+
 //==============================================================================
 template <typename S>
 CollisionTraversalNodeBase<S>::CollisionTraversalNodeBase()
@@ -77,6 +85,15 @@ bool CollisionTraversalNodeBase<S>::BVTesting(int b1, int b2) const
   return true;
 }
 
+//==============================================================================
+template <typename S>
+void CollisionTraversalNodeBase<S>::BVTestingBatch(
+    int n, const int* b1, const int* b2, bool* disjoint) const
+{
+  for(int i = 0; i < n; ++i)
+    disjoint[i] = BVTesting(b1[i], b2[i]);
+}
+
 //==============================================================================
 template <typename S>
 void CollisionTraversalNodeBase<S>::leafTesting(int b1, int b2) const
@@ -87,6 +104,25 @@ void CollisionTraversalNodeBase<S>::leafTesting(int b1, int b2) const
   // Do nothing
 }
 
+//==============================================================================
+template <typename S>
+bool CollisionTraversalNodeBase<S>::leafBlockTesting(int b1, int b2) const
+{
+  FCL_UNUSED(b1);
+  FCL_UNUSED(b2);
+
+  return false;
+}
+
+//==============================================================================
+template <typename S>
+bool CollisionTraversalNodeBase<S>::selfBVTesting(int b) const
+{
+  FCL_UNUSED(b);
+
+  return false;
+}
+
 //==============================================================================
 template <typename S>
 bool CollisionTraversalNodeBase<S>::canStop() const
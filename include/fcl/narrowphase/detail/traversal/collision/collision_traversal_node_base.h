@@ -59,9 +59,34 @@ public:
   /// @brief BV test between b1 and b2
   virtual bool BVTesting(int b1, int b2) const;
 
+  /// @brief BV tests between the n node pairs (b1[i], b2[i]); disjoint[i]
+  /// receives the result of BVTesting(b1[i], b2[i]). Used by the breadth first
+  /// traversal; nodes with a vectorized BV test can override it.
+  virtual void BVTestingBatch(int n, const int* b1, const int* b2, bool* disjoint) const;
+
+  /// @brief Whether collisionRecurseStatic() tests the child pairs of each
+  /// descent step with a single BVTestingBatch() call. Nodes whose batched
+  /// test is vectorized set it to true.
+  static constexpr bool batched_bv_testing = false;
+
   /// @brief Leaf test between node b1 and b2, if they are both leafs
   virtual void leafTesting(int b1, int b2) const;
 
+  /// @brief Leaf tests between all the leaves below node b1 and node b2, if
+  /// each of them covers at most leaf_block_size primitives; returns false,
+  /// without testing anything, otherwise. The default returns false.
+  virtual bool leafBlockTesting(int b1, int b2) const;
+
+  /// @brief Whether collisionRecurseStatic() calls leafBlockTesting() on the
+  /// overlapping node pairs before descending them. 0 means never; nodes that
+  /// test leaf blocks together set it to the largest block they accept.
+  static constexpr int leaf_block_size = 0;
+
+  /// @brief Culling test for the self collision of the subtree b, i.e.,
+  /// between the primitives below b; true if they cannot collide with each
+  /// other. The default returns false.
+  virtual bool selfBVTesting(int b) const;
+
   /// @brief Check whether the traversal can stop
   virtual bool canStop() const;
 
@@ -50,6 +50,10 @@ namespace detail
 extern template
 class FCL_EXPORT Intersect<double>;
 
+//==============================================================================
+extern template
+struct TrianglePairBatch<double>;
+
 //==============================================================================
 template <typename S>
 bool Intersect<S>::isZero(S v)
@@ -1140,6 +1144,134 @@ constexpr unsigned int Intersect<S>::getMaxTriangleClips()
   return 8;
 }
 
+//==============================================================================
+template <typename S>
+constexpr int TrianglePairBatch<S>::capacity;
+
+//==============================================================================
+template <typename S>
+void TrianglePairBatch<S>::set(
+    int i,
+    const Vector3<S>& P1, const Vector3<S>& P2, const Vector3<S>& P3,
+    const Vector3<S>& Q1, const Vector3<S>& Q2, const Vector3<S>& Q3)
+{
+  for(int c = 0; c < 3; ++c)
+  {
+    p[c][i] = P1[c];
+    p[3 + c][i] = P2[c];
+    p[6 + c][i] = P3[c];
+    q[c][i] = Q1[c];
+    q[3 + c][i] = Q2[c];
+    q[6 + c][i] = Q3[c];
+  }
+}
+
+//==============================================================================
+template <typename S>
+void triangleDisjointBatch(
+    const TrianglePairBatch<S>& batch, int n, bool disjoint[])
+{
+  for(int i = 0; i < n; ++i)
+    triangleDisjointLanes<ScalarLane<S>>(batch, i, disjoint);
+}
+
+//==============================================================================
+template <typename Lane>
+struct LaneVector3
+{
+  Lane v[3];
+
+  LaneVector3 operator-(const LaneVector3& o) const
+  {
+    return {{v[0] - o.v[0], v[1] - o.v[1], v[2] - o.v[2]}};
+  }
+
+  // Same evaluation order as Eigen's cross() and dot() on Vector3
+  LaneVector3 cross(const LaneVector3& o) const
+  {
+    return {{v[1] * o.v[2] - v[2] * o.v[1],
+             v[2] * o.v[0] - v[0] * o.v[2],
+             v[0] * o.v[1] - v[1] * o.v[0]}};
+  }
+
+  Lane dot(const LaneVector3& o) const
+  {
+    return v[0] * o.v[0] + v[1] * o.v[1] + v[2] * o.v[2];
+  }
+};
+
+//==============================================================================
+template <typename Lane>
+typename Lane::Mask project6Lanes(
+    const LaneVector3<Lane>& ax,
+    const LaneVector3<Lane>& p1, const LaneVector3<Lane>& p2, const LaneVector3<Lane>& p3,
+    const LaneVector3<Lane>& q1, const LaneVector3<Lane>& q2, const LaneVector3<Lane>& q3)
+{
+  const Lane P1 = ax.dot(p1);
+  const Lane P2 = ax.dot(p2);
+  const Lane P3 = ax.dot(p3);
+  const Lane Q1 = ax.dot(q1);
+  const Lane Q2 = ax.dot(q2);
+  const Lane Q3 = ax.dot(q3);
+
+  const Lane mn1 = Lane::min(P1, Lane::min(P2, P3));
+  const Lane mx2 = Lane::max(Q1, Lane::max(Q2, Q3));
+  const Lane mx1 = Lane::max(P1, Lane::max(P2, P3));
+  const Lane mn2 = Lane::min(Q1, Lane::min(Q2, Q3));
+
+  return (mn1 > mx2) | (mn2 > mx1);
+}
+
+//==============================================================================
+template <typename Lane>
+void triangleDisjointLanes(
+    const TrianglePairBatch<typename Lane::S>& batch, int first,
+    bool disjoint[])
+{
+  // Same tests as Intersect::intersect_Triangle(), which exit as soon as all
+  // the lanes are separated
+  LaneVector3<Lane> P[3];
+  LaneVector3<Lane> Q[3];
+  for(int k = 0; k < 3; ++k)
+  {
+    for(int c = 0; c < 3; ++c)
+    {
+      P[k].v[c] = Lane::load(batch.p[3 * k + c] + first);
+      Q[k].v[c] = Lane::load(batch.q[3 * k + c] + first);
+    }
+  }
+
+  const LaneVector3<Lane> p1 = P[0] - P[0];
+  const LaneVector3<Lane> p2 = P[1] - P[0];
+  const LaneVector3<Lane> p3 = P[2] - P[0];
+  const LaneVector3<Lane> q1 = Q[0] - P[0];
+  const LaneVector3<Lane> q2 = Q[1] - P[0];
+  const LaneVector3<Lane> q3 = Q[2] - P[0];
+
+  const LaneVector3<Lane> e[3] = {p2 - p1, p3 - p2, p1 - p3};
+  const LaneVector3<Lane> f[3] = {q2 - q1, q3 - q2, q1 - q3};
+  const LaneVector3<Lane> n1 = e[0].cross(e[1]);
+  const LaneVector3<Lane> m1 = f[0].cross(f[1]);
+
+  typename Lane::Mask mask = project6Lanes(n1, p1, p2, p3, q1, q2, q3);
+  mask = mask | project6Lanes(m1, p1, p2, p3, q1, q2, q3);
+
+  for(int i = 0; i < 3 && !Lane::all(mask); ++i)
+    for(int j = 0; j < 3; ++j)
+      mask = mask | project6Lanes(e[i].cross(f[j]), p1, p2, p3, q1, q2, q3);
+
+  if(!Lane::all(mask))
+  {
+    for(int i = 0; i < 3; ++i)
+      mask = mask | project6Lanes(e[i].cross(n1), p1, p2, p3, q1, q2, q3);
+
+    for(int j = 0; j < 3; ++j)
+      mask = mask | project6Lanes(f[j].cross(m1), p1, p2, p3, q1, q2, q3);
+  }
+
+  Lane::store(mask, disjoint + first);
+}
+
 } // namespace detail
 } // namespace fcl
 
@@ -42,6 +42,7 @@
 #include "fcl/common/types.h"
 #include "fcl/math/geometry.h"
 #include "fcl/math/detail/polysolver.h"
+#include "fcl/math/detail/simd_lane.h"
 
 namespace fcl
 {
@@ -257,6 +258,54 @@ private:
 using Intersectf = Intersect<float>;
 using Intersectd = Intersect<double>;
 
+/// @brief A batch of triangle pairs, stored as a structure of arrays so that
+/// the separating axis tests of Intersect::intersect_Triangle() can be
+/// evaluated on all the pairs together
+template <typename S>
+struct FCL_EXPORT TrianglePairBatch
+{
+  /// @brief Maximum number of pairs in a batch
+  static constexpr int capacity = 4;
+
+  /// @brief Store the pair i of the batch
+  void set(int i,
+           const Vector3<S>& P1, const Vector3<S>& P2, const Vector3<S>& P3,
+           const Vector3<S>& Q1, const Vector3<S>& Q2, const Vector3<S>& Q3);
+
+  /// @brief Vertices of the first triangles; p[3 * k + c][i] is the coordinate
+  /// c of the vertex k of the first triangle of the pair i
+  S p[9][capacity];
+
+  /// @brief Vertices of the second triangles, laid out as p
+  S q[9][capacity];
+};
+
+/// @brief The negation of Intersect::intersect_Triangle() on the first n pairs
+/// of batch; disjoint[i] receives the result for the pair i. The 17 axes are
+/// tested in the same order and with the same arithmetic, so the results are
+/// identical. For double, the pairs are tested together with AVX or SSE2
+/// instructions when the library is built with them enabled, like
+/// obbDisjointBatch().
+template <typename S>
+FCL_EXPORT
+void triangleDisjointBatch(
+    const TrianglePairBatch<S>& batch, int n, bool disjoint[]);
+
+/// @brief Vectorized triangleDisjointBatch() for double, defined in
+/// intersect.cpp
+template <>
+FCL_EXPORT
+void triangleDisjointBatch(
+    const TrianglePairBatch<double>& batch, int n, bool disjoint[]);
+
+/// @brief triangleDisjointBatch() on the pairs [first, first + Lane::width) of
+/// batch, one pair per lane of the vector type Lane
+template <typename Lane>
+FCL_EXPORT
+void triangleDisjointLanes(
+    const TrianglePairBatch<typename Lane::S>& batch, int first,
+    bool disjoint[]);
+
 } // namespace detail
 } // namespace fcl
 
@@ -40,6 +40,8 @@
 
 #include "fcl/narrowphase/detail/traversal/collision/mesh_collision_traversal_node.h"
 
+#include <algorithm>
+
 #include "fcl/common/unused.h"
 
 #include "fcl/narrowphase/collision_result.h"
@@ -199,6 +201,113 @@ void MeshCollisionTraversalNode<BV>::leafTesting(int b1, int b2) const
   }
 }
 
+//==============================================================================
+template <typename BV>
+constexpr int MeshCollisionTraversalNode<BV>::leaf_block_size;
+
+//==============================================================================
+template <typename BV>
+bool MeshCollisionTraversalNode<BV>::leafBlockTesting(int b1, int b2) const
+{
+  return leafBlockTestingImpl(b1, b2, nullptr, nullptr);
+}
+
+//==============================================================================
+template <typename BV>
+int collectLeafBlock(
+    const BVHModel<BV>* model, int b, int max_block_size, int leaves[])
+{
+  if(model->getBV(b).num_primitives > max_block_size)
+    return 0;
+
+  // Left to right, as the traversal visits them
+  int num_leaves = 0;
+  int stack[2 * MeshCollisionTraversalNode<BV>::leaf_block_size];
+  int stack_size = 0;
+  stack[stack_size++] = b;
+  while(stack_size > 0)
+  {
+    const int id = stack[--stack_size];
+    const BVNode<BV>& node = model->getBV(id);
+    if(node.isLeaf())
+    {
+      leaves[num_leaves++] = id;
+      continue;
+    }
+    stack[stack_size++] = node.rightChild();
+    stack[stack_size++] = node.leftChild();
+  }
+
+  return num_leaves;
+}
+
+//==============================================================================
+template <typename BV>
+bool MeshCollisionTraversalNode<BV>::leafBlockTestingImpl(
+    int b1, int b2, const Matrix3<S>* R, const Vector3<S>* T) const
+{
+  int leaves1[leaf_block_size];
+  int leaves2[leaf_block_size];
+
+  const int n1 = collectLeafBlock(this->model1, b1, leaf_block_size, leaves1);
+  if(n1 == 0) return false;
+  const int n2 = collectLeafBlock(this->model2, b2, leaf_block_size, leaves2);
+  if(n2 == 0) return false;
+
+  // Gather the triangles once per block, with the second ones in the frame of
+  // the first model
+  Vector3<S> p[leaf_block_size][3];
+  Vector3<S> q[leaf_block_size][3];
+  for(int i = 0; i < n1; ++i)
+  {
+    const Triangle& tri = tri_indices1[this->model1->getBV(leaves1[i]).primitiveId()];
+    for(int k = 0; k < 3; ++k)
+      p[i][k] = vertices1[tri[k]];
+  }
+  for(int j = 0; j < n2; ++j)
+  {
+    const Triangle& tri = tri_indices2[this->model2->getBV(leaves2[j]).primitiveId()];
+    for(int k = 0; k < 3; ++k)
+    {
+      if(R)
+        q[j][k] = (*R) * vertices2[tri[k]] + (*T);
+      else
+        q[j][k] = vertices2[tri[k]];
+    }
+  }
+
+  const int num_pairs = n1 * n2;
+  bool disjoint[leaf_block_size * leaf_block_size];
+  TrianglePairBatch<S> batch;
+  for(int first = 0; first < num_pairs; first += TrianglePairBatch<S>::capacity)
+  {
+    const int n = std::min(TrianglePairBatch<S>::capacity, num_pairs - first);
+    for(int k = 0; k < n; ++k)
+    {
+      const int i = (first + k) / n2;
+      const int j = (first + k) % n2;
+      batch.set(k, p[i][0], p[i][1], p[i][2], q[j][0], q[j][1], q[j][2]);
+    }
+    triangleDisjointBatch(batch, n, disjoint + first);
+  }
+
+  // The exact test, with the contact computation, only runs on the pairs that
+  // intersect
+  for(int k = 0; k < num_pairs; ++k)
+  {
+    if(disjoint[k])
+    {
+      if(this->enable_statistics) this->num_leaf_tests++;
+      continue;
+    }
+
+    this->leafTesting(leaves1[k / n2], leaves2[k % n2]);
+    if(this->canStop()) break;
+  }
+
+  return true;
+}
+
 //==============================================================================
 template <typename BV>
 bool MeshCollisionTraversalNode<BV>::canStop() const
@@ -296,6 +405,32 @@ bool MeshCollisionTraversalNodeOBB<S>::BVTesting(int b1, int b2) const
   return !overlap(R, T, this->model1->getBV(b1).bv, this->model2->getBV(b2).bv);
 }
 
+//==============================================================================
+template <typename S>
+constexpr bool MeshCollisionTraversalNodeOBB<S>::batched_bv_testing;
+
+//==============================================================================
+template <typename S>
+void MeshCollisionTraversalNodeOBB<S>::BVTestingBatch(
+    int n, const int* b1, const int* b2, bool* disjoint) const
+{
+  if(this->enable_statistics) this->num_bv_tests += n;
+
+  OBBPairBatch<S> batch;
+  for(int i = 0; i < n; i += OBBPairBatch<S>::capacity)
+  {
+    const int m = std::min(n - i, OBBPairBatch<S>::capacity);
+    for(int k = 0; k < m; ++k)
+    {
+      batch.set(k, R, T,
+                this->model1->getBV(b1[i + k]).bv,
+                this->model2->getBV(b2[i + k]).bv);
+    }
+
+    obbDisjointBatch(batch, m, disjoint + i);
+  }
+}
+
 //==============================================================================
 template <typename S>
 void MeshCollisionTraversalNodeOBB<S>::leafTesting(int b1, int b2) const
@@ -320,6 +455,13 @@ void MeshCollisionTraversalNodeOBB<S>::leafTesting(int b1, int b2) const
         *this->result);
 }
 
+//==============================================================================
+template <typename S>
+bool MeshCollisionTraversalNodeOBB<S>::leafBlockTesting(int b1, int b2) const
+{
+  return this->leafBlockTestingImpl(b1, b2, &R, &T);
+}
+
 //==============================================================================
 template <typename S>
 bool MeshCollisionTraversalNodeOBB<S>::BVTesting(
@@ -439,6 +581,13 @@ void MeshCollisionTraversalNodeRSS<S>::leafTesting(int b1, int b2) const
         *this->result);
 }
 
+//==============================================================================
+template <typename S>
+bool MeshCollisionTraversalNodeRSS<S>::leafBlockTesting(int b1, int b2) const
+{
+  return this->leafBlockTestingImpl(b1, b2, &R, &T);
+}
+
 //==============================================================================
 template <typename S>
 MeshCollisionTraversalNodekIOS<S>::MeshCollisionTraversalNodekIOS()
@@ -481,6 +630,13 @@ void MeshCollisionTraversalNodekIOS<S>::leafTesting(int b1, int b2) const
         *this->result);
 }
 
+//==============================================================================
+template <typename S>
+bool MeshCollisionTraversalNodekIOS<S>::leafBlockTesting(int b1, int b2) const
+{
+  return this->leafBlockTestingImpl(b1, b2, &R, &T);
+}
+
 //==============================================================================
 template <typename S>
 MeshCollisionTraversalNodeOBBRSS<S>::MeshCollisionTraversalNodeOBBRSS()
@@ -499,6 +655,32 @@ bool MeshCollisionTraversalNodeOBBRSS<S>::BVTesting(int b1, int b2) const
   return !overlap(R, T, this->model1->getBV(b1).bv, this->model2->getBV(b2).bv);
 }
 
+//==============================================================================
+template <typename S>
+constexpr bool MeshCollisionTraversalNodeOBBRSS<S>::batched_bv_testing;
+
+//==============================================================================
+template <typename S>
+void MeshCollisionTraversalNodeOBBRSS<S>::BVTestingBatch(
+    int n, const int* b1, const int* b2, bool* disjoint) const
+{
+  if(this->enable_statistics) this->num_bv_tests += n;
+
+  OBBPairBatch<S> batch;
+  for(int i = 0; i < n; i += OBBPairBatch<S>::capacity)
+  {
+    const int m = std::min(n - i, OBBPairBatch<S>::capacity);
+    for(int k = 0; k < m; ++k)
+    {
+      batch.set(k, R, T,
+                this->model1->getBV(b1[i + k]).bv.obb,
+                this->model2->getBV(b2[i + k]).bv.obb);
+    }
+
+    obbDisjointBatch(batch, m, disjoint + i);
+  }
+}
+
 //==============================================================================
 template <typename S>
 void MeshCollisionTraversalNodeOBBRSS<S>::leafTesting(int b1, int b2) const
@@ -523,6 +705,13 @@ void MeshCollisionTraversalNodeOBBRSS<S>::leafTesting(int b1, int b2) const
         *this->result);
 }
 
+//==============================================================================
+template <typename S>
+bool MeshCollisionTraversalNodeOBBRSS<S>::leafBlockTesting(int b1, int b2) const
+{
+  return this->leafBlockTestingImpl(b1, b2, &R, &T);
+}
+
 template <typename BV>
 void meshCollisionOrientedNodeLeafTesting(
     int b1, int b2,
@@ -66,6 +66,14 @@ public:
   /// @brief Intersection testing between leaves (two triangles)
   void leafTesting(int b1, int b2) const;
 
+  /// @brief Intersection testing between the triangles below b1 and b2, if
+  /// each node covers at most leaf_block_size triangles. All the triangle
+  /// pairs of the block are tested by triangleDisjointBatch(), and leafTesting()
+  /// is only called on the pairs that intersect.
+  bool leafBlockTesting(int b1, int b2) const;
+
+  static constexpr int leaf_block_size = 4;
+
   /// @brief Whether the traversal process can stop early
   bool canStop() const;
 
@@ -76,6 +84,14 @@ public:
   Triangle* tri_indices2;
 
   S cost_density;
+
+protected:
+  /// @brief leafBlockTesting() for the nodes whose second model is expressed
+  /// in the frame of the first one by R and T, as in
+  /// Intersect::intersect_Triangle(); R and T are nullptr when both models are
+  /// in the same frame
+  bool leafBlockTestingImpl(
+      int b1, int b2, const Matrix3<S>* R, const Vector3<S>* T) const;
 };
 
 /// @brief Initialize traversal node for collision between two meshes, given the
@@ -103,8 +119,16 @@ public:
 
   bool BVTesting(int b1, int b2) const;
 
+  /// @brief BV culling tests of n node pairs, evaluated together by
+  /// obbDisjointBatch()
+  void BVTestingBatch(int n, const int* b1, const int* b2, bool* disjoint) const;
+
+  static constexpr bool batched_bv_testing = true;
+
   void leafTesting(int b1, int b2) const;
 
+  bool leafBlockTesting(int b1, int b2) const;
+
   bool BVTesting(int b1, int b2, const Matrix3<S>& Rc, const Vector3<S>& Tc) const;
 
   bool BVTesting(int b1, int b2, const Transform3<S>& tf) const;
@@ -145,6 +169,8 @@ public:
 
   void leafTesting(int b1, int b2) const;
 
+  bool leafBlockTesting(int b1, int b2) const;
+
 //  FCL_DEPRECATED
 //  bool BVTesting(int b1, int b2, const Matrix3<S>& Rc, const Vector3<S>& Tc) const;
 
@@ -187,6 +213,8 @@ public:
 
   void leafTesting(int b1, int b2) const;
 
+  bool leafBlockTesting(int b1, int b2) const;
+
   Matrix3<S> R;
   Vector3<S> T;
 
@@ -218,8 +246,16 @@ public:
 
   bool BVTesting(int b1, int b2) const;
 
+  /// @brief BV culling tests of n node pairs, evaluated together by
+  /// obbDisjointBatch()
+  void BVTestingBatch(int n, const int* b1, const int* b2, bool* disjoint) const;
+
+  static constexpr bool batched_bv_testing = true;
+
   void leafTesting(int b1, int b2) const;
 
+  bool leafBlockTesting(int b1, int b2) const;
+
   Matrix3<S> R;
   Vector3<S> T;
 
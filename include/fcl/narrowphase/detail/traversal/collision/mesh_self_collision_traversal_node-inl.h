@@ -0,0 +1,270 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FCL_TRAVERSAL_MESHSELFCOLLISIONTRAVERSALNODE_INL_H
+#define FCL_TRAVERSAL_MESHSELFCOLLISIONTRAVERSALNODE_INL_H
+
+#include "fcl/narrowphase/detail/traversal/collision/mesh_self_collision_traversal_node.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "fcl/math/constants.h"
+
+namespace fcl
+{
+
+namespace detail
+{
+
+//==============================================================================
+extern template
+struct NormalCone<double>;
+
+//==============================================================================
+template <typename S>
+NormalCone<S>::NormalCone()
+  : axis(Vector3<S>::UnitZ()), half_angle(constants<S>::pi())
+{
+  // Do nothing
+}
+
+//==============================================================================
+template <typename S>
+NormalCone<S>::NormalCone(const Vector3<S>& n)
+  : NormalCone()
+{
+  const S norm = n.norm();
+  if(norm > 0)
+  {
+    axis = n / norm;
+    half_angle = 0;
+  }
+}
+
+//==============================================================================
+template <typename S>
+NormalCone<S> NormalCone<S>::operator + (const NormalCone<S>& other) const
+{
+  const S pi = constants<S>::pi();
+
+  if(half_angle >= pi || other.half_angle >= pi)
+    return NormalCone<S>();
+
+  const S phi = std::acos(std::max<S>(-1, std::min<S>(1, axis.dot(other.axis))));
+
+  // One cone contains the other
+  if(phi + other.half_angle <= half_angle)
+    return *this;
+  if(phi + half_angle <= other.half_angle)
+    return other;
+
+  NormalCone<S> merged;
+  merged.half_angle = (phi + half_angle + other.half_angle) / 2;
+
+  // Nearly opposite axes give a cone wider than a half sphere, whose axis is
+  // ill-defined; it is then widened to the whole sphere
+  const S sin_phi = std::sin(phi);
+  if(merged.half_angle >= pi || sin_phi < std::sqrt(constants<S>::eps()))
+    return NormalCone<S>();
+
+  // The axis is rotated from axis towards other.axis, along the great circle
+  // through both
+  const S t = merged.half_angle - half_angle;
+  merged.axis = (std::sin(phi - t) * axis + std::sin(t) * other.axis) / sin_phi;
+  merged.axis.normalize();
+
+  return merged;
+}
+
+//==============================================================================
+template <typename BV>
+MeshSelfCollisionTraversalNode<BV>::MeshSelfCollisionTraversalNode()
+  : MeshCollisionTraversalNode<BV>(),
+    enable_adjacency_culling(true)
+{
+  // Do nothing
+}
+
+//==============================================================================
+template <typename BV>
+void MeshSelfCollisionTraversalNode<BV>::leafTesting(int b1, int b2) const
+{
+  if(enable_adjacency_culling)
+  {
+    const Triangle& tri_id1 = this->tri_indices1[this->model1->getBV(b1).primitiveId()];
+    const Triangle& tri_id2 = this->tri_indices2[this->model2->getBV(b2).primitiveId()];
+
+    for(int i = 0; i < 3; ++i)
+    {
+      for(int j = 0; j < 3; ++j)
+      {
+        if(tri_id1[i] == tri_id2[j])
+          return;
+      }
+    }
+  }
+
+  MeshCollisionTraversalNode<BV>::leafTesting(b1, b2);
+}
+
+//==============================================================================
+template <typename BV>
+bool MeshSelfCollisionTraversalNode<BV>::selfBVTesting(int b) const
+{
+  if(!normal_cones) return false;
+
+  if(this->enable_statistics) this->num_bv_tests++;
+
+  return (*normal_cones)[b].half_angle < constants<S>::pi() / 2;
+}
+
+//==============================================================================
+template <typename BV>
+void computeNormalCones(
+    const BVHModel<BV>& model,
+    std::vector<NormalCone<typename BV::S>>& cones)
+{
+  using S = typename BV::S;
+
+  const int num_bvs = model.getNumBVs();
+  cones.resize(num_bvs);
+
+  // stamp[v] is the last node whose left subtree was found to use vertex v
+  std::vector<int> stamp(model.num_vertices, -1);
+  std::vector<int> stack;
+  auto visit_triangles = [&](int b, bool set, int i) -> bool
+  {
+    stack.assign(1, b);
+    while(!stack.empty())
+    {
+      const BVNode<BV>& node = model.getBV(stack.back());
+      stack.pop_back();
+      if(!node.isLeaf())
+      {
+        stack.push_back(node.rightChild());
+        stack.push_back(node.leftChild());
+        continue;
+      }
+
+      const Triangle& tri = model.tri_indices[node.primitiveId()];
+      for(int k = 0; k < 3; ++k)
+      {
+        if(set)
+          stamp[tri[k]] = i;
+        else if(stamp[tri[k]] == i)
+          return true;
+      }
+    }
+    return false;
+  };
+
+  // Bottom-up: children are stored after their parent
+  for(int i = num_bvs - 1; i >= 0; --i)
+  {
+    const BVNode<BV>& node = model.getBV(i);
+    if(node.isLeaf())
+    {
+      const Triangle& tri = model.tri_indices[node.primitiveId()];
+      const Vector3<S>& p1 = model.vertices[tri[0]];
+      const Vector3<S>& p2 = model.vertices[tri[1]];
+      const Vector3<S>& p3 = model.vertices[tri[2]];
+      cones[i] = NormalCone<S>((p2 - p1).cross(p3 - p1));
+      continue;
+    }
+
+    cones[i] = cones[node.leftChild()] + cones[node.rightChild()];
+
+    // The normal cone test only holds for a connected patch. The triangles
+    // below i are known to be connected if those below each child are and
+    // the two children share a vertex; otherwise the cone is widened to the
+    // whole sphere, which also disables the test on the ancestors of i.
+    if(cones[i].half_angle < constants<S>::pi() / 2)
+    {
+      visit_triangles(node.leftChild(), true, i);
+      if(!visit_triangles(node.rightChild(), false, i))
+        cones[i] = NormalCone<S>();
+    }
+  }
+}
+
+//==============================================================================
+template <typename BV>
+bool initialize(
+    MeshSelfCollisionTraversalNode<BV>& node,
+    const BVHModel<BV>& model,
+    const SelfCollisionRequest<typename BV::S>& request,
+    CollisionResult<typename BV::S>& result)
+{
+  using S = typename BV::S;
+
+  if(model.getModelType() != BVH_MODEL_TRIANGLES
+     || (model.build_state != BVH_BUILD_STATE_PROCESSED
+         && model.build_state != BVH_BUILD_STATE_UPDATED))
+    return false;
+
+  node.model1 = &model;
+  node.tf1.setIdentity();
+  node.model2 = &model;
+  node.tf2.setIdentity();
+
+  node.vertices1 = model.vertices;
+  node.vertices2 = model.vertices;
+
+  node.tri_indices1 = model.tri_indices;
+  node.tri_indices2 = model.tri_indices;
+
+  node.request = request;
+  node.result = &result;
+
+  node.cost_density = model.cost_density * model.cost_density;
+
+  node.enable_adjacency_culling = request.enable_adjacency_culling;
+
+  node.normal_cones.reset();
+  if(request.enable_normal_cone_culling)
+  {
+    auto cones = std::make_shared<std::vector<NormalCone<S>>>();
+    computeNormalCones(model, *cones);
+    node.normal_cones = cones;
+  }
+
+  return true;
+}
+
+} // namespace detail
+} // namespace fcl
+
+#endif
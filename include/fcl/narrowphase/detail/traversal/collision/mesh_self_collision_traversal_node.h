@@ -0,0 +1,127 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FCL_TRAVERSAL_MESHSELFCOLLISIONTRAVERSALNODE_H
+#define FCL_TRAVERSAL_MESHSELFCOLLISIONTRAVERSALNODE_H
+
+#include <memory>
+#include <vector>
+
+#include "fcl/narrowphase/self_collision_request.h"
+#include "fcl/narrowphase/detail/traversal/collision/mesh_collision_traversal_node.h"
+
+namespace fcl
+{
+
+namespace detail
+{
+
+/// @brief Cone bounding a set of unit normals: all of them make an angle of
+/// at most half_angle with axis
+template <typename S>
+struct FCL_EXPORT NormalCone
+{
+  /// @brief Unit axis of the cone
+  Vector3<S> axis;
+
+  /// @brief Half angle of the cone; pi when the cone is the whole sphere
+  S half_angle;
+
+  /// @brief Creating the cone of the whole sphere
+  NormalCone();
+
+  /// @brief Creating the cone of the single normal n, which need not be unit;
+  /// the cone of the whole sphere if n is zero
+  explicit NormalCone(const Vector3<S>& n);
+
+  /// @brief Return the smallest cone containing the current cone and the
+  /// other one
+  NormalCone<S> operator + (const NormalCone<S>& other) const;
+};
+
+/// @brief Traversal node for the self collision of a mesh: both trees of the
+/// MeshCollisionTraversalNode are the same model, in its own frame
+template <typename BV>
+class FCL_EXPORT MeshSelfCollisionTraversalNode
+    : public MeshCollisionTraversalNode<BV>
+{
+public:
+
+  using S = typename BV::S;
+
+  MeshSelfCollisionTraversalNode();
+
+  /// @brief Intersection testing between two triangles of the mesh; skipped
+  /// if they share a vertex and enable_adjacency_culling is set
+  void leafTesting(int b1, int b2) const;
+
+  /// @brief Normal cone test of the subtree b; true if the normal cone of b
+  /// is narrower than a half sphere
+  bool selfBVTesting(int b) const;
+
+  bool enable_adjacency_culling;
+
+  /// @brief Normal cones of the BV nodes of the model, indexed like the nodes;
+  /// nullptr disables the normal cone test. Shared by the copies of the node.
+  std::shared_ptr<const std::vector<NormalCone<S>>> normal_cones;
+};
+
+/// @brief Compute the normal cones of all the BV nodes of model from its
+/// current vertices, as used by MeshSelfCollisionTraversalNode. The cone of a
+/// node whose triangles are not known to form a connected patch is the whole
+/// sphere.
+template <typename BV>
+FCL_EXPORT
+void computeNormalCones(
+    const BVHModel<BV>& model,
+    std::vector<NormalCone<typename BV::S>>& cones);
+
+/// @brief Initialize traversal node for the self collision of a mesh. The
+/// normal cones are computed if request.enable_normal_cone_culling is set.
+/// Returns false if model is not a built triangle mesh.
+template <typename BV>
+FCL_EXPORT
+bool initialize(
+    MeshSelfCollisionTraversalNode<BV>& node,
+    const BVHModel<BV>& model,
+    const SelfCollisionRequest<typename BV::S>& request,
+    CollisionResult<typename BV::S>& result);
+
+} // namespace detail
+} // namespace fcl
+
+#include "fcl/narrowphase/detail/traversal/collision/mesh_self_collision_traversal_node-inl.h"
+
+#endif
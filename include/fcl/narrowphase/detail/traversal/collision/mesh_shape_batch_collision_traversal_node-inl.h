@@ -0,0 +1,299 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FCL_TRAVERSAL_MESHSHAPEBATCHCOLLISIONTRAVERSALNODE_INL_H
+#define FCL_TRAVERSAL_MESHSHAPEBATCHCOLLISIONTRAVERSALNODE_INL_H
+
+#include "fcl/narrowphase/detail/traversal/collision/mesh_shape_batch_collision_traversal_node.h"
+
+#include <iostream>
+
+#include "fcl/geometry/shape/box.h"
+#include "fcl/geometry/shape/capsule.h"
+#include "fcl/geometry/shape/cone.h"
+#include "fcl/geometry/shape/convex.h"
+#include "fcl/geometry/shape/cylinder.h"
+#include "fcl/geometry/shape/ellipsoid.h"
+#include "fcl/geometry/shape/halfspace.h"
+#include "fcl/geometry/shape/plane.h"
+#include "fcl/geometry/shape/sphere.h"
+#include "fcl/geometry/shape/utility.h"
+#include "fcl/narrowphase/detail/traversal/traversal_stack.h"
+
+namespace fcl
+{
+
+namespace detail
+{
+
+//==============================================================================
+template <typename BV, typename NarrowPhaseSolver>
+MeshShapeBatchCollisionTraversalNode<BV, NarrowPhaseSolver>::
+MeshShapeBatchCollisionTraversalNode()
+  : model(nullptr), tf(Transform3<S>::Identity()), nsolver(nullptr)
+{
+  // Do nothing
+}
+
+//==============================================================================
+template <typename BV, typename NarrowPhaseSolver>
+void MeshShapeBatchCollisionTraversalNode<BV, NarrowPhaseSolver>::collide()
+const
+{
+  if(queries.empty()) return;
+
+  // A packet is a node of the mesh with the queries whose BV overlaps its
+  // parent, given as a range of active. The queries that overlap the node are
+  // appended to active and form the range of the packets of its children.
+  // The packets are visited in depth first order, so once a packet is popped,
+  // the ranges after its own belong to subtrees already traversed.
+  struct Packet
+  {
+    int b;
+    std::size_t begin;
+    std::size_t end;
+  };
+
+  std::vector<int> active;
+  active.reserve(4 * queries.size());
+  for(std::size_t i = 0; i < queries.size(); ++i)
+    active.push_back(static_cast<int>(i));
+
+  TraversalStack<Packet> stack;
+  stack.push({0, 0, active.size()});
+  while(!stack.empty())
+  {
+    const Packet packet = stack.pop();
+    active.resize(packet.end);
+
+    const BVNode<BV>& node = model->getBV(packet.b);
+    const std::size_t begin = active.size();
+    for(std::size_t i = packet.begin; i < packet.end; ++i)
+    {
+      const Query& query = queries[active[i]];
+      if(request.isSatisfied(*query.result)) continue;
+
+      if(request.enable_statistics) query.result->statistics.num_bv_tests++;
+      if(node.bv.overlap(query.bv)) active.push_back(active[i]);
+    }
+    const std::size_t end = active.size();
+
+    if(begin == end) continue;
+
+    if(node.isLeaf())
+    {
+      for(std::size_t i = begin; i < end; ++i)
+        leafTesting(node.primitiveId(), queries[active[i]]);
+    }
+    else
+    {
+      // The right child is pushed first, so that the left one is visited first
+      stack.push({node.rightChild(), begin, end});
+      stack.push({node.leftChild(), begin, end});
+    }
+  }
+}
+
+//==============================================================================
+template <typename BV, typename NarrowPhaseSolver>
+void MeshShapeBatchCollisionTraversalNode<BV, NarrowPhaseSolver>::leafTesting(
+    int primitive_id, const Query& query) const
+{
+  CollisionResult<S>& result = *query.result;
+  if(request.enable_statistics) result.statistics.num_leaf_tests++;
+
+  const Triangle& tri_id = model->tri_indices[primitive_id];
+
+  const Vector3<S>& p1 = model->vertices[tri_id[0]];
+  const Vector3<S>& p2 = model->vertices[tri_id[1]];
+  const Vector3<S>& p3 = model->vertices[tri_id[2]];
+
+  if(model->isOccupied() && query.shape->isOccupied())
+  {
+    bool is_intersect = false;
+
+    if(!request.enable_contact) // only interested in collision or not
+    {
+      if(query.intersect(query.shape, query.tf, p1, p2, p3, tf, nsolver, nullptr, nullptr, nullptr))
+      {
+        is_intersect = true;
+        if(request.num_max_contacts > result.numContacts())
+          result.addContact(Contact<S>(model, query.shape, primitive_id, Contact<S>::NONE));
+      }
+    }
+    else
+    {
+      S penetration;
+      Vector3<S> normal;
+      Vector3<S> contactp;
+
+      if(query.intersect(query.shape, query.tf, p1, p2, p3, tf, nsolver, &contactp, &penetration, &normal))
+      {
+        is_intersect = true;
+        if(request.num_max_contacts > result.numContacts())
+          result.addContact(Contact<S>(model, query.shape, primitive_id, Contact<S>::NONE, contactp, -normal, penetration));
+      }
+    }
+
+    if(is_intersect && request.enable_cost)
+    {
+      AABB<S> overlap_part;
+      AABB<S>(tf * p1, tf * p2, tf * p3).overlap(query.aabb, overlap_part);
+      result.addCostSource(CostSource<S>(overlap_part, model->cost_density), request.num_max_cost_sources);
+    }
+  }
+  else if((!model->isFree() || query.shape->isFree()) && request.enable_cost)
+  {
+    if(query.intersect(query.shape, query.tf, p1, p2, p3, tf, nsolver, nullptr, nullptr, nullptr))
+    {
+      AABB<S> overlap_part;
+      AABB<S>(tf * p1, tf * p2, tf * p3).overlap(query.aabb, overlap_part);
+      result.addCostSource(CostSource<S>(overlap_part, model->cost_density), request.num_max_cost_sources);
+    }
+  }
+}
+
+//==============================================================================
+template <typename Shape, typename NarrowPhaseSolver>
+bool batchShapeTriangleIntersect(
+    const CollisionGeometry<typename Shape::S>* shape,
+    const Transform3<typename Shape::S>& tf1,
+    const Vector3<typename Shape::S>& P1,
+    const Vector3<typename Shape::S>& P2,
+    const Vector3<typename Shape::S>& P3,
+    const Transform3<typename Shape::S>& tf2,
+    const NarrowPhaseSolver* nsolver,
+    Vector3<typename Shape::S>* contact_points,
+    typename Shape::S* penetration_depth,
+    Vector3<typename Shape::S>* normal)
+{
+  return nsolver->shapeTriangleIntersect(
+        *static_cast<const Shape*>(shape), tf1, P1, P2, P3, tf2,
+        contact_points, penetration_depth, normal);
+}
+
+//==============================================================================
+template <typename Shape, typename BV, typename NarrowPhaseSolver>
+void setQueryShape(
+    typename MeshShapeBatchCollisionTraversalNode<BV, NarrowPhaseSolver>::Query& query,
+    const Transform3<typename BV::S>& tf_inv)
+{
+  const Shape& shape = *static_cast<const Shape*>(query.shape);
+  computeBV(shape, tf_inv * query.tf, query.bv);
+  computeBV(shape, query.tf, query.aabb);
+  query.intersect = &batchShapeTriangleIntersect<Shape, NarrowPhaseSolver>;
+}
+
+//==============================================================================
+template <typename BV, typename NarrowPhaseSolver>
+bool initialize(
+    MeshShapeBatchCollisionTraversalNode<BV, NarrowPhaseSolver>& node,
+    const BVHModel<BV>& model,
+    const Transform3<typename BV::S>& tf,
+    const std::vector<const CollisionGeometry<typename BV::S>*>& geometries,
+    const aligned_vector<Transform3<typename BV::S>>& tfs,
+    const NarrowPhaseSolver* nsolver,
+    const CollisionRequest<typename BV::S>& request,
+    std::vector<CollisionResult<typename BV::S>>& results)
+{
+  using S = typename BV::S;
+  using Query = typename MeshShapeBatchCollisionTraversalNode<BV, NarrowPhaseSolver>::Query;
+
+  if(model.getModelType() != BVH_MODEL_TRIANGLES)
+    return false;
+
+  node.model = &model;
+  node.tf = tf;
+  node.nsolver = nsolver;
+  node.request = request;
+
+  results.resize(geometries.size());
+  node.queries.clear();
+  node.queries.reserve(geometries.size());
+
+  const Transform3<S> tf_inv = tf.inverse(Eigen::Isometry);
+  for(std::size_t i = 0; i < geometries.size(); ++i)
+  {
+    if(request.isSatisfied(results[i])) continue;
+
+    Query query;
+    query.shape = geometries[i];
+    query.tf = tfs[i];
+    query.result = &results[i];
+
+    switch(query.shape->getNodeType())
+    {
+    case GEOM_BOX:
+      setQueryShape<Box<S>, BV, NarrowPhaseSolver>(query, tf_inv);
+      break;
+    case GEOM_SPHERE:
+      setQueryShape<Sphere<S>, BV, NarrowPhaseSolver>(query, tf_inv);
+      break;
+    case GEOM_ELLIPSOID:
+      setQueryShape<Ellipsoid<S>, BV, NarrowPhaseSolver>(query, tf_inv);
+      break;
+    case GEOM_CAPSULE:
+      setQueryShape<Capsule<S>, BV, NarrowPhaseSolver>(query, tf_inv);
+      break;
+    case GEOM_CONE:
+      setQueryShape<Cone<S>, BV, NarrowPhaseSolver>(query, tf_inv);
+      break;
+    case GEOM_CYLINDER:
+      setQueryShape<Cylinder<S>, BV, NarrowPhaseSolver>(query, tf_inv);
+      break;
+    case GEOM_CONVEX:
+      setQueryShape<Convex<S>, BV, NarrowPhaseSolver>(query, tf_inv);
+      break;
+    case GEOM_PLANE:
+      setQueryShape<Plane<S>, BV, NarrowPhaseSolver>(query, tf_inv);
+      break;
+    case GEOM_HALFSPACE:
+      setQueryShape<Halfspace<S>, BV, NarrowPhaseSolver>(query, tf_inv);
+      break;
+    default:
+      std::cerr << "Warning: batch collision with node type " << query.shape->getNodeType() << " is not supported" << std::endl;
+      continue;
+    }
+
+    node.queries.push_back(query);
+  }
+
+  return true;
+}
+
+} // namespace detail
+} // namespace fcl
+
+#endif
@@ -0,0 +1,141 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FCL_TRAVERSAL_MESHSHAPEBATCHCOLLISIONTRAVERSALNODE_H
+#define FCL_TRAVERSAL_MESHSHAPEBATCHCOLLISIONTRAVERSALNODE_H
+
+#include <vector>
+
+#include "fcl/common/types.h"
+#include "fcl/math/bv/AABB.h"
+#include "fcl/geometry/bvh/BVH_model.h"
+#include "fcl/narrowphase/collision_request.h"
+#include "fcl/narrowphase/collision_result.h"
+
+namespace fcl
+{
+
+namespace detail
+{
+
+/// @brief Traversal of one mesh against a batch of query geometries. The BVH
+/// of the mesh is traversed once for all the queries: every node visited
+/// keeps the set of queries whose BV overlaps it, like a packet traversal,
+/// and is skipped as soon as this set is empty. The contacts of each query
+/// are those of collide(model, tf, geometry, tf) and are added to its result.
+template <typename BV, typename NarrowPhaseSolver>
+class FCL_EXPORT MeshShapeBatchCollisionTraversalNode
+{
+public:
+
+  using S = typename BV::S;
+
+  /// @brief Intersection test between the shape of a query at the transform
+  /// tf1 and a triangle of the mesh at the transform tf2
+  using IntersectFunc = bool (*)(
+      const CollisionGeometry<S>* shape,
+      const Transform3<S>& tf1,
+      const Vector3<S>& P1,
+      const Vector3<S>& P2,
+      const Vector3<S>& P3,
+      const Transform3<S>& tf2,
+      const NarrowPhaseSolver* nsolver,
+      Vector3<S>* contact_points,
+      S* penetration_depth,
+      Vector3<S>* normal);
+
+  /// @brief A query geometry of the batch
+  struct Query
+  {
+    const CollisionGeometry<S>* shape;
+
+    /// @brief Transform of the shape
+    Transform3<S> tf;
+
+    /// @brief BV of the shape in the frame of the mesh
+    BV bv;
+
+    /// @brief AABB of the shape, for the cost sources
+    AABB<S> aabb;
+
+    IntersectFunc intersect;
+
+    CollisionResult<S>* result;
+  };
+
+  MeshShapeBatchCollisionTraversalNode();
+
+  /// @brief Test all the queries against the mesh
+  void collide() const;
+
+  /// @brief Intersection testing between the triangle of the mesh and the
+  /// shape of a query
+  void leafTesting(int primitive_id, const Query& query) const;
+
+  const BVHModel<BV>* model;
+
+  Transform3<S> tf;
+
+  const NarrowPhaseSolver* nsolver;
+
+  CollisionRequest<S> request;
+
+  aligned_vector<Query> queries;
+};
+
+/// @brief Initialize the traversal of model, at the transform tf, against the
+/// geometries at the transforms tfs. results is resized to the number of
+/// geometries, and the geometries whose result already satisfies the request
+/// are not queried. The geometries that are not shapes supported by the
+/// collision between a mesh and a shape are not queried either. Returns false
+/// if model is not a built triangle mesh.
+template <typename BV, typename NarrowPhaseSolver>
+FCL_EXPORT
+bool initialize(
+    MeshShapeBatchCollisionTraversalNode<BV, NarrowPhaseSolver>& node,
+    const BVHModel<BV>& model,
+    const Transform3<typename BV::S>& tf,
+    const std::vector<const CollisionGeometry<typename BV::S>*>& geometries,
+    const aligned_vector<Transform3<typename BV::S>>& tfs,
+    const NarrowPhaseSolver* nsolver,
+    const CollisionRequest<typename BV::S>& request,
+    std::vector<CollisionResult<typename BV::S>>& results);
+
+} // namespace detail
+} // namespace fcl
+
+#include "fcl/narrowphase/detail/traversal/collision/mesh_shape_batch_collision_traversal_node-inl.h"
+
+#endif
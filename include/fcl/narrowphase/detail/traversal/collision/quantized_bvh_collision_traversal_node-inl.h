@@ -0,0 +1,103 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FCL_TRAVERSAL_QUANTIZEDBVHCOLLISIONTRAVERSALNODE_INL_H
+#define FCL_TRAVERSAL_QUANTIZEDBVHCOLLISIONTRAVERSALNODE_INL_H
+
+#include "fcl/narrowphase/detail/traversal/collision/quantized_bvh_collision_traversal_node.h"
+
+#include "fcl/common/unused.h"
+
+namespace fcl
+{
+
+namespace detail
+{
+
+//==============================================================================
+extern template
+class FCL_EXPORT QuantizedBVHCollisionTraversalNode<double>;
+
+//==============================================================================
+template <typename S>
+QuantizedBVHCollisionTraversalNode<S>::QuantizedBVHCollisionTraversalNode()
+  : CollisionTraversalNodeBase<S>()
+{
+  model1 = nullptr;
+
+  query_time_seconds = 0.0;
+}
+
+//==============================================================================
+template <typename S>
+bool QuantizedBVHCollisionTraversalNode<S>::isFirstNodeLeaf(int b) const
+{
+  return model1->getBV(b).isLeaf();
+}
+
+//==============================================================================
+template <typename S>
+int QuantizedBVHCollisionTraversalNode<S>::getFirstLeftChild(int b) const
+{
+  return model1->getBV(b).leftChild();
+}
+
+//==============================================================================
+template <typename S>
+int QuantizedBVHCollisionTraversalNode<S>::getFirstRightChild(int b) const
+{
+  return model1->getBV(b).rightChild();
+}
+
+//==============================================================================
+template <typename S>
+AABB<S> QuantizedBVHCollisionTraversalNode<S>::getFirstBV(int b, const AABB<S>& parent_bv) const
+{
+  return model1->dequantizeBV(b, parent_bv);
+}
+
+//==============================================================================
+template <typename S>
+AABB<S> QuantizedBVHCollisionTraversalNode<S>::getSecondBV(int b, const AABB<S>& parent_bv) const
+{
+  FCL_UNUSED(b);
+
+  return parent_bv;
+}
+
+} // namespace detail
+} // namespace fcl
+
+#endif
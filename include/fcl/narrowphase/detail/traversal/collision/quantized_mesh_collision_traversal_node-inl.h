@@ -0,0 +1,249 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FCL_TRAVERSAL_QUANTIZEDMESHCOLLISIONTRAVERSALNODE_INL_H
+#define FCL_TRAVERSAL_QUANTIZEDMESHCOLLISIONTRAVERSALNODE_INL_H
+
+#include "fcl/narrowphase/detail/traversal/collision/quantized_mesh_collision_traversal_node.h"
+
+#include "fcl/common/unused.h"
+
+namespace fcl
+{
+
+namespace detail
+{
+
+//==============================================================================
+extern template
+class FCL_EXPORT QuantizedMeshCollisionTraversalNode<double>;
+
+//==============================================================================
+extern template
+bool initialize(
+    QuantizedMeshCollisionTraversalNode<double>& node,
+    const QuantizedBVHModel<double>& model1,
+    const Transform3<double>& tf1,
+    const QuantizedBVHModel<double>& model2,
+    const Transform3<double>& tf2,
+    const CollisionRequest<double>& request,
+    CollisionResult<double>& result);
+
+//==============================================================================
+template <typename S>
+QuantizedMeshCollisionTraversalNode<S>::QuantizedMeshCollisionTraversalNode()
+  : QuantizedBVHCollisionTraversalNode<S>()
+{
+  model2 = nullptr;
+
+  R.setIdentity();
+  T.setZero();
+}
+
+//==============================================================================
+template <typename S>
+bool QuantizedMeshCollisionTraversalNode<S>::isSecondNodeLeaf(int b) const
+{
+  return model2->getBV(b).isLeaf();
+}
+
+//==============================================================================
+template <typename S>
+int QuantizedMeshCollisionTraversalNode<S>::getSecondLeftChild(int b) const
+{
+  return model2->getBV(b).leftChild();
+}
+
+//==============================================================================
+template <typename S>
+int QuantizedMeshCollisionTraversalNode<S>::getSecondRightChild(int b) const
+{
+  return model2->getBV(b).rightChild();
+}
+
+//==============================================================================
+template <typename S>
+AABB<S> QuantizedMeshCollisionTraversalNode<S>::getSecondBV(int b, const AABB<S>& parent_bv) const
+{
+  return model2->dequantizeBV(b, parent_bv);
+}
+
+//==============================================================================
+template <typename S>
+AABB<S> QuantizedMeshCollisionTraversalNode<S>::getSecondRootBV() const
+{
+  return model2->getRootBV();
+}
+
+//==============================================================================
+template <typename S>
+bool QuantizedMeshCollisionTraversalNode<S>::BVTesting(
+    int b1, int b2, const AABB<S>& bv1, const AABB<S>& bv2) const
+{
+  FCL_UNUSED(b1);
+  FCL_UNUSED(b2);
+
+  if(this->enable_statistics) this->num_bv_tests++;
+
+  const Vector3<S> T_center = R * bv2.center() + T - bv1.center();
+  return obbDisjoint(R, T_center,
+                     Vector3<S>((bv1.max_ - bv1.min_) * 0.5),
+                     Vector3<S>((bv2.max_ - bv2.min_) * 0.5));
+}
+
+//==============================================================================
+template <typename S>
+void QuantizedMeshCollisionTraversalNode<S>::leafTesting(int b1, int b2) const
+{
+  if(this->enable_statistics) this->num_leaf_tests++;
+
+  int primitive_id1 = this->model1->getBV(b1).primitiveId();
+  int primitive_id2 = model2->getBV(b2).primitiveId();
+
+  const Triangle& tri_id1 = this->model1->getTriangles()[primitive_id1];
+  const Triangle& tri_id2 = model2->getTriangles()[primitive_id2];
+
+  const Vector3<S>* vertices1 = this->model1->getVertices();
+  const Vector3<S>* vertices2 = model2->getVertices();
+
+  const Vector3<S>& p1 = vertices1[tri_id1[0]];
+  const Vector3<S>& p2 = vertices1[tri_id1[1]];
+  const Vector3<S>& p3 = vertices1[tri_id1[2]];
+  const Vector3<S>& q1 = vertices2[tri_id2[0]];
+  const Vector3<S>& q2 = vertices2[tri_id2[1]];
+  const Vector3<S>& q3 = vertices2[tri_id2[2]];
+
+  const CollisionRequest<S>& request = this->request;
+  CollisionResult<S>& result = *(this->result);
+
+  if(this->model1->isOccupied() && model2->isOccupied())
+  {
+    bool is_intersect = false;
+
+    if(!request.enable_contact) // only interested in collision or not
+    {
+      if(Intersect<S>::intersect_Triangle(p1, p2, p3, q1, q2, q3, R, T))
+      {
+        is_intersect = true;
+        if(result.numContacts() < request.num_max_contacts)
+          result.addContact(Contact<S>(this->model1, model2, primitive_id1, primitive_id2));
+      }
+    }
+    else // need compute the contact information
+    {
+      S penetration;
+      Vector3<S> normal;
+      unsigned int n_contacts;
+      Vector3<S> contacts[2];
+
+      if(Intersect<S>::intersect_Triangle(p1, p2, p3, q1, q2, q3,
+                                          R, T,
+                                          contacts,
+                                          &n_contacts,
+                                          &penetration,
+                                          &normal))
+      {
+        is_intersect = true;
+
+        if(request.num_max_contacts < result.numContacts() + n_contacts)
+          n_contacts = (request.num_max_contacts > result.numContacts()) ? (request.num_max_contacts - result.numContacts()) : 0;
+
+        for(unsigned int i = 0; i < n_contacts; ++i)
+        {
+          result.addContact(Contact<S>(this->model1, model2, primitive_id1, primitive_id2, this->tf1 * contacts[i], this->tf1.linear() * normal, penetration));
+        }
+      }
+    }
+
+    if(is_intersect && request.enable_cost)
+    {
+      AABB<S> overlap_part;
+      AABB<S>(this->tf1 * p1, this->tf1 * p2, this->tf1 * p3).overlap(AABB<S>(this->tf2 * q1, this->tf2 * q2, this->tf2 * q3), overlap_part);
+      result.addCostSource(CostSource<S>(overlap_part, cost_density), request.num_max_cost_sources);
+    }
+  }
+  else if((!this->model1->isFree() && !model2->isFree()) && request.enable_cost)
+  {
+    if(Intersect<S>::intersect_Triangle(p1, p2, p3, q1, q2, q3, R, T))
+    {
+      AABB<S> overlap_part;
+      AABB<S>(this->tf1 * p1, this->tf1 * p2, this->tf1 * p3).overlap(AABB<S>(this->tf2 * q1, this->tf2 * q2, this->tf2 * q3), overlap_part);
+      result.addCostSource(CostSource<S>(overlap_part, cost_density), request.num_max_cost_sources);
+    }
+  }
+}
+
+//==============================================================================
+template <typename S>
+bool QuantizedMeshCollisionTraversalNode<S>::canStop() const
+{
+  return this->request.isSatisfied(*(this->result));
+}
+
+//==============================================================================
+template <typename S>
+bool initialize(
+    QuantizedMeshCollisionTraversalNode<S>& node,
+    const QuantizedBVHModel<S>& model1,
+    const Transform3<S>& tf1,
+    const QuantizedBVHModel<S>& model2,
+    const Transform3<S>& tf2,
+    const CollisionRequest<S>& request,
+    CollisionResult<S>& result)
+{
+  if(model1.getNumBVs() == 0 || model2.getNumBVs() == 0)
+    return false;
+
+  node.model1 = &model1;
+  node.tf1 = tf1;
+  node.model2 = &model2;
+  node.tf2 = tf2;
+
+  node.request = request;
+  node.result = &result;
+
+  node.cost_density = model1.cost_density * model2.cost_density;
+
+  const Transform3<S> tf = tf1.inverse(Eigen::Isometry) * tf2;
+  node.R = tf.linear();
+  node.T = tf.translation();
+
+  return true;
+}
+
+} // namespace detail
+} // namespace fcl
+
+#endif
@@ -0,0 +1,113 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FCL_TRAVERSAL_QUANTIZEDMESHCOLLISIONTRAVERSALNODE_H
+#define FCL_TRAVERSAL_QUANTIZEDMESHCOLLISIONTRAVERSALNODE_H
+
+#include "fcl/narrowphase/contact.h"
+#include "fcl/narrowphase/cost_source.h"
+#include "fcl/narrowphase/detail/traversal/collision/intersect.h"
+#include "fcl/narrowphase/detail/traversal/collision/quantized_bvh_collision_traversal_node.h"
+
+namespace fcl
+{
+
+namespace detail
+{
+
+/// @brief Traversal node for collision between two quantized meshes. The
+/// second mesh stays in its own frame: its boxes are tested against the boxes
+/// of the first mesh as oriented boxes.
+template <typename S>
+class FCL_EXPORT QuantizedMeshCollisionTraversalNode
+    : public QuantizedBVHCollisionTraversalNode<S>
+{
+public:
+  QuantizedMeshCollisionTraversalNode();
+
+  /// @brief Whether the BV node in the second BVH tree is leaf
+  bool isSecondNodeLeaf(int b) const;
+
+  /// @brief Obtain the left child of BV node in the second BVH
+  int getSecondLeftChild(int b) const;
+
+  /// @brief Obtain the right child of BV node in the second BVH
+  int getSecondRightChild(int b) const;
+
+  /// @brief Box of the node b in the second BVH, given the box of its parent
+  AABB<S> getSecondBV(int b, const AABB<S>& parent_bv) const;
+
+  /// @brief Box of the whole second BVH, in its own frame
+  AABB<S> getSecondRootBV() const;
+
+  /// @brief BV culling test in one BVTT node
+  bool BVTesting(int b1, int b2, const AABB<S>& bv1, const AABB<S>& bv2) const;
+
+  /// @brief Intersection testing between leaves (two triangles)
+  void leafTesting(int b1, int b2) const;
+
+  /// @brief Whether the traversal process can stop early
+  bool canStop() const;
+
+  const QuantizedBVHModel<S>* model2;
+
+  /// @brief Rotation of the second mesh in the frame of the first one
+  Matrix3<S> R;
+
+  /// @brief Translation of the second mesh in the frame of the first one
+  Vector3<S> T;
+
+  S cost_density;
+};
+
+/// @brief Initialize traversal node for collision between two quantized
+/// meshes, given the current transforms
+template <typename S>
+FCL_EXPORT
+bool initialize(
+    QuantizedMeshCollisionTraversalNode<S>& node,
+    const QuantizedBVHModel<S>& model1,
+    const Transform3<S>& tf1,
+    const QuantizedBVHModel<S>& model2,
+    const Transform3<S>& tf2,
+    const CollisionRequest<S>& request,
+    CollisionResult<S>& result);
+
+} // namespace detail
+} // namespace fcl
+
+#include "fcl/narrowphase/detail/traversal/collision/quantized_mesh_collision_traversal_node-inl.h"
+
+#endif
@@ -0,0 +1,190 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FCL_TRAVERSAL_QUANTIZEDMESHSHAPECOLLISIONTRAVERSALNODE_INL_H
+#define FCL_TRAVERSAL_QUANTIZEDMESHSHAPECOLLISIONTRAVERSALNODE_INL_H
+
+#include "fcl/narrowphase/detail/traversal/collision/quantized_mesh_shape_collision_traversal_node.h"
+
+#include "fcl/common/unused.h"
+
+namespace fcl
+{
+
+namespace detail
+{
+
+//==============================================================================
+template <typename Shape, typename NarrowPhaseSolver>
+QuantizedMeshShapeCollisionTraversalNode<Shape, NarrowPhaseSolver>::
+QuantizedMeshShapeCollisionTraversalNode()
+  : QuantizedBVHCollisionTraversalNode<typename Shape::S>()
+{
+  model2 = nullptr;
+  nsolver = nullptr;
+}
+
+//==============================================================================
+template <typename Shape, typename NarrowPhaseSolver>
+AABB<typename Shape::S>
+QuantizedMeshShapeCollisionTraversalNode<Shape, NarrowPhaseSolver>::getSecondRootBV() const
+{
+  return model2_bv;
+}
+
+//==============================================================================
+template <typename Shape, typename NarrowPhaseSolver>
+bool QuantizedMeshShapeCollisionTraversalNode<Shape, NarrowPhaseSolver>::BVTesting(
+    int b1, int b2, const AABB<S>& bv1, const AABB<S>& bv2) const
+{
+  FCL_UNUSED(b1);
+  FCL_UNUSED(b2);
+
+  if(this->enable_statistics) this->num_bv_tests++;
+
+  return !bv1.overlap(bv2);
+}
+
+//==============================================================================
+template <typename Shape, typename NarrowPhaseSolver>
+void QuantizedMeshShapeCollisionTraversalNode<Shape, NarrowPhaseSolver>::leafTesting(int b1, int b2) const
+{
+  FCL_UNUSED(b2);
+
+  if(this->enable_statistics) this->num_leaf_tests++;
+
+  int primitive_id = this->model1->getBV(b1).primitiveId();
+
+  const Triangle& tri_id = this->model1->getTriangles()[primitive_id];
+
+  const Vector3<S>* vertices = this->model1->getVertices();
+  const Vector3<S>& p1 = vertices[tri_id[0]];
+  const Vector3<S>& p2 = vertices[tri_id[1]];
+  const Vector3<S>& p3 = vertices[tri_id[2]];
+
+  const CollisionRequest<S>& request = this->request;
+  CollisionResult<S>& result = *(this->result);
+
+  if(this->model1->isOccupied() && model2->isOccupied())
+  {
+    bool is_intersect = false;
+
+    if(!request.enable_contact) // only interested in collision or not
+    {
+      if(nsolver->shapeTriangleIntersect(*model2, this->tf2, p1, p2, p3, this->tf1, nullptr, nullptr, nullptr))
+      {
+        is_intersect = true;
+        if(request.num_max_contacts > result.numContacts())
+          result.addContact(Contact<S>(this->model1, model2, primitive_id, Contact<S>::NONE));
+      }
+    }
+    else
+    {
+      S penetration;
+      Vector3<S> normal;
+      Vector3<S> contactp;
+
+      if(nsolver->shapeTriangleIntersect(*model2, this->tf2, p1, p2, p3, this->tf1, &contactp, &penetration, &normal))
+      {
+        is_intersect = true;
+        if(request.num_max_contacts > result.numContacts())
+          result.addContact(Contact<S>(this->model1, model2, primitive_id, Contact<S>::NONE, contactp, -normal, penetration));
+      }
+    }
+
+    if(is_intersect && request.enable_cost)
+    {
+      AABB<S> overlap_part;
+      AABB<S> shape_aabb;
+      computeBV(*model2, this->tf2, shape_aabb);
+      AABB<S>(this->tf1 * p1, this->tf1 * p2, this->tf1 * p3).overlap(shape_aabb, overlap_part);
+      result.addCostSource(CostSource<S>(overlap_part, cost_density), request.num_max_cost_sources);
+    }
+  }
+  else if((!this->model1->isFree() || model2->isFree()) && request.enable_cost)
+  {
+    if(nsolver->shapeTriangleIntersect(*model2, this->tf2, p1, p2, p3, this->tf1, nullptr, nullptr, nullptr))
+    {
+      AABB<S> overlap_part;
+      AABB<S> shape_aabb;
+      computeBV(*model2, this->tf2, shape_aabb);
+      AABB<S>(this->tf1 * p1, this->tf1 * p2, this->tf1 * p3).overlap(shape_aabb, overlap_part);
+      result.addCostSource(CostSource<S>(overlap_part, cost_density), request.num_max_cost_sources);
+    }
+  }
+}
+
+//==============================================================================
+template <typename Shape, typename NarrowPhaseSolver>
+bool QuantizedMeshShapeCollisionTraversalNode<Shape, NarrowPhaseSolver>::canStop() const
+{
+  return this->request.isSatisfied(*(this->result));
+}
+
+//==============================================================================
+template <typename Shape, typename NarrowPhaseSolver>
+bool initialize(
+    QuantizedMeshShapeCollisionTraversalNode<Shape, NarrowPhaseSolver>& node,
+    const QuantizedBVHModel<typename Shape::S>& model1,
+    const Transform3<typename Shape::S>& tf1,
+    const Shape& model2,
+    const Transform3<typename Shape::S>& tf2,
+    const NarrowPhaseSolver* nsolver,
+    const CollisionRequest<typename Shape::S>& request,
+    CollisionResult<typename Shape::S>& result)
+{
+  if(model1.getNumBVs() == 0)
+    return false;
+
+  node.model1 = &model1;
+  node.tf1 = tf1;
+  node.model2 = &model2;
+  node.tf2 = tf2;
+  node.nsolver = nsolver;
+
+  computeBV(model2, tf1.inverse(Eigen::Isometry) * tf2, node.model2_bv);
+
+  node.request = request;
+  node.result = &result;
+
+  node.cost_density = model1.cost_density * model2.cost_density;
+
+  return true;
+}
+
+} // namespace detail
+} // namespace fcl
+
+#endif
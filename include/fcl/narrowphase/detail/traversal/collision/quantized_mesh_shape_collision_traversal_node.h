@@ -0,0 +1,103 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FCL_TRAVERSAL_QUANTIZEDMESHSHAPECOLLISIONTRAVERSALNODE_H
+#define FCL_TRAVERSAL_QUANTIZEDMESHSHAPECOLLISIONTRAVERSALNODE_H
+
+#include "fcl/geometry/shape/utility.h"
+#include "fcl/narrowphase/contact.h"
+#include "fcl/narrowphase/cost_source.h"
+#include "fcl/narrowphase/detail/traversal/collision/quantized_bvh_collision_traversal_node.h"
+
+namespace fcl
+{
+
+namespace detail
+{
+
+/// @brief Traversal node for collision between a quantized mesh and a shape.
+/// The shape is bounded by an AABB in the frame of the mesh.
+template <typename Shape, typename NarrowPhaseSolver>
+class FCL_EXPORT QuantizedMeshShapeCollisionTraversalNode
+    : public QuantizedBVHCollisionTraversalNode<typename Shape::S>
+{
+public:
+
+  using S = typename Shape::S;
+
+  QuantizedMeshShapeCollisionTraversalNode();
+
+  /// @brief Box of the shape, in the frame of the mesh
+  AABB<S> getSecondRootBV() const;
+
+  /// @brief BV culling test in one BVTT node
+  bool BVTesting(int b1, int b2, const AABB<S>& bv1, const AABB<S>& bv2) const;
+
+  /// @brief Intersection testing between leaves (one triangle and one shape)
+  void leafTesting(int b1, int b2) const;
+
+  /// @brief Whether the traversal process can stop early
+  bool canStop() const;
+
+  const Shape* model2;
+
+  /// @brief Box of the shape, in the frame of the mesh
+  AABB<S> model2_bv;
+
+  S cost_density;
+
+  const NarrowPhaseSolver* nsolver;
+};
+
+/// @brief Initialize traversal node for collision between one quantized mesh
+/// and one shape, given the current transforms
+template <typename Shape, typename NarrowPhaseSolver>
+FCL_EXPORT
+bool initialize(
+    QuantizedMeshShapeCollisionTraversalNode<Shape, NarrowPhaseSolver>& node,
+    const QuantizedBVHModel<typename Shape::S>& model1,
+    const Transform3<typename Shape::S>& tf1,
+    const Shape& model2,
+    const Transform3<typename Shape::S>& tf2,
+    const NarrowPhaseSolver* nsolver,
+    const CollisionRequest<typename Shape::S>& request,
+    CollisionResult<typename Shape::S>& result);
+
+} // namespace detail
+} // namespace fcl
+
+#include "fcl/narrowphase/detail/traversal/collision/quantized_mesh_shape_collision_traversal_node-inl.h"
+
+#endif
@@ -56,8 +56,6 @@ ShapeBVHCollisionTraversalNode<Shape, BV>::ShapeBVHCollisionTraversalNode()
   model1 = nullptr;
   model2 = nullptr;
 
-  num_bv_tests = 0;
-  num_leaf_tests = 0;
   query_time_seconds = 0.0;
 }
 
@@ -95,7 +93,7 @@ bool ShapeBVHCollisionTraversalNode<Shape, BV>::BVTesting(int b1, int b2) const
 {
   FCL_UNUSED(b1);
 
-  if(this->enable_statistics) num_bv_tests++;
+  if(this->enable_statistics) this->num_bv_tests++;
   return !model2->getBV(b2).bv.overlap(model1_bv);
 }
 
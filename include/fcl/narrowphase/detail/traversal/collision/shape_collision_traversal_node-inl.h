@@ -71,6 +71,8 @@ template <typename Shape1, typename Shape2, typename NarrowPhaseSolver>
 void ShapeCollisionTraversalNode<Shape1, Shape2, NarrowPhaseSolver>::
 leafTesting(int, int) const
 {
+  if(this->enable_statistics) this->num_leaf_tests++;
+
   if(model1->isOccupied() && model2->isOccupied())
   {
     bool is_collision = false;
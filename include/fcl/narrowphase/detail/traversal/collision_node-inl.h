@@ -40,6 +40,12 @@
 
 #include "fcl/narrowphase/detail/traversal/collision_node.h"
 
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+#include "fcl/common/detail/work_stealing_pool.h"
+
 /// @brief collision and distance function on traversal nodes. these functions provide a higher level abstraction for collision functions provided in collision_func_matrix
 namespace fcl
 {
@@ -59,6 +65,14 @@ void selfCollide(CollisionTraversalNodeBase<double>* node, BVHFrontList* front_l
 extern template
 void distance(DistanceTraversalNodeBase<double>* node, BVHFrontList* front_list, int qsize);
 
+//==============================================================================
+extern template
+void collide(QuantizedBVHCollisionTraversalNode<double>* node);
+
+//==============================================================================
+extern template
+void distance(QuantizedBVHDistanceTraversalNode<double>* node);
+
 //==============================================================================
 extern template
 void collide2(MeshCollisionTraversalNodeOBB<double>* node, BVHFrontList* front_list);
@@ -81,6 +95,360 @@ void collide(CollisionTraversalNodeBase<S>* node, BVHFrontList* front_list)
   }
 }
 
+//==============================================================================
+template <typename S>
+void collide(QuantizedBVHCollisionTraversalNode<S>* node)
+{
+  const AABB<S> bv1 = node->getFirstBV(0, node->model1->getRootBV());
+  const AABB<S> bv2 = node->getSecondBV(0, node->getSecondRootBV());
+
+  collisionRecurse(node, 0, 0, bv1, bv2);
+}
+
+//==============================================================================
+template <typename S>
+void distance(QuantizedBVHDistanceTraversalNode<S>* node)
+{
+  node->preprocess();
+
+  const AABB<S> bv1 = node->getFirstBV(0, node->model1->getRootBV());
+  const AABB<S> bv2 = node->getSecondBV(0, node->getSecondRootBV());
+
+  distanceRecurse(node, 0, 0, bv1, bv2);
+
+  node->postprocess();
+}
+
+//==============================================================================
+template <typename NodeType>
+void collideStatic(NodeType* node)
+{
+  collisionRecurseStatic(node, 0, 0);
+}
+
+//==============================================================================
+template <typename NodeType>
+void distanceStatic(NodeType* node)
+{
+  node->NodeType::preprocess();
+
+  distanceRecurseStatic(node, 0, 0);
+
+  node->NodeType::postprocess();
+}
+
+//==============================================================================
+template <typename NodeType>
+void collideCached(
+    NodeType* node,
+    QueryCache<typename NodeType::S>* cache,
+    const CollisionGeometry<typename NodeType::S>* o1,
+    const CollisionGeometry<typename NodeType::S>* o2)
+{
+  if(cache)
+  {
+    BVHFrontList* front_list = cache->getFrontList(o1, o2, false);
+    collide(node, front_list);
+    if(node->enable_statistics)
+      node->front_size = static_cast<int>(front_list->size());
+  }
+  else
+    collideStatic(node);
+}
+
+//==============================================================================
+template <typename NodeType>
+void distanceBestFirst(NodeType* node, std::size_t queue_size)
+{
+  node->NodeType::preprocess();
+
+  distanceBestFirstRecurseStatic(node, 0, 0, queue_size);
+
+  node->NodeType::postprocess();
+}
+
+//==============================================================================
+template <typename NodeType>
+void distanceCached(
+    NodeType* node,
+    QueryCache<typename NodeType::S>* cache,
+    const CollisionGeometry<typename NodeType::S>* o1,
+    const CollisionGeometry<typename NodeType::S>* o2,
+    std::size_t best_first_queue_size)
+{
+  if(cache)
+  {
+    BVHFrontList* front_list = cache->getFrontList(o1, o2, true);
+    distance(node, front_list);
+    if(node->enable_statistics)
+      node->front_size = static_cast<int>(front_list->size());
+  }
+  else if(best_first_queue_size > 0)
+    distanceBestFirst(node, best_first_queue_size);
+  else
+    distanceStatic(node);
+}
+
+//==============================================================================
+template <typename NodeType>
+void collideParallel(NodeType* node, unsigned int num_threads)
+{
+  using S = typename NodeType::S;
+
+  const WorkStealingPool pool(num_threads);
+
+  // Expand the BVTT level by level, keeping the pairs in the order of a depth
+  // first traversal, until there are enough pairs to balance the threads
+  const std::size_t min_num_pairs = 16 * pool.numThreads();
+  std::vector<BVTTPair<S>> pairs(1, BVTTPair<S>{0, 0, 0});
+  std::vector<BVTTPair<S>> next_pairs;
+  bool expanded = true;
+  while(expanded && pairs.size() < min_num_pairs)
+  {
+    expanded = false;
+    next_pairs.clear();
+
+    for(const BVTTPair<S>& pair : pairs)
+      expanded |= expandCollisionPair(node, pair, next_pairs);
+
+    pairs.swap(next_pairs);
+  }
+
+  std::vector<CollisionResult<S>> results(pairs.size());
+  pool.run(pairs.size(), [&](std::size_t i)
+  {
+    NodeType local_node(*node);
+    local_node.result = &results[i];
+    local_node.resetStatistics();
+    collisionRecurseStatic(&local_node, pairs[i].b1, pairs[i].b2);
+    results[i].statistics = local_node.getStatistics();
+  });
+
+  for(const CollisionResult<S>& result : results)
+    node->addStatistics(result.statistics);
+
+  mergeCollisionResults(results, node->request, *node->result);
+}
+
+//==============================================================================
+template <typename NodeType>
+void distanceParallel(NodeType* node, unsigned int num_threads)
+{
+  using S = typename NodeType::S;
+
+  const WorkStealingPool pool(num_threads);
+
+  node->NodeType::preprocess();
+
+  // Expand the BVTT level by level like collideParallel(), with the pairs
+  // that cannot improve the distance found so far pruned
+  const std::size_t min_num_pairs = 16 * pool.numThreads();
+  std::vector<BVTTPair<S>> pairs(1, BVTTPair<S>{0, 0, node->NodeType::BVTesting(0, 0)});
+  std::vector<BVTTPair<S>> next_pairs;
+  bool expanded = true;
+  while(expanded && pairs.size() < min_num_pairs)
+  {
+    expanded = false;
+    next_pairs.clear();
+
+    for(const BVTTPair<S>& pair : pairs)
+    {
+      if(node->NodeType::isFirstNodeLeaf(pair.b1)
+         && node->NodeType::isSecondNodeLeaf(pair.b2))
+      {
+        next_pairs.push_back(pair);
+        continue;
+      }
+
+      if(node->NodeType::canStop(pair.bound)) continue;
+
+      if(node->NodeType::proxyTesting(pair.b1, pair.b2)) continue;
+
+      expanded = true;
+      BVTTPair<S> a;
+      BVTTPair<S> c;
+      if(node->NodeType::firstOverSecond(pair.b1, pair.b2))
+      {
+        a = {node->NodeType::getFirstLeftChild(pair.b1), pair.b2, 0};
+        c = {node->NodeType::getFirstRightChild(pair.b1), pair.b2, 0};
+      }
+      else
+      {
+        a = {pair.b1, node->NodeType::getSecondLeftChild(pair.b2), 0};
+        c = {pair.b1, node->NodeType::getSecondRightChild(pair.b2), 0};
+      }
+      a.bound = node->NodeType::BVTesting(a.b1, a.b2);
+      c.bound = node->NodeType::BVTesting(c.b1, c.b2);
+      next_pairs.push_back(a);
+      next_pairs.push_back(c);
+    }
+
+    pairs.swap(next_pairs);
+  }
+
+  // The closest pairs are traversed first, so that they prune the others
+  std::stable_sort(pairs.begin(), pairs.end(),
+                   [](const BVTTPair<S>& a, const BVTTPair<S>& c) { return a.bound < c.bound; });
+
+  // Each traversal starts from the smallest distance found by the threads
+  // so far, and publishes the distance it finds
+  std::atomic<S> min_distance(node->result->min_distance);
+  std::vector<DistanceResult<S>> results(pairs.size());
+  pool.run(pairs.size(), [&](std::size_t i)
+  {
+    NodeType local_node(*node);
+    results[i].min_distance = min_distance.load();
+    local_node.result = &results[i];
+    local_node.resetStatistics();
+
+    if(local_node.NodeType::canStop(pairs[i].bound)) return;
+
+    distanceRecurseStatic(&local_node, pairs[i].b1, pairs[i].b2);
+    results[i].statistics = local_node.getStatistics();
+
+    // Only the traversals that improved the distance set the geometries
+    if(!results[i].o1) return;
+
+    S current = min_distance.load();
+    while(results[i].min_distance < current
+          && !min_distance.compare_exchange_weak(current, results[i].min_distance))
+    {
+      // Do nothing
+    }
+  });
+
+  // The results are merged in the order of the pairs, so that the nearest
+  // points do not depend on the scheduling of the threads
+  for(const DistanceResult<S>& result : results)
+  {
+    node->addStatistics(result.statistics);
+    if(result.o1) node->result->update(result);
+  }
+
+  node->NodeType::postprocess();
+}
+
+//==============================================================================
+template <typename NodeType>
+void selfCollideStatic(NodeType* node)
+{
+  selfCollisionRecurseStatic(node, 0);
+}
+
+//==============================================================================
+template <typename NodeType>
+void selfCollideParallel(NodeType* node, unsigned int num_threads)
+{
+  using S = typename NodeType::S;
+
+  const WorkStealingPool pool(num_threads);
+
+  // A pair (b, b) stands for the self collision of the subtree b. It is
+  // replaced by the self collisions of the children of b followed by the
+  // collision between them, which keeps the order of selfCollideStatic().
+  const std::size_t min_num_pairs = 16 * pool.numThreads();
+  std::vector<BVTTPair<S>> pairs(1, BVTTPair<S>{0, 0, 0});
+  std::vector<BVTTPair<S>> next_pairs;
+  bool expanded = true;
+  while(expanded && pairs.size() < min_num_pairs)
+  {
+    expanded = false;
+    next_pairs.clear();
+
+    for(const BVTTPair<S>& pair : pairs)
+    {
+      if(pair.b1 != pair.b2)
+      {
+        expanded |= expandCollisionPair(node, pair, next_pairs);
+        continue;
+      }
+
+      if(node->NodeType::isFirstNodeLeaf(pair.b1)) continue;
+
+      if(node->NodeType::selfBVTesting(pair.b1)) continue;
+
+      expanded = true;
+      int c1 = node->NodeType::getFirstLeftChild(pair.b1);
+      int c2 = node->NodeType::getFirstRightChild(pair.b1);
+      next_pairs.push_back({c1, c1, 0});
+      next_pairs.push_back({c2, c2, 0});
+      next_pairs.push_back({c1, c2, 0});
+    }
+
+    pairs.swap(next_pairs);
+  }
+
+  std::vector<CollisionResult<S>> results(pairs.size());
+  pool.run(pairs.size(), [&](std::size_t i)
+  {
+    NodeType local_node(*node);
+    local_node.result = &results[i];
+    local_node.resetStatistics();
+    if(pairs[i].b1 == pairs[i].b2)
+      selfCollisionRecurseStatic(&local_node, pairs[i].b1);
+    else
+      collisionRecurseStatic(&local_node, pairs[i].b1, pairs[i].b2);
+    results[i].statistics = local_node.getStatistics();
+  });
+
+  for(const CollisionResult<S>& result : results)
+    node->addStatistics(result.statistics);
+
+  mergeCollisionResults(results, node->request, *node->result);
+}
+
+//==============================================================================
+template <typename NodeType>
+bool expandCollisionPair(
+    NodeType* node,
+    const BVTTPair<typename NodeType::S>& pair,
+    std::vector<BVTTPair<typename NodeType::S>>& pairs)
+{
+  if(node->NodeType::isFirstNodeLeaf(pair.b1)
+     && node->NodeType::isSecondNodeLeaf(pair.b2))
+  {
+    pairs.push_back(pair);
+    return false;
+  }
+
+  if(node->NodeType::BVTesting(pair.b1, pair.b2)) return false;
+
+  if(node->NodeType::firstOverSecond(pair.b1, pair.b2))
+  {
+    pairs.push_back({node->NodeType::getFirstLeftChild(pair.b1), pair.b2, 0});
+    pairs.push_back({node->NodeType::getFirstRightChild(pair.b1), pair.b2, 0});
+  }
+  else
+  {
+    pairs.push_back({pair.b1, node->NodeType::getSecondLeftChild(pair.b2), 0});
+    pairs.push_back({pair.b1, node->NodeType::getSecondRightChild(pair.b2), 0});
+  }
+
+  return true;
+}
+
+//==============================================================================
+template <typename S>
+void mergeCollisionResults(
+    std::vector<CollisionResult<S>>& results,
+    const CollisionRequest<S>& request,
+    CollisionResult<S>& result)
+{
+  std::vector<CostSource<S>> cost_sources;
+  for(CollisionResult<S>& task_result : results)
+  {
+    for(std::size_t i = 0; i < task_result.numContacts(); ++i)
+    {
+      if(result.numContacts() >= request.num_max_contacts) break;
+      result.addContact(task_result.getContact(i));
+    }
+
+    task_result.getCostSources(cost_sources);
+    for(const CostSource<S>& cost_source : cost_sources)
+      result.addCostSource(cost_source, request.num_max_cost_sources);
+  }
+}
+
 //==============================================================================
 template <typename S>
 void collide2(MeshCollisionTraversalNodeOBB<S>* node, BVHFrontList* front_list)
@@ -138,7 +506,9 @@ void distance(DistanceTraversalNodeBase<S>* node, BVHFrontList* front_list, int
 {
   node->preprocess();
 
-  if(qsize <= 2)
+  if(front_list && front_list->size() > 0)
+    propagateBVHFrontListDistanceRecurse(node, front_list);
+  else if(qsize <= 2)
     distanceRecurse(node, 0, 0, front_list);
   else
     distanceQueueRecurse(node, 0, 0, front_list, qsize);
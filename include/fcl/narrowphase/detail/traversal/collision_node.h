@@ -39,6 +39,7 @@
 #define FCL_COLLISION_NODE_H
 
 #include "fcl/geometry/bvh/detail/BVH_front.h"
+#include "fcl/narrowphase/query_cache.h"
 #include "fcl/narrowphase/detail/traversal/traversal_recurse.h"
 #include "fcl/narrowphase/detail/traversal/collision/collision_traversal_node_base.h"
 #include "fcl/narrowphase/detail/traversal/collision/mesh_collision_traversal_node.h"
@@ -66,6 +67,115 @@ template <typename S>
 FCL_EXPORT
 void distance(DistanceTraversalNodeBase<S>* node, BVHFrontList* front_list = nullptr, int qsize = 2);
 
+/// @brief collision on quantized BVH traversal node; front lists are not
+/// supported since the boxes are decoded along the traversal
+template <typename S>
+FCL_EXPORT
+void collide(QuantizedBVHCollisionTraversalNode<S>* node);
+
+/// @brief distance computation on quantized BVH traversal node
+template <typename S>
+FCL_EXPORT
+void distance(QuantizedBVHDistanceTraversalNode<S>* node);
+
+/// @brief collision on a traversal node of the concrete type NodeType,
+/// without virtual calls. Used by the collision function matrix, which always
+/// knows the exact node type; see collisionRecurseStatic().
+template <typename NodeType>
+FCL_EXPORT
+void collideStatic(NodeType* node);
+
+/// @brief distance computation on a traversal node of the concrete type
+/// NodeType, without virtual calls; see distanceRecurseStatic().
+template <typename NodeType>
+FCL_EXPORT
+void distanceStatic(NodeType* node);
+
+/// @brief collision on a traversal node of the concrete type NodeType between
+/// o1 and o2. When cache is not nullptr, the traversal starts from the front
+/// stored in the cache and updates it; otherwise it is collideStatic().
+template <typename NodeType>
+FCL_EXPORT
+void collideCached(
+    NodeType* node,
+    QueryCache<typename NodeType::S>* cache,
+    const CollisionGeometry<typename NodeType::S>* o1,
+    const CollisionGeometry<typename NodeType::S>* o2);
+
+/// @brief best first distance computation on a traversal node of the
+/// concrete type NodeType, with at most queue_size node pairs waiting in the
+/// priority queue; see distanceBestFirstRecurseStatic().
+template <typename NodeType>
+FCL_EXPORT
+void distanceBestFirst(NodeType* node, std::size_t queue_size);
+
+/// @brief distance computation on a traversal node of the concrete type
+/// NodeType between o1 and o2, seeded by cache like collideCached(). Without
+/// cache, the traversal is distanceBestFirst() if best_first_queue_size is not
+/// 0, and distanceStatic() otherwise.
+template <typename NodeType>
+FCL_EXPORT
+void distanceCached(
+    NodeType* node,
+    QueryCache<typename NodeType::S>* cache,
+    const CollisionGeometry<typename NodeType::S>* o1,
+    const CollisionGeometry<typename NodeType::S>* o2,
+    std::size_t best_first_queue_size = 0);
+
+/// @brief collision on a traversal node of the concrete type NodeType, with
+/// the BVTT traversed by num_threads threads (0 means one per hardware
+/// thread). The BVTT is expanded breadth first to a set of independent node
+/// pairs, which are traversed by a WorkStealingPool, each on its own copy of
+/// the node and result. The contacts are then merged in the order of a
+/// sequential traversal, so the result is the same as collideStatic().
+template <typename NodeType>
+FCL_EXPORT
+void collideParallel(NodeType* node, unsigned int num_threads);
+
+/// @brief distance computation on a traversal node of the concrete type
+/// NodeType, with the BVTT traversed by num_threads threads like
+/// collideParallel(). The node pairs are traversed from the closest to the
+/// farthest, and each traversal is pruned against the smallest distance found
+/// by all the threads when it starts.
+template <typename NodeType>
+FCL_EXPORT
+void distanceParallel(NodeType* node, unsigned int num_threads);
+
+/// @brief self collision on a traversal node of the concrete type NodeType,
+/// without virtual calls; see selfCollisionRecurseStatic().
+template <typename NodeType>
+FCL_EXPORT
+void selfCollideStatic(NodeType* node);
+
+/// @brief self collision on a traversal node of the concrete type NodeType,
+/// with num_threads threads like collideParallel(). The self collision of a
+/// subtree is expanded into the self collisions of its two children and the
+/// collision between them, so the result is the same as selfCollideStatic().
+template <typename NodeType>
+FCL_EXPORT
+void selfCollideParallel(NodeType* node, unsigned int num_threads);
+
+/// @brief One expansion step of the parallel collision traversals on the node
+/// pair of the concrete node type NodeType: appends to pairs the child pairs
+/// of pair, or pair itself if it is a pair of leaves, unless the BVs of pair
+/// are disjoint. Returns true if pair was split.
+template <typename NodeType>
+FCL_EXPORT
+bool expandCollisionPair(
+    NodeType* node,
+    const BVTTPair<typename NodeType::S>& pair,
+    std::vector<BVTTPair<typename NodeType::S>>& pairs);
+
+/// @brief Appends the contacts and cost sources of results, in order, to
+/// result, within the limits of request. Used by the parallel traversals to
+/// merge the results of their tasks.
+template <typename S>
+FCL_EXPORT
+void mergeCollisionResults(
+    std::vector<CollisionResult<S>>& results,
+    const CollisionRequest<S>& request,
+    CollisionResult<S>& result);
+
 /// @brief special collision on OBB traversal node
 template <typename S>
 FCL_EXPORT
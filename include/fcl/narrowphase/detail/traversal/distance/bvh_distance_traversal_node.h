@@ -89,8 +89,6 @@ public:
   const BVHModel<BV>* model2;
 
   /// @brief statistical information
-  mutable int num_bv_tests;
-  mutable int num_leaf_tests;
   mutable S query_time_seconds;
 };
 
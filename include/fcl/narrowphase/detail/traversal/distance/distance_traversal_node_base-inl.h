@@ -87,6 +87,16 @@ void DistanceTraversalNodeBase<S>::leafTesting(int b1, int b2) const
   // Do nothing
 }
 
+//==============================================================================
+template <typename S>
+bool DistanceTraversalNodeBase<S>::proxyTesting(int b1, int b2) const
+{
+  FCL_UNUSED(b1);
+  FCL_UNUSED(b2);
+
+  return false;
+}
+
 //==============================================================================
 template <typename S>
 bool DistanceTraversalNodeBase<S>::canStop(S c) const
@@ -63,6 +63,12 @@ public:
   /// @brief Leaf test between node b1 and b2, if they are both leafs
   virtual void leafTesting(int b1, int b2) const;
 
+  /// @brief Approximate the distance between node b1 and b2 by their
+  /// level-of-detail proxies. Return true if the proxies are accurate enough
+  /// for the request, in which case the pair does not need to be traversed
+  /// further
+  virtual bool proxyTesting(int b1, int b2) const;
+
   /// @brief Check whether the traversal can stop
   virtual bool canStop(S c) const;
 
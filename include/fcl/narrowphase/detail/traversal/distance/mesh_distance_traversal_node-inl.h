@@ -143,6 +143,23 @@ void MeshDistanceTraversalNode<BV>::leafTesting(int b1, int b2) const
   }
 }
 
+//==============================================================================
+template <typename BV>
+bool MeshDistanceTraversalNode<BV>::proxyTesting(int b1, int b2) const
+{
+  // The vertices of both models have been transformed into the world frame
+  return detail::meshDistanceNodeProxyTesting(
+        b1,
+        b2,
+        this->model1,
+        this->model2,
+        vertices1,
+        vertices2,
+        Transform3<S>::Identity(),
+        this->request,
+        *this->result);
+}
+
 //==============================================================================
 template <typename BV>
 bool MeshDistanceTraversalNode<BV>::canStop(typename BV::S c) const
@@ -259,6 +276,22 @@ void MeshDistanceTraversalNodeRSS<S>::postprocess()
         *this->result);
 }
 
+//==============================================================================
+template <typename S>
+bool MeshDistanceTraversalNodeRSS<S>::proxyTesting(int b1, int b2) const
+{
+  return detail::meshDistanceNodeProxyTesting(
+        b1,
+        b2,
+        this->model1,
+        this->model2,
+        this->vertices1,
+        this->vertices2,
+        tf,
+        this->request,
+        *this->result);
+}
+
 //==============================================================================
 template <typename S>
 void MeshDistanceTraversalNodeRSS<S>::leafTesting(int b1, int b2) const
@@ -318,6 +351,22 @@ void MeshDistanceTraversalNodekIOS<S>::postprocess()
         *this->result);
 }
 
+//==============================================================================
+template <typename S>
+bool MeshDistanceTraversalNodekIOS<S>::proxyTesting(int b1, int b2) const
+{
+  return detail::meshDistanceNodeProxyTesting(
+        b1,
+        b2,
+        this->model1,
+        this->model2,
+        this->vertices1,
+        this->vertices2,
+        tf,
+        this->request,
+        *this->result);
+}
+
 //==============================================================================
 template <typename S>
 void MeshDistanceTraversalNodekIOS<S>::leafTesting(int b1, int b2) const
@@ -377,6 +426,22 @@ void MeshDistanceTraversalNodeOBBRSS<S>::postprocess()
         *this->result);
 }
 
+//==============================================================================
+template <typename S>
+bool MeshDistanceTraversalNodeOBBRSS<S>::proxyTesting(int b1, int b2) const
+{
+  return detail::meshDistanceNodeProxyTesting(
+        b1,
+        b2,
+        this->model1,
+        this->model2,
+        this->vertices1,
+        this->vertices2,
+        tf,
+        this->request,
+        *this->result);
+}
+
 //==============================================================================
 template <typename S>
 void MeshDistanceTraversalNodeOBBRSS<S>::leafTesting(int b1, int b2) const
@@ -585,6 +650,44 @@ void distancePreprocessOrientedNode(
     result.update(distance, model1, model2, init_tri_id1, init_tri_id2);
 }
 
+//==============================================================================
+template <typename BV>
+bool meshDistanceNodeProxyTesting(
+    int b1,
+    int b2,
+    const BVHModel<BV>* model1,
+    const BVHModel<BV>* model2,
+    const Vector3<typename BV::S>* vertices1,
+    const Vector3<typename BV::S>* vertices2,
+    const Transform3<typename BV::S>& tf,
+    const DistanceRequest<typename BV::S>& request,
+    DistanceResult<typename BV::S>& result)
+{
+  using S = typename BV::S;
+
+  if(request.lod_tolerance <= 0
+     || !model1->hasLODProxies() || !model2->hasLODProxies())
+    return false;
+
+  const BVNodeProxy<S>& proxy1 = model1->getLODProxy(b1);
+  const BVNodeProxy<S>& proxy2 = model2->getLODProxy(b2);
+
+  if(proxy1.radius + proxy2.radius > request.lod_tolerance)
+    return false;
+
+  const Vector3<S>& P1 = vertices1[proxy1.vertex];
+  const Vector3<S> P2 = tf * vertices2[proxy2.vertex];
+
+  const S d = (P1 - P2).norm();
+
+  if(request.enable_nearest_points)
+    result.update(d, model1, model2, proxy1.primitive, proxy2.primitive, P1, P2);
+  else
+    result.update(d, model1, model2, proxy1.primitive, proxy2.primitive);
+
+  return true;
+}
+
 //==============================================================================
 template <typename BV>
 void distancePostprocessOrientedNode(
@@ -63,6 +63,10 @@ public:
   /// @brief Distance testing between leaves (two triangles)
   void leafTesting(int b1, int b2) const;
 
+  /// @brief Distance testing between the level-of-detail proxies of two
+  /// nodes, if they are within DistanceRequest::lod_tolerance
+  bool proxyTesting(int b1, int b2) const;
+
   /// @brief Whether the traversal process can stop early
   bool canStop(S c) const;
 
@@ -112,6 +116,8 @@ public:
 
   void leafTesting(int b1, int b2) const;
 
+  bool proxyTesting(int b1, int b2) const;
+
   Transform3<S> tf;
 
   EIGEN_MAKE_ALIGNED_OPERATOR_NEW
@@ -153,6 +159,8 @@ public:
 
   void leafTesting(int b1, int b2) const;
 
+  bool proxyTesting(int b1, int b2) const;
+
   Transform3<S> tf;
 
   EIGEN_MAKE_ALIGNED_OPERATOR_NEW
@@ -194,6 +202,8 @@ public:
 
   void leafTesting(int b1, int b2) const;
 
+  bool proxyTesting(int b1, int b2) const;
+
   Transform3<S> tf;
 
   EIGEN_MAKE_ALIGNED_OPERATOR_NEW
@@ -250,6 +260,23 @@ void meshDistanceOrientedNodeLeafTesting(
     const DistanceRequest<typename BV::S>& request,
     DistanceResult<typename BV::S>& result);
 
+/// @brief Distance testing between the level-of-detail proxies of node b1 and
+/// b2; tf maps the vertices of model2 into the frame of the vertices of
+/// model1. Return false if the models have no proxies or if the proxies are
+/// not within DistanceRequest::lod_tolerance
+template <typename BV>
+FCL_EXPORT
+bool meshDistanceNodeProxyTesting(
+    int b1,
+    int b2,
+    const BVHModel<BV>* model1,
+    const BVHModel<BV>* model2,
+    const Vector3<typename BV::S>* vertices1,
+    const Vector3<typename BV::S>* vertices2,
+    const Transform3<typename BV::S>& tf,
+    const DistanceRequest<typename BV::S>& request,
+    DistanceResult<typename BV::S>& result);
+
 template <typename BV>
 FCL_EXPORT
 void distancePreprocessOrientedNode(
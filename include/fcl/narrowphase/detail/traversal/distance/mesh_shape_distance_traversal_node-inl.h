@@ -111,7 +111,7 @@ template <typename BV, typename Shape, typename NarrowPhaseSolver>
 bool initialize(
     MeshShapeDistanceTraversalNode<BV, Shape, NarrowPhaseSolver>& node,
     BVHModel<BV>& model1,
-    Transform3<typename Shape::S>& tf1,
+    Transform3<typename BV::S>& tf1,
     const Shape& model2,
     const Transform3<typename BV::S>& tf2,
     const NarrowPhaseSolver* nsolver,
@@ -0,0 +1,93 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FCL_TRAVERSAL_QUANTIZEDBVHDISTANCETRAVERSALNODE_H
+#define FCL_TRAVERSAL_QUANTIZEDBVHDISTANCETRAVERSALNODE_H
+
+#include "fcl/narrowphase/detail/traversal/distance/distance_traversal_node_base.h"
+#include "fcl/geometry/bvh/BVH_quantized_model.h"
+
+namespace fcl
+{
+
+namespace detail
+{
+
+/// @brief Traversal node for distance computation between a
+/// QuantizedBVHModel and another object. As for
+/// QuantizedBVHCollisionTraversalNode, the dequantized boxes are carried along
+/// the traversal; use distance() on this node type rather than the generic
+/// traversal.
+template <typename S>
+class FCL_EXPORT QuantizedBVHDistanceTraversalNode
+    : public DistanceTraversalNodeBase<S>
+{
+public:
+  QuantizedBVHDistanceTraversalNode();
+
+  /// @brief Whether the BV node in the first BVH tree is leaf
+  bool isFirstNodeLeaf(int b) const;
+
+  /// @brief Obtain the left child of BV node in the first BVH
+  int getFirstLeftChild(int b) const;
+
+  /// @brief Obtain the right child of BV node in the first BVH
+  int getFirstRightChild(int b) const;
+
+  /// @brief Box of the node b in the first BVH, given the box of its parent
+  AABB<S> getFirstBV(int b, const AABB<S>& parent_bv) const;
+
+  /// @brief Box of the node b in the second object, given the box of its
+  /// parent. The second object is a single node by default.
+  virtual AABB<S> getSecondBV(int b, const AABB<S>& parent_bv) const;
+
+  /// @brief Box of the whole second object, in the frame it is tested in
+  virtual AABB<S> getSecondRootBV() const = 0;
+
+  /// @brief Lower bound of the distance between the node b1 with box bv1 and
+  /// the node b2 with box bv2
+  virtual S BVTesting(int b1, int b2, const AABB<S>& bv1, const AABB<S>& bv2) const = 0;
+
+  const QuantizedBVHModel<S>* model1;
+
+  mutable S query_time_seconds;
+};
+
+} // namespace detail
+} // namespace fcl
+
+#include "fcl/narrowphase/detail/traversal/distance/quantized_bvh_distance_traversal_node-inl.h"
+
+#endif
@@ -72,6 +72,8 @@ void ShapeDistanceTraversalNode<Shape1, Shape2, NarrowPhaseSolver>::leafTesting(
 {
   using S = typename Shape1::S;
 
+  if(this->enable_statistics) this->num_leaf_tests++;
+
   S distance;
   // NOTE(JS): The closest points are set to zeros in order to suppress the
   // maybe-uninitialized warning. It seems the warnings occur since
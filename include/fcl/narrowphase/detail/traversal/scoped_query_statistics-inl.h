@@ -0,0 +1,78 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FCL_TRAVERSAL_SCOPEDQUERYSTATISTICS_INL_H
+#define FCL_TRAVERSAL_SCOPEDQUERYSTATISTICS_INL_H
+
+#include "fcl/narrowphase/detail/traversal/scoped_query_statistics.h"
+
+namespace fcl
+{
+
+namespace detail
+{
+
+//==============================================================================
+template <typename NodeType>
+ScopedQueryStatistics<NodeType>::ScopedQueryStatistics(NodeType& node)
+  : node(node), enabled(node.request.enable_statistics)
+{
+  if(!enabled) return;
+
+  node.enableStatistics(true);
+  node.resetStatistics();
+  start = std::chrono::steady_clock::now();
+}
+
+//==============================================================================
+template <typename NodeType>
+ScopedQueryStatistics<NodeType>::~ScopedQueryStatistics()
+{
+  if(!enabled) return;
+
+  QueryStatistics statistics = node.getStatistics();
+  statistics.time_seconds = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start).count();
+
+  node.result->statistics += statistics;
+
+  if(QueryStatisticsSink* sink = QueryStatisticsSink::global())
+    sink->record(statistics);
+}
+
+} // namespace detail
+} // namespace fcl
+
+#endif
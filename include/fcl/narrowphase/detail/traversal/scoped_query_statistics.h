@@ -0,0 +1,81 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FCL_TRAVERSAL_SCOPEDQUERYSTATISTICS_H
+#define FCL_TRAVERSAL_SCOPEDQUERYSTATISTICS_H
+
+#include <chrono>
+
+#include "fcl/narrowphase/query_statistics.h"
+
+namespace fcl
+{
+
+namespace detail
+{
+
+/// @brief Records the statistics of the traversal made on a collision or
+/// distance traversal node during its lifetime, if the request of the node
+/// enables them: the counting of the node is enabled on construction, and on
+/// destruction the counters and the elapsed time are added to the statistics
+/// of the result of the node and recorded in QueryStatisticsSink::global().
+/// The node must be initialized with its request and result.
+template <typename NodeType>
+class FCL_EXPORT ScopedQueryStatistics
+{
+public:
+
+  explicit ScopedQueryStatistics(NodeType& node);
+
+  ~ScopedQueryStatistics();
+
+  ScopedQueryStatistics(const ScopedQueryStatistics&) = delete;
+  ScopedQueryStatistics& operator=(const ScopedQueryStatistics&) = delete;
+
+private:
+
+  NodeType& node;
+
+  bool enabled;
+
+  std::chrono::steady_clock::time_point start;
+};
+
+} // namespace detail
+} // namespace fcl
+
+#include "fcl/narrowphase/detail/traversal/scoped_query_statistics-inl.h"
+
+#endif
@@ -40,6 +40,8 @@
 
 #include "fcl/narrowphase/detail/traversal/traversal_node_base.h"
 
+#include <algorithm>
+
 #include "fcl/common/unused.h"
 
 namespace fcl
@@ -52,6 +54,14 @@ namespace detail
 extern template
 class FCL_EXPORT TraversalNodeBase<double>;
 
+//==============================================================================
+template <typename S>
+TraversalNodeBase<S>::TraversalNodeBase()
+  : num_bv_tests(0), num_leaf_tests(0), max_stack_size(0), front_size(0)
+{
+  // Do nothing
+}
+
 //==============================================================================
 template <typename S>
 TraversalNodeBase<S>::~TraversalNodeBase()
@@ -129,6 +139,38 @@ int TraversalNodeBase<S>::getSecondRightChild(int b) const
   return b;
 }
 
+//==============================================================================
+template <typename S>
+QueryStatistics TraversalNodeBase<S>::getStatistics() const
+{
+  QueryStatistics statistics;
+  statistics.num_bv_tests = num_bv_tests;
+  statistics.num_leaf_tests = num_leaf_tests;
+  statistics.max_stack_size = max_stack_size;
+  statistics.front_size = front_size;
+  return statistics;
+}
+
+//==============================================================================
+template <typename S>
+void TraversalNodeBase<S>::addStatistics(const QueryStatistics& statistics)
+{
+  num_bv_tests += static_cast<int>(statistics.num_bv_tests);
+  num_leaf_tests += static_cast<int>(statistics.num_leaf_tests);
+  max_stack_size = std::max(max_stack_size, static_cast<int>(statistics.max_stack_size));
+  front_size = std::max(front_size, static_cast<int>(statistics.front_size));
+}
+
+//==============================================================================
+template <typename S>
+void TraversalNodeBase<S>::resetStatistics()
+{
+  num_bv_tests = 0;
+  num_leaf_tests = 0;
+  max_stack_size = 0;
+  front_size = 0;
+}
+
 } // namespace detail
 } // namespace fcl
 
@@ -39,6 +39,7 @@
 #define FCL_TRAVERSAL_TRAVERSALNODEBASE_H
 
 #include "fcl/common/types.h"
+#include "fcl/narrowphase/query_statistics.h"
 
 namespace fcl
 {
@@ -51,6 +52,8 @@ template <typename S>
 class FCL_EXPORT TraversalNodeBase
 {
 public:
+  TraversalNodeBase();
+
   virtual ~TraversalNodeBase();
 
   virtual void preprocess();
@@ -81,12 +84,38 @@ public:
   /// @brief Enable statistics (verbose mode)
   virtual void enableStatistics(bool enable) = 0;
 
+  /// @brief The statistics counted by the node so far, without time
+  QueryStatistics getStatistics() const;
+
+  /// @brief Add statistics counted by another node, e.g. by the copies of
+  /// the node made by the parallel traversals
+  void addStatistics(const QueryStatistics& statistics);
+
+  /// @brief Reset the counters of the statistics
+  void resetStatistics();
+
   /// @brief configuation of first object
   Transform3<S> tf1;
 
   /// @brief configuration of second object
   Transform3<S> tf2;
 
+  /// @brief Number of BV tests made by the traversal, counted when the
+  /// statistics are enabled
+  mutable int num_bv_tests;
+
+  /// @brief Number of leaf tests made by the traversal, i.e., of narrowphase
+  /// tests between two primitives, counted when the statistics are enabled
+  mutable int num_leaf_tests;
+
+  /// @brief Largest number of node pairs waiting on the stack of the
+  /// iterative traversals, recorded when the statistics are enabled
+  mutable int max_stack_size;
+
+  /// @brief Number of node pairs in the front list left by the traversal, if
+  /// it used one, recorded when the statistics are enabled
+  mutable int front_size;
+
   EIGEN_MAKE_ALIGNED_OPERATOR_NEW
 };
 
@@ -40,7 +40,10 @@
 
 #include "fcl/narrowphase/detail/traversal/traversal_recurse.h"
 
+#include <algorithm>
+#include <memory>
 #include <queue>
+#include <vector>
 
 #include "fcl/common/unused.h"
 
@@ -54,6 +57,10 @@ namespace detail
 extern template
 void collisionRecurse(CollisionTraversalNodeBase<double>* node, int b1, int b2, BVHFrontList* front_list);
 
+//==============================================================================
+extern template
+void breadthFirstCollisionRecurse(CollisionTraversalNodeBase<double>* node, int b1, int b2);
+
 //==============================================================================
 extern template
 void collisionRecurse(MeshCollisionTraversalNodeOBB<double>* node, int b1, int b2, const Matrix3<double>& R, const Vector3<double>& T, BVHFrontList* front_list);
@@ -62,6 +69,10 @@ void collisionRecurse(MeshCollisionTraversalNodeOBB<double>* node, int b1, int b
 extern template
 void collisionRecurse(MeshCollisionTraversalNodeRSS<double>* node, int b1, int b2, const Matrix3<double>& R, const Vector3<double>& T, BVHFrontList* front_list);
 
+//==============================================================================
+extern template
+void collisionRecurse(QuantizedBVHCollisionTraversalNode<double>* node, int b1, int b2, const AABB<double>& bv1, const AABB<double>& bv2);
+
 //==============================================================================
 extern template
 void selfCollisionRecurse(CollisionTraversalNodeBase<double>* node, int b, BVHFrontList* front_list);
@@ -70,6 +81,10 @@ void selfCollisionRecurse(CollisionTraversalNodeBase<double>* node, int b, BVHFr
 extern template
 void distanceRecurse(DistanceTraversalNodeBase<double>* node, int b1, int b2, BVHFrontList* front_list);
 
+//==============================================================================
+extern template
+void distanceRecurse(QuantizedBVHDistanceTraversalNode<double>* node, int b1, int b2, const AABB<double>& bv1, const AABB<double>& bv2);
+
 //==============================================================================
 extern template
 void distanceQueueRecurse(DistanceTraversalNodeBase<double>* node, int b1, int b2, BVHFrontList* front_list, int qsize);
@@ -78,53 +93,121 @@ void distanceQueueRecurse(DistanceTraversalNodeBase<double>* node, int b1, int b
 extern template
 void propagateBVHFrontListCollisionRecurse(CollisionTraversalNodeBase<double>* node, BVHFrontList* front_list);
 
+//==============================================================================
+extern template
+void propagateBVHFrontListDistanceRecurse(DistanceTraversalNodeBase<double>* node, BVHFrontList* front_list);
+
 //==============================================================================
 template <typename S>
 FCL_EXPORT
 void collisionRecurse(CollisionTraversalNodeBase<S>* node, int b1, int b2, BVHFrontList* front_list)
 {
-  bool l1 = node->isFirstNodeLeaf(b1);
-  bool l2 = node->isSecondNodeLeaf(b2);
+  TraversalStack<BVTTPair<S>> stack(
+      node->enable_statistics ? &node->max_stack_size : nullptr);
+  stack.push({b1, b2, 0});
 
-  if(l1 && l2)
+  while(!stack.empty())
   {
-    updateFrontList(front_list, b1, b2);
+    const BVTTPair<S> pair = stack.pop();
 
-    if(node->BVTesting(b1, b2)) return;
+    bool l1 = node->isFirstNodeLeaf(pair.b1);
+    bool l2 = node->isSecondNodeLeaf(pair.b2);
 
-    node->leafTesting(b1, b2);
-    return;
-  }
+    if(l1 && l2)
+    {
+      updateFrontList(front_list, pair.b1, pair.b2);
 
-  if(node->BVTesting(b1, b2))
-  {
-    updateFrontList(front_list, b1, b2);
-    return;
-  }
+      if(node->BVTesting(pair.b1, pair.b2)) continue;
 
-  if(node->firstOverSecond(b1, b2))
-  {
-    int c1 = node->getFirstLeftChild(b1);
-    int c2 = node->getFirstRightChild(b1);
+      node->leafTesting(pair.b1, pair.b2);
 
-    collisionRecurse(node, c1, b2, front_list);
+      // early stop is disabled is front_list is used
+      if(node->canStop() && !front_list) return;
+      continue;
+    }
 
-    // early stop is disabled is front_list is used
-    if(node->canStop() && !front_list) return;
+    if(node->BVTesting(pair.b1, pair.b2))
+    {
+      updateFrontList(front_list, pair.b1, pair.b2);
+      continue;
+    }
 
-    collisionRecurse(node, c2, b2, front_list);
+    // The right child is pushed first, so that the left one is visited first
+    if(node->firstOverSecond(pair.b1, pair.b2))
+    {
+      stack.push({node->getFirstRightChild(pair.b1), pair.b2, 0});
+      stack.push({node->getFirstLeftChild(pair.b1), pair.b2, 0});
+    }
+    else
+    {
+      stack.push({pair.b1, node->getSecondRightChild(pair.b2), 0});
+      stack.push({pair.b1, node->getSecondLeftChild(pair.b2), 0});
+    }
   }
-  else
+}
+
+//==============================================================================
+template <typename S>
+FCL_EXPORT
+void breadthFirstCollisionRecurse(CollisionTraversalNodeBase<S>* node, int b1, int b2)
+{
+  std::vector<int> first(1, b1);
+  std::vector<int> second(1, b2);
+  std::vector<int> next_first;
+  std::vector<int> next_second;
+  std::unique_ptr<bool[]> disjoint;
+  std::size_t disjoint_capacity = 0;
+
+  while(!first.empty())
   {
-    int c1 = node->getSecondLeftChild(b2);
-    int c2 = node->getSecondRightChild(b2);
+    const std::size_t n = first.size();
+    if(n > disjoint_capacity)
+    {
+      disjoint.reset(new bool[n]);
+      disjoint_capacity = n;
+    }
 
-    collisionRecurse(node, b1, c1, front_list);
+    node->BVTestingBatch(static_cast<int>(n), first.data(), second.data(), disjoint.get());
 
-    // early stop is disabled is front_list is used
-    if(node->canStop() && !front_list) return;
+    next_first.clear();
+    next_second.clear();
 
-    collisionRecurse(node, b1, c2, front_list);
+    for(std::size_t i = 0; i < n; ++i)
+    {
+      if(disjoint[i]) continue;
+
+      const int p1 = first[i];
+      const int p2 = second[i];
+
+      bool l1 = node->isFirstNodeLeaf(p1);
+      bool l2 = node->isSecondNodeLeaf(p2);
+
+      if(l1 && l2)
+      {
+        node->leafTesting(p1, p2);
+
+        if(node->canStop()) return;
+        continue;
+      }
+
+      if(node->firstOverSecond(p1, p2))
+      {
+        next_first.push_back(node->getFirstLeftChild(p1));
+        next_second.push_back(p2);
+        next_first.push_back(node->getFirstRightChild(p1));
+        next_second.push_back(p2);
+      }
+      else
+      {
+        next_first.push_back(p1);
+        next_second.push_back(node->getSecondLeftChild(p2));
+        next_first.push_back(p1);
+        next_second.push_back(node->getSecondRightChild(p2));
+      }
+    }
+
+    first.swap(next_first);
+    second.swap(next_second);
   }
 }
 
@@ -230,53 +313,183 @@ void collisionRecurse(MeshCollisionTraversalNodeRSS<S>* node, int b1, int b2, co
 }
 
 //==============================================================================
-/** Recurse function for self collision
- * Make sure node is set correctly so that the first and second tree are the same
- */
+template <typename S>
+FCL_EXPORT
+void collisionRecurse(QuantizedBVHCollisionTraversalNode<S>* node, int b1, int b2, const AABB<S>& bv1, const AABB<S>& bv2)
+{
+  if(node->BVTesting(b1, b2, bv1, bv2)) return;
+
+  bool l1 = node->isFirstNodeLeaf(b1);
+  bool l2 = node->isSecondNodeLeaf(b2);
+
+  if(l1 && l2)
+  {
+    node->leafTesting(b1, b2);
+    return;
+  }
+
+  if(l2 || (!l1 && (bv1.size() > bv2.size())))
+  {
+    int c1 = node->getFirstLeftChild(b1);
+    int c2 = node->getFirstRightChild(b1);
+
+    collisionRecurse(node, c1, b2, node->getFirstBV(c1, bv1), bv2);
+
+    if(node->canStop()) return;
+
+    collisionRecurse(node, c2, b2, node->getFirstBV(c2, bv1), bv2);
+  }
+  else
+  {
+    int c1 = node->getSecondLeftChild(b2);
+    int c2 = node->getSecondRightChild(b2);
+
+    collisionRecurse(node, b1, c1, bv1, node->getSecondBV(c1, bv2));
+
+    if(node->canStop()) return;
+
+    collisionRecurse(node, b1, c2, bv1, node->getSecondBV(c2, bv2));
+  }
+}
+
+//==============================================================================
 template <typename S>
 FCL_EXPORT
 void selfCollisionRecurse(CollisionTraversalNodeBase<S>* node, int b, BVHFrontList* front_list)
 {
-  bool l = node->isFirstNodeLeaf(b);
+  // A pair (b, b) stands for the self collision of the subtree b, the other
+  // pairs for the collision between two sibling subtrees. They are visited in
+  // the order of the recursive definition: left subtree, right subtree, then
+  // the two subtrees against each other.
+  TraversalStack<BVTTPair<S>> stack(
+      node->enable_statistics ? &node->max_stack_size : nullptr);
+  stack.push({b, b, 0});
+
+  while(!stack.empty())
+  {
+    const BVTTPair<S> pair = stack.pop();
 
-  if(l) return;
+    if(pair.b1 != pair.b2)
+    {
+      collisionRecurse(node, pair.b1, pair.b2, front_list);
+
+      if(node->canStop() && !front_list) return;
+      continue;
+    }
 
-  int c1 = node->getFirstLeftChild(b);
-  int c2 = node->getFirstRightChild(b);
+    if(node->isFirstNodeLeaf(pair.b1)) continue;
 
-  selfCollisionRecurse(node, c1, front_list);
-  if(node->canStop() && !front_list) return;
+    if(node->selfBVTesting(pair.b1)) continue;
 
-  selfCollisionRecurse(node, c2, front_list);
-  if(node->canStop() && !front_list) return;
+    int c1 = node->getFirstLeftChild(pair.b1);
+    int c2 = node->getFirstRightChild(pair.b1);
 
-  collisionRecurse(node, c1, c2, front_list);
+    stack.push({c1, c2, 0});
+    stack.push({c2, c2, 0});
+    stack.push({c1, c1, 0});
+  }
 }
 
 //==============================================================================
 template <typename S>
 FCL_EXPORT
 void distanceRecurse(DistanceTraversalNodeBase<S>* node, int b1, int b2, BVHFrontList* front_list)
+{
+  TraversalStack<BVTTPair<S>> stack(
+      node->enable_statistics ? &node->max_stack_size : nullptr);
+  stack.push({b1, b2, 0});
+
+  // The root pair is always visited; the other pairs are pruned against the
+  // distance found so far when they are popped
+  bool is_root = true;
+
+  while(!stack.empty())
+  {
+    const BVTTPair<S> pair = stack.pop();
+
+    if(!is_root && node->canStop(pair.bound))
+    {
+      updateFrontList(front_list, pair.b1, pair.b2);
+      continue;
+    }
+    is_root = false;
+
+    bool l1 = node->isFirstNodeLeaf(pair.b1);
+    bool l2 = node->isSecondNodeLeaf(pair.b2);
+
+    if(l1 && l2)
+    {
+      updateFrontList(front_list, pair.b1, pair.b2);
+
+      node->leafTesting(pair.b1, pair.b2);
+      continue;
+    }
+
+    if(node->proxyTesting(pair.b1, pair.b2))
+    {
+      updateFrontList(front_list, pair.b1, pair.b2);
+      continue;
+    }
+
+    BVTTPair<S> a;
+    BVTTPair<S> c;
+
+    if(node->firstOverSecond(pair.b1, pair.b2))
+    {
+      a = {node->getFirstLeftChild(pair.b1), pair.b2, 0};
+      c = {node->getFirstRightChild(pair.b1), pair.b2, 0};
+    }
+    else
+    {
+      a = {pair.b1, node->getSecondLeftChild(pair.b2), 0};
+      c = {pair.b1, node->getSecondRightChild(pair.b2), 0};
+    }
+
+    a.bound = node->BVTesting(a.b1, a.b2);
+    c.bound = node->BVTesting(c.b1, c.b2);
+
+    // The closer pair is pushed last, so that it is visited first
+    if(c.bound < a.bound)
+    {
+      stack.push(a);
+      stack.push(c);
+    }
+    else
+    {
+      stack.push(c);
+      stack.push(a);
+    }
+  }
+}
+
+//==============================================================================
+template <typename S>
+FCL_EXPORT
+void distanceRecurse(QuantizedBVHDistanceTraversalNode<S>* node, int b1, int b2, const AABB<S>& bv1, const AABB<S>& bv2)
 {
   bool l1 = node->isFirstNodeLeaf(b1);
   bool l2 = node->isSecondNodeLeaf(b2);
 
   if(l1 && l2)
   {
-    updateFrontList(front_list, b1, b2);
-
     node->leafTesting(b1, b2);
     return;
   }
 
   int a1, a2, c1, c2;
+  AABB<S> abv1, abv2, cbv1, cbv2;
 
-  if(node->firstOverSecond(b1, b2))
+  if(l2 || (!l1 && (bv1.size() > bv2.size())))
   {
     a1 = node->getFirstLeftChild(b1);
     a2 = b2;
     c1 = node->getFirstRightChild(b1);
     c2 = b2;
+
+    abv1 = node->getFirstBV(a1, bv1);
+    abv2 = bv2;
+    cbv1 = node->getFirstBV(c1, bv1);
+    cbv2 = bv2;
   }
   else
   {
@@ -284,34 +497,31 @@ void distanceRecurse(DistanceTraversalNodeBase<S>* node, int b1, int b2, BVHFron
     a2 = node->getSecondLeftChild(b2);
     c1 = b1;
     c2 = node->getSecondRightChild(b2);
+
+    abv1 = bv1;
+    abv2 = node->getSecondBV(a2, bv2);
+    cbv1 = bv1;
+    cbv2 = node->getSecondBV(c2, bv2);
   }
 
-  S d1 = node->BVTesting(a1, a2);
-  S d2 = node->BVTesting(c1, c2);
+  S d1 = node->BVTesting(a1, a2, abv1, abv2);
+  S d2 = node->BVTesting(c1, c2, cbv1, cbv2);
 
   if(d2 < d1)
   {
     if(!node->canStop(d2))
-      distanceRecurse(node, c1, c2, front_list);
-    else
-      updateFrontList(front_list, c1, c2);
+      distanceRecurse(node, c1, c2, cbv1, cbv2);
 
     if(!node->canStop(d1))
-      distanceRecurse(node, a1, a2, front_list);
-    else
-      updateFrontList(front_list, a1, a2);
+      distanceRecurse(node, a1, a2, abv1, abv2);
   }
   else
   {
     if(!node->canStop(d1))
-      distanceRecurse(node, a1, a2, front_list);
-    else
-      updateFrontList(front_list, a1, a2);
+      distanceRecurse(node, a1, a2, abv1, abv2);
 
     if(!node->canStop(d2))
-      distanceRecurse(node, c1, c2, front_list);
-    else
-      updateFrontList(front_list, c1, c2);
+      distanceRecurse(node, c1, c2, cbv1, cbv2);
   }
 }
 
@@ -403,6 +613,10 @@ void distanceQueueRecurse(DistanceTraversalNodeBase<S>* node, int b1, int b2, BV
 
       node->leafTesting(min_test.b1, min_test.b2);
     }
+    else if(node->proxyTesting(min_test.b1, min_test.b2))
+    {
+      updateFrontList(front_list, min_test.b1, min_test.b2);
+    }
     else if(bvtq.full())
     {
       // queue should not get two more tests, recur
@@ -464,59 +678,335 @@ template <typename S>
 FCL_EXPORT
 void propagateBVHFrontListCollisionRecurse(CollisionTraversalNodeBase<S>* node, BVHFrontList* front_list)
 {
-  BVHFrontList::iterator front_iter;
+  // The new front nodes are collected apart, so that the front is not grown
+  // while it is iterated, and only the nodes of the old front are propagated
   BVHFrontList append;
-  for(front_iter = front_list->begin(); front_iter != front_list->end(); ++front_iter)
+  const std::size_t num_front_nodes = front_list->size();
+  for(std::size_t i = 0; i < num_front_nodes; ++i)
   {
-    int b1 = front_iter->left;
-    int b2 = front_iter->right;
+    BVHFrontNode& front_node = (*front_list)[i];
+    int b1 = front_node.left;
+    int b2 = front_node.right;
     bool l1 = node->isFirstNodeLeaf(b1);
     bool l2 = node->isSecondNodeLeaf(b2);
 
     if(l1 & l2)
     {
-      front_iter->valid = false; // the front node is no longer valid, in collideRecurse will add again.
+      front_node.valid = false; // the front node is no longer valid, in collideRecurse will add again.
       collisionRecurse(node, b1, b2, &append);
     }
     else
     {
       if(!node->BVTesting(b1, b2))
       {
-        front_iter->valid = false;
+        front_node.valid = false;
 
         if(node->firstOverSecond(b1, b2))
         {
           int c1 = node->getFirstLeftChild(b1);
           int c2 = node->getFirstRightChild(b1);
 
-          collisionRecurse(node, c1, b2, front_list);
-          collisionRecurse(node, c2, b2, front_list);
+          collisionRecurse(node, c1, b2, &append);
+          collisionRecurse(node, c2, b2, &append);
         }
         else
         {
           int c1 = node->getSecondLeftChild(b2);
           int c2 = node->getSecondRightChild(b2);
 
-          collisionRecurse(node, b1, c1, front_list);
-          collisionRecurse(node, b1, c2, front_list);
+          collisionRecurse(node, b1, c1, &append);
+          collisionRecurse(node, b1, c2, &append);
         }
       }
     }
   }
 
-
   // clean the old front list (remove invalid node)
-  for(front_iter = front_list->begin(); front_iter != front_list->end();)
+  front_list->erase(
+        std::remove_if(front_list->begin(), front_list->end(),
+                       [](const BVHFrontNode& front_node) { return !front_node.valid; }),
+        front_list->end());
+
+  front_list->insert(front_list->end(), append.begin(), append.end());
+}
+
+//==============================================================================
+template <typename S>
+FCL_EXPORT
+void propagateBVHFrontListDistanceRecurse(DistanceTraversalNodeBase<S>* node, BVHFrontList* front_list)
+{
+  BVHFrontList old_front;
+  old_front.swap(*front_list);
+
+  // The old front nodes are visited from the closest to the farthest, so that
+  // a small distance is found early and prunes the rest of the front
+  std::vector<BVTTPair<S>> pairs;
+  pairs.reserve(old_front.size());
+  for(const BVHFrontNode& front_node : old_front)
+    pairs.push_back({front_node.left, front_node.right,
+                     node->BVTesting(front_node.left, front_node.right)});
+
+  std::sort(pairs.begin(), pairs.end(),
+            [](const BVTTPair<S>& a, const BVTTPair<S>& c) { return a.bound < c.bound; });
+
+  for(const BVTTPair<S>& pair : pairs)
+  {
+    if(node->canStop(pair.bound))
+      updateFrontList(front_list, pair.b1, pair.b2);
+    else
+      distanceRecurse(node, pair.b1, pair.b2, front_list);
+  }
+}
+
+//==============================================================================
+template <typename NodeType>
+FCL_EXPORT
+void collisionRecurseStatic(NodeType* node, int b1, int b2)
+{
+  using S = typename NodeType::S;
+
+  // With batched BV tests, the two child pairs of a descent step are tested
+  // together before being pushed, and only the overlapping ones are pushed
+  const bool batched = NodeType::batched_bv_testing;
+
+  if(batched && node->NodeType::BVTesting(b1, b2)) return;
+
+  TraversalStack<BVTTPair<S>> stack(
+      node->enable_statistics ? &node->max_stack_size : nullptr);
+  stack.push({b1, b2, 0});
+
+  while(!stack.empty())
+  {
+    const BVTTPair<S> pair = stack.pop();
+
+    if(!batched && node->NodeType::BVTesting(pair.b1, pair.b2)) continue;
+
+    bool l1 = node->NodeType::isFirstNodeLeaf(pair.b1);
+    bool l2 = node->NodeType::isSecondNodeLeaf(pair.b2);
+
+    if(l1 && l2)
+    {
+      node->NodeType::leafTesting(pair.b1, pair.b2);
+
+      if(node->NodeType::canStop()) return;
+      continue;
+    }
+
+    if(NodeType::leaf_block_size > 0
+       && node->NodeType::leafBlockTesting(pair.b1, pair.b2))
+    {
+      if(node->NodeType::canStop()) return;
+      continue;
+    }
+
+    int first[2];
+    int second[2];
+
+    if(node->NodeType::firstOverSecond(pair.b1, pair.b2))
+    {
+      first[0] = node->NodeType::getFirstLeftChild(pair.b1);
+      first[1] = node->NodeType::getFirstRightChild(pair.b1);
+      second[0] = second[1] = pair.b2;
+    }
+    else
+    {
+      first[0] = first[1] = pair.b1;
+      second[0] = node->NodeType::getSecondLeftChild(pair.b2);
+      second[1] = node->NodeType::getSecondRightChild(pair.b2);
+    }
+
+    bool disjoint[2] = {false, false};
+    if(batched)
+      node->NodeType::BVTestingBatch(2, first, second, disjoint);
+
+    // The right child is pushed first, so that the left one is visited first
+    if(!disjoint[1])
+      stack.push({first[1], second[1], 0});
+    if(!disjoint[0])
+      stack.push({first[0], second[0], 0});
+  }
+}
+
+//==============================================================================
+template <typename NodeType>
+FCL_EXPORT
+void selfCollisionRecurseStatic(NodeType* node, int b)
+{
+  using S = typename NodeType::S;
+
+  // Same order as selfCollisionRecurse()
+  TraversalStack<BVTTPair<S>> stack(
+      node->enable_statistics ? &node->max_stack_size : nullptr);
+  stack.push({b, b, 0});
+
+  while(!stack.empty())
+  {
+    const BVTTPair<S> pair = stack.pop();
+
+    if(pair.b1 != pair.b2)
+    {
+      collisionRecurseStatic(node, pair.b1, pair.b2);
+
+      if(node->NodeType::canStop()) return;
+      continue;
+    }
+
+    if(node->NodeType::isFirstNodeLeaf(pair.b1)) continue;
+
+    if(node->NodeType::selfBVTesting(pair.b1)) continue;
+
+    int c1 = node->NodeType::getFirstLeftChild(pair.b1);
+    int c2 = node->NodeType::getFirstRightChild(pair.b1);
+
+    stack.push({c1, c2, 0});
+    stack.push({c2, c2, 0});
+    stack.push({c1, c1, 0});
+  }
+}
+
+//==============================================================================
+template <typename NodeType>
+FCL_EXPORT
+void distanceRecurseStatic(NodeType* node, int b1, int b2)
+{
+  using S = typename NodeType::S;
+
+  TraversalStack<BVTTPair<S>> stack(
+      node->enable_statistics ? &node->max_stack_size : nullptr);
+  stack.push({b1, b2, 0});
+
+  bool is_root = true;
+
+  while(!stack.empty())
   {
-    if(!front_iter->valid)
-      front_iter = front_list->erase(front_iter);
+    const BVTTPair<S> pair = stack.pop();
+
+    if(!is_root && node->NodeType::canStop(pair.bound)) continue;
+    is_root = false;
+
+    bool l1 = node->NodeType::isFirstNodeLeaf(pair.b1);
+    bool l2 = node->NodeType::isSecondNodeLeaf(pair.b2);
+
+    if(l1 && l2)
+    {
+      node->NodeType::leafTesting(pair.b1, pair.b2);
+      continue;
+    }
+
+    if(node->NodeType::proxyTesting(pair.b1, pair.b2))
+      continue;
+
+    BVTTPair<S> a;
+    BVTTPair<S> c;
+
+    if(node->NodeType::firstOverSecond(pair.b1, pair.b2))
+    {
+      a = {node->NodeType::getFirstLeftChild(pair.b1), pair.b2, 0};
+      c = {node->NodeType::getFirstRightChild(pair.b1), pair.b2, 0};
+    }
     else
-      ++front_iter;
+    {
+      a = {pair.b1, node->NodeType::getSecondLeftChild(pair.b2), 0};
+      c = {pair.b1, node->NodeType::getSecondRightChild(pair.b2), 0};
+    }
+
+    a.bound = node->NodeType::BVTesting(a.b1, a.b2);
+    c.bound = node->NodeType::BVTesting(c.b1, c.b2);
+
+    // The closer pair is pushed last, so that it is visited first
+    if(c.bound < a.bound)
+    {
+      stack.push(a);
+      stack.push(c);
+    }
+    else
+    {
+      stack.push(c);
+      stack.push(a);
+    }
   }
+}
 
-  for(front_iter = append.begin(); front_iter != append.end(); ++front_iter)
+//==============================================================================
+template <typename S>
+struct BVTTPairGreater
+{
+  bool operator()(const BVTTPair<S>& a, const BVTTPair<S>& b) const
   {
-    front_list->push_back(*front_iter);
+    return a.bound > b.bound;
+  }
+};
+
+//==============================================================================
+template <typename NodeType>
+FCL_EXPORT
+void distanceBestFirstRecurseStatic(
+    NodeType* node, int b1, int b2, std::size_t queue_size)
+{
+  using S = typename NodeType::S;
+
+  const BVTTPairGreater<S> greater;
+
+  // The heap is pooled per thread, so that repeated queries do not allocate
+  static thread_local std::vector<BVTTPair<S>> heap;
+  heap.clear();
+  heap.push_back({b1, b2, 0});
+
+  bool is_root = true;
+
+  while(!heap.empty())
+  {
+    std::pop_heap(heap.begin(), heap.end(), greater);
+    const BVTTPair<S> pair = heap.back();
+    heap.pop_back();
+
+    // Every pair left in the heap has a bound at least as large
+    if(!is_root && node->NodeType::canStop(pair.bound)) break;
+    is_root = false;
+
+    bool l1 = node->NodeType::isFirstNodeLeaf(pair.b1);
+    bool l2 = node->NodeType::isSecondNodeLeaf(pair.b2);
+
+    if(l1 && l2)
+    {
+      node->NodeType::leafTesting(pair.b1, pair.b2);
+      continue;
+    }
+
+    if(heap.size() + 2 > queue_size)
+    {
+      distanceRecurseStatic(node, pair.b1, pair.b2);
+      continue;
+    }
+
+    if(node->NodeType::proxyTesting(pair.b1, pair.b2))
+      continue;
+
+    BVTTPair<S> a;
+    BVTTPair<S> c;
+
+    if(node->NodeType::firstOverSecond(pair.b1, pair.b2))
+    {
+      a = {node->NodeType::getFirstLeftChild(pair.b1), pair.b2, 0};
+      c = {node->NodeType::getFirstRightChild(pair.b1), pair.b2, 0};
+    }
+    else
+    {
+      a = {pair.b1, node->NodeType::getSecondLeftChild(pair.b2), 0};
+      c = {pair.b1, node->NodeType::getSecondRightChild(pair.b2), 0};
+    }
+
+    a.bound = node->NodeType::BVTesting(a.b1, a.b2);
+    c.bound = node->NodeType::BVTesting(c.b1, c.b2);
+
+    heap.push_back(a);
+    std::push_heap(heap.begin(), heap.end(), greater);
+    heap.push_back(c);
+    std::push_heap(heap.begin(), heap.end(), greater);
+
+    if(node->enable_statistics
+       && static_cast<int>(heap.size()) > node->max_stack_size)
+      node->max_stack_size = static_cast<int>(heap.size());
   }
 }
 
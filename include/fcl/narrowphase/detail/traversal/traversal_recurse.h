@@ -40,9 +40,12 @@
 
 #include "fcl/geometry/bvh/detail/BVH_front.h"
 #include "fcl/narrowphase/detail/traversal/traversal_node_base.h"
+#include "fcl/narrowphase/detail/traversal/traversal_stack.h"
 #include "fcl/narrowphase/detail/traversal/collision/collision_traversal_node_base.h"
 #include "fcl/narrowphase/detail/traversal/collision/mesh_collision_traversal_node.h"
+#include "fcl/narrowphase/detail/traversal/collision/quantized_bvh_collision_traversal_node.h"
 #include "fcl/narrowphase/detail/traversal/distance/distance_traversal_node_base.h"
+#include "fcl/narrowphase/detail/traversal/distance/quantized_bvh_distance_traversal_node.h"
 
 namespace fcl
 {
@@ -50,11 +53,23 @@ namespace fcl
 namespace detail
 {
 
-/// @brief Recurse function for collision
+/// @brief Recurse function for collision. The traversal is depth first and
+/// iterative, on an explicit stack, so that deep trees cannot overflow the
+/// call stack; the node pairs are visited in the same order as a recursive
+/// traversal.
 template <typename S>
 FCL_EXPORT
 void collisionRecurse(CollisionTraversalNodeBase<S>* node, int b1, int b2, BVHFrontList* front_list);
 
+/// @brief Breadth first collision traversal. All the node pairs of a level of
+/// the BVTT are tested with a single call to BVTestingBatch(), so that nodes
+/// with a vectorized BV test can evaluate them together. The same leaf pairs
+/// as collisionRecurse() are tested, in a different order. Front lists are
+/// not supported.
+template <typename S>
+FCL_EXPORT
+void breadthFirstCollisionRecurse(CollisionTraversalNodeBase<S>* node, int b1, int b2);
+
 /// @brief Recurse function for collision, specialized for OBB type
 template <typename S>
 FCL_EXPORT
@@ -65,16 +80,31 @@ template <typename S>
 FCL_EXPORT
 void collisionRecurse(MeshCollisionTraversalNodeRSS<S>* node, int b1, int b2, const Matrix3<S>& R, const Vector3<S>& T, BVHFrontList* front_list);
 
-/// @brief Recurse function for self collision. Make sure node is set correctly so that the first and second tree are the same
+/// @brief Recurse function for collision, specialized for quantized BVHs.
+/// bv1 and bv2 are the dequantized boxes of the nodes b1 and b2.
+template <typename S>
+FCL_EXPORT
+void collisionRecurse(QuantizedBVHCollisionTraversalNode<S>* node, int b1, int b2, const AABB<S>& bv1, const AABB<S>& bv2);
+
+/// @brief Recurse function for self collision. Make sure node is set correctly so that the first and second tree are the same.
+/// Iterative, like collisionRecurse(). The subtrees accepted by
+/// node->selfBVTesting() are not tested against themselves.
 template <typename S>
 FCL_EXPORT
 void selfCollisionRecurse(CollisionTraversalNodeBase<S>* node, int b, BVHFrontList* front_list);
 
-/// @brief Recurse function for distance
+/// @brief Recurse function for distance. Iterative, like collisionRecurse();
+/// the closer of two child pairs is visited first.
 template <typename S>
 FCL_EXPORT
 void distanceRecurse(DistanceTraversalNodeBase<S>* node, int b1, int b2, BVHFrontList* front_list);
 
+/// @brief Recurse function for distance, specialized for quantized BVHs.
+/// bv1 and bv2 are the dequantized boxes of the nodes b1 and b2.
+template <typename S>
+FCL_EXPORT
+void distanceRecurse(QuantizedBVHDistanceTraversalNode<S>* node, int b1, int b2, const AABB<S>& bv1, const AABB<S>& bv2);
+
 /// @brief Recurse function for distance, using queue acceleration
 template <typename S>
 FCL_EXPORT
@@ -85,6 +115,52 @@ template <typename S>
 FCL_EXPORT
 void propagateBVHFrontListCollisionRecurse(CollisionTraversalNodeBase<S>* node, BVHFrontList* front_list);
 
+/// @brief Recurse function for front list propagation in distance queries.
+/// The traversal restarts from the pairs of the front found by a previous
+/// query, which form a cut of the BVTT, so the result is the same as a
+/// traversal from the roots. The front is replaced by the pairs where the
+/// new traversal stops; it only moves down the BVTT.
+template <typename S>
+FCL_EXPORT
+void propagateBVHFrontListDistanceRecurse(DistanceTraversalNodeBase<S>* node, BVHFrontList* front_list);
+
+/// @brief Recurse function for collision, statically dispatched on the
+/// concrete traversal node type. The node methods are called with qualified
+/// names, so no virtual call is made and the BV tests can be inlined. The
+/// dynamic type of node must be exactly NodeType; nodes derived by users must
+/// go through the virtual collisionRecurse(). If NodeType::leaf_block_size is
+/// not 0, the node pairs small enough for leafBlockTesting() are not descended.
+template <typename NodeType>
+FCL_EXPORT
+void collisionRecurseStatic(NodeType* node, int b1, int b2);
+
+/// @brief Recurse function for the self collision of the subtree b,
+/// statically dispatched on the concrete traversal node type like
+/// collisionRecurseStatic(). Visits the same node pairs as
+/// selfCollisionRecurse().
+template <typename NodeType>
+FCL_EXPORT
+void selfCollisionRecurseStatic(NodeType* node, int b);
+
+/// @brief Recurse function for distance, statically dispatched on the
+/// concrete traversal node type. Same requirements as collisionRecurseStatic().
+template <typename NodeType>
+FCL_EXPORT
+void distanceRecurseStatic(NodeType* node, int b1, int b2);
+
+/// @brief Best first distance traversal, statically dispatched on the
+/// concrete traversal node type like distanceRecurseStatic(). The node pairs
+/// wait in a binary heap ordered by their lower bounds, and the pair with the
+/// smallest bound is always visited next; the traversal stops as soon as
+/// node->canStop() accepts that bound, since no remaining pair can improve the
+/// result. The heap holds at most queue_size pairs: when it is full, the popped
+/// pair is traversed depth first instead of being expanded into the heap. The
+/// heap storage is kept per thread and reused across calls.
+template <typename NodeType>
+FCL_EXPORT
+void distanceBestFirstRecurseStatic(
+    NodeType* node, int b1, int b2, std::size_t queue_size);
+
 } // namespace detail
 } // namespace fcl
 
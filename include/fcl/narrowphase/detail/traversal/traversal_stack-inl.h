@@ -0,0 +1,108 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FCL_TRAVERSAL_TRAVERSALSTACK_INL_H
+#define FCL_TRAVERSAL_TRAVERSALSTACK_INL_H
+
+#include "fcl/narrowphase/detail/traversal/traversal_stack.h"
+
+namespace fcl
+{
+
+namespace detail
+{
+
+//==============================================================================
+template <typename T, std::size_t N>
+TraversalStack<T, N>::TraversalStack(int* max_size)
+  : num_elements(0), max_num_elements(0), max_size(max_size)
+{
+  // Do nothing
+}
+
+//==============================================================================
+template <typename T, std::size_t N>
+TraversalStack<T, N>::~TraversalStack()
+{
+  if(max_size && static_cast<int>(max_num_elements) > *max_size)
+    *max_size = static_cast<int>(max_num_elements);
+}
+
+//==============================================================================
+template <typename T, std::size_t N>
+bool TraversalStack<T, N>::empty() const
+{
+  return num_elements == 0;
+}
+
+//==============================================================================
+template <typename T, std::size_t N>
+std::size_t TraversalStack<T, N>::size() const
+{
+  return num_elements;
+}
+
+//==============================================================================
+template <typename T, std::size_t N>
+void TraversalStack<T, N>::push(const T& value)
+{
+  if(num_elements < N)
+    inline_elements[num_elements] = value;
+  else
+    heap_elements.push_back(value);
+
+  ++num_elements;
+  if(num_elements > max_num_elements)
+    max_num_elements = num_elements;
+}
+
+//==============================================================================
+template <typename T, std::size_t N>
+T TraversalStack<T, N>::pop()
+{
+  --num_elements;
+
+  if(num_elements < N)
+    return inline_elements[num_elements];
+
+  T value = heap_elements.back();
+  heap_elements.pop_back();
+  return value;
+}
+
+} // namespace detail
+} // namespace fcl
+
+#endif
@@ -0,0 +1,104 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FCL_TRAVERSAL_TRAVERSALSTACK_H
+#define FCL_TRAVERSAL_TRAVERSALSTACK_H
+
+#include <cstddef>
+#include <vector>
+
+#include "fcl/export.h"
+
+namespace fcl
+{
+
+namespace detail
+{
+
+/// @brief A pair of nodes of the bounding volume test tree (BVTT), waiting to
+/// be visited by an iterative traversal. bound is a lower bound of the
+/// distance between the two nodes; it is only used by distance traversals.
+template <typename S>
+struct FCL_EXPORT BVTTPair
+{
+  int b1;
+  int b2;
+  S bound;
+};
+
+/// @brief LIFO stack used by the iterative traversals in traversal_recurse.h.
+/// The first N elements live inside the object, so that a traversal of a
+/// balanced tree never allocates; deeper traversals spill to the heap.
+template <typename T, std::size_t N = 128>
+class FCL_EXPORT TraversalStack
+{
+public:
+  /// @brief If max_size is not nullptr, the largest size reached by the stack
+  /// is stored in *max_size on destruction, if it is larger than *max_size
+  explicit TraversalStack(int* max_size = nullptr);
+
+  ~TraversalStack();
+
+  /// @brief Whether the stack holds no element
+  bool empty() const;
+
+  /// @brief Number of elements in the stack
+  std::size_t size() const;
+
+  /// @brief Push an element on the top of the stack
+  void push(const T& value);
+
+  /// @brief Remove and return the element on the top of the stack. The stack
+  /// must not be empty.
+  T pop();
+
+private:
+  T inline_elements[N];
+
+  std::vector<T> heap_elements;
+
+  std::size_t num_elements;
+
+  std::size_t max_num_elements;
+
+  int* max_size;
+};
+
+} // namespace detail
+} // namespace fcl
+
+#include "fcl/narrowphase/detail/traversal/traversal_stack-inl.h"
+
+#endif
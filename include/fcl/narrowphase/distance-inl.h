@@ -41,6 +41,7 @@
 #include "fcl/narrowphase/distance.h"
 
 #include "fcl/narrowphase/collision.h"
+#include "fcl/geometry/bvh/BVH_utility.h"
 
 namespace fcl
 {
@@ -106,6 +107,9 @@ typename NarrowPhaseSolver::S distance(
 
   const auto& looktable = getDistanceFunctionLookTable<NarrowPhaseSolver>();
 
+  BVHRefitIfPending(o1);
+  BVHRefitIfPending(o2);
+
   OBJECT_TYPE object_type1 = o1->getObjectType();
   NODE_TYPE node_type1 = o1->getNodeType();
   OBJECT_TYPE object_type2 = o2->getObjectType();
@@ -214,6 +218,12 @@ S distance(
       solver.gjk_tolerance = request.distance_tolerance;
       return distance(o1, o2, &solver, request, result);
     }
+  case GST_INLINE:
+    {
+      detail::GJKSolver_inline<S> solver;
+      solver.gjk_tolerance = request.distance_tolerance;
+      return distance(o1, o2, &solver, request, result);
+    }
   default:
     return -1; // error
   }
@@ -240,6 +250,12 @@ S distance(
       solver.gjk_tolerance = request.distance_tolerance;
       return distance(o1, tf1, o2, tf2, &solver, request, result);
     }
+  case GST_INLINE:
+    {
+      detail::GJKSolver_inline<S> solver;
+      solver.gjk_tolerance = request.distance_tolerance;
+      return distance(o1, tf1, o2, tf2, &solver, request, result);
+    }
   default:
     return -1;
   }
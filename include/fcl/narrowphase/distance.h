@@ -41,6 +41,7 @@
 #include "fcl/narrowphase/collision_object.h"
 #include "fcl/narrowphase/detail/distance_func_matrix.h"
 #include "fcl/narrowphase/detail/gjk_solver_indep.h"
+#include "fcl/narrowphase/detail/gjk_solver_inline.h"
 #include "fcl/narrowphase/detail/gjk_solver_libccd.h"
 
 namespace fcl
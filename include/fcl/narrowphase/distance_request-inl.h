@@ -57,13 +57,20 @@ DistanceRequest<S>::DistanceRequest(
     S rel_err_,
     S abs_err_,
     S distance_tolerance_,
-    GJKSolverType gjk_solver_type_)
+    GJKSolverType gjk_solver_type_,
+    S lod_tolerance_)
   : enable_nearest_points(enable_nearest_points_),
     enable_signed_distance(enable_signed_distance_),
     rel_err(rel_err_),
     abs_err(abs_err_),
     distance_tolerance(distance_tolerance_),
-    gjk_solver_type(gjk_solver_type_)
+    gjk_solver_type(gjk_solver_type_),
+    lod_tolerance(lod_tolerance_),
+    query_cache(nullptr),
+    gjk_cache(nullptr),
+    num_threads(1),
+    best_first_queue_size(0),
+    enable_statistics(false)
 {
   // Do nothing
 }
@@ -39,7 +39,9 @@
 #define FCL_DISTANCEREQUEST_H
 
 #include "fcl/common/types.h"
+#include "fcl/narrowphase/gjk_cache.h"
 #include "fcl/narrowphase/gjk_solver_type.h"
+#include "fcl/narrowphase/query_cache.h"
 
 namespace fcl
 {
@@ -62,12 +64,12 @@ struct FCL_EXPORT DistanceRequest
   /// (mostly -1).
   ///
   ///       [ Current Implementation Status ]
-  /// -----------------+--------------+--------------
-  ///   GJKSolverType  |  GST_LIBCCD  |  GST_INDEP
-  /// -----------------+--------------+--------------
+  /// -----------------+--------------+-------------------------
+  ///   GJKSolverType  |  GST_LIBCCD  |  GST_INDEP, GST_INLINE
+  /// -----------------+--------------+-------------------------
   /// primitive shapes | SD_1, NP     | SD_2, NP_X
   /// mesh and octree  | SD_2, NP_X   | SD_2, NP_X
-  /// -----------------+--------------+--------------
+  /// -----------------+--------------+-------------------------
   /// SD_1: Signed distance is computed using convexity based methods (GJK, MPA)
   /// SD_2: Positive distance is computed using convexity based mothods (GJK,
   ///       MPA), but negative distance is computed by a workaround using
@@ -101,13 +103,59 @@ struct FCL_EXPORT DistanceRequest
   /// @brief narrow phase solver type
   GJKSolverType gjk_solver_type;
 
+  /// @brief Tolerance for the level-of-detail proxies of BVH models (see
+  /// BVHModel::computeLODProxies()). When positive, the traversal between two
+  /// meshes with proxies stops at a pair of BV nodes whose proxy radii sum up
+  /// to at most this tolerance, and uses the distance between the proxy
+  /// vertices. The resulting distance is then the distance between two points
+  /// of the meshes, and it overestimates the exact one by at most the
+  /// tolerance. Unlike rel_err and abs_err, which only prune the traversal,
+  /// this bounds the error of the returned distance itself.
+  ///
+  /// The default is 0, i.e., the proxies are not used.
+  S lod_tolerance;
+
+  /// @brief Cache of the BVH traversal between the two geometries, reused from
+  /// one query to the next when they move little (see QueryCache). The cache
+  /// is updated by the query. The default is nullptr, i.e., no cache.
+  QueryCache<S>* query_cache;
+
+  /// @brief Cache of the final GJK simplices of the pairs of shapes, from
+  /// which the next queries on the same pairs start (see GJKCache). The cache
+  /// is updated by the query. The default is nullptr, i.e., no cache.
+  GJKCache<S>* gjk_cache;
+
+  /// @brief Number of threads used by a single query between two meshes.
+  /// The BVTT is expanded to a set of independent node pairs, which are
+  /// traversed concurrently. The threads share the smallest
+  /// distance found so far, to prune the pairs of BVs farther than it. It is
+  /// worth it for large meshes only. 0 means one thread per hardware thread.
+  /// The default is 1, i.e., the traversal is sequential. It is ignored when
+  /// query_cache is set.
+  unsigned int num_threads;
+
+  /// @brief If not 0, the BVTT of a BVH query is traversed best first: the
+  /// pairs of BVs are visited in the order of their distance lower bounds, and
+  /// the traversal ends as soon as the smallest bound left cannot improve the
+  /// result by more than rel_err and abs_err. This is the maximum number of
+  /// pairs waiting in the priority queue; beyond it, the pairs are traversed
+  /// depth first. The default is 0, i.e., the traversal is depth first. It is
+  /// ignored when query_cache is set or num_threads is not 1.
+  std::size_t best_first_queue_size;
+
+  /// @brief If true, the statistics of the traversal (see QueryStatistics)
+  /// are accumulated in the statistics of the result, and recorded in
+  /// QueryStatisticsSink::global() if it is set. The default is false.
+  bool enable_statistics;
+
   explicit DistanceRequest(
       bool enable_nearest_points_ = false,
       bool enable_signed_distance = false,
       S rel_err_ = 0.0,
       S abs_err_ = 0.0,
       S distance_tolerance = 1e-6,
-      GJKSolverType gjk_solver_type_ = GST_LIBCCD);
+      GJKSolverType gjk_solver_type_ = GST_LIBCCD,
+      S lod_tolerance_ = 0.0);
 
   bool isSatisfied(const DistanceResult<S>& result) const;
 };
@@ -131,6 +131,7 @@ void DistanceResult<S>::clear()
   o2 = nullptr;
   b1 = NONE;
   b2 = NONE;
+  statistics = QueryStatistics();
 }
 
 } // namespace fcl
@@ -0,0 +1,121 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FCL_NARROWPHASE_GJKCACHE_INL_H
+#define FCL_NARROWPHASE_GJKCACHE_INL_H
+
+#include "fcl/narrowphase/gjk_cache.h"
+
+namespace fcl
+{
+
+//==============================================================================
+extern template
+struct FCL_EXPORT GJKSimplexCache<double>;
+
+//==============================================================================
+extern template
+class FCL_EXPORT GJKCache<double>;
+
+//==============================================================================
+template <typename S>
+GJKSimplexCache<S>::GJKSimplexCache()
+  : rank(0)
+{
+  // Do nothing
+}
+
+//==============================================================================
+template <typename S>
+void GJKSimplexCache<S>::clear()
+{
+  rank = 0;
+}
+
+//==============================================================================
+template <typename S>
+bool GJKSimplexCache<S>::empty() const
+{
+  return rank == 0;
+}
+
+//==============================================================================
+template <typename S>
+GJKSimplexCache<S>& GJKCache<S>::get(
+    const CollisionGeometry<S>* o1, const CollisionGeometry<S>* o2)
+{
+  return simplices[GeometryPair(o1, o2)];
+}
+
+//==============================================================================
+template <typename S>
+void GJKCache<S>::erase(const CollisionGeometry<S>* o)
+{
+  for(auto it = simplices.begin(); it != simplices.end();)
+  {
+    if(it->first.first == o || it->first.second == o)
+      it = simplices.erase(it);
+    else
+      ++it;
+  }
+}
+
+//==============================================================================
+template <typename S>
+void GJKCache<S>::clear()
+{
+  simplices.clear();
+}
+
+//==============================================================================
+template <typename S>
+std::size_t GJKCache<S>::size() const
+{
+  return simplices.size();
+}
+
+//==============================================================================
+template <typename S>
+std::size_t GJKCache<S>::GeometryPairHash::operator()(
+    const GeometryPair& pair) const
+{
+  const std::size_t h1 = std::hash<const CollisionGeometry<S>*>()(pair.first);
+  const std::size_t h2 = std::hash<const CollisionGeometry<S>*>()(pair.second);
+  return h1 ^ (h2 + 0x9e3779b9 + (h1 << 6) + (h1 >> 2));
+}
+
+} // namespace fcl
+
+#endif
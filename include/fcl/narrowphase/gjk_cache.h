@@ -0,0 +1,128 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FCL_NARROWPHASE_GJKCACHE_H
+#define FCL_NARROWPHASE_GJKCACHE_H
+
+#include <functional>
+#include <unordered_map>
+#include <utility>
+
+#include "fcl/common/types.h"
+
+namespace fcl
+{
+
+template <typename S>
+class CollisionGeometry;
+
+/// @brief The final simplex of the previous GJK run on a pair of shapes,
+/// stored as the support directions of its vertices in the frame of the first
+/// shape. The next run on the pair evaluates the supports along these
+/// directions at the new poses and starts from the resulting simplex, so that
+/// it converges in a few iterations when the shapes moved little.
+template <typename S>
+struct FCL_EXPORT GJKSimplexCache
+{
+  /// @brief Support directions of the simplex vertices
+  Vector3<S> directions[4];
+
+  /// @brief Number of simplex vertices; 0 if no simplex is stored
+  unsigned int rank;
+
+  GJKSimplexCache();
+
+  /// @brief Forget the stored simplex
+  void clear();
+
+  /// @brief Whether no simplex is stored
+  bool empty() const;
+};
+
+/// @brief Temporal coherence cache of the GJK runs on pairs of shapes, e.g.,
+/// at each step of a simulation, holding one GJKSimplexCache per ordered pair
+/// of geometries.
+///
+/// A cache is passed to a query through CollisionRequest::gjk_cache or
+/// DistanceRequest::gjk_cache, and is used by the queries between two
+/// primitive shapes that run GJK with the GST_INDEP or GST_INLINE solver
+/// (GST_LIBCCD ignores it). The results are the same as without the cache, up
+/// to the tolerance of GJK. As the pairs are keyed by geometry, the same
+/// request can be used by the callbacks of a broadphase manager; the objects
+/// sharing a geometry share its entries, which is correct but warm starts
+/// less well. The cache is not thread safe.
+template <typename S>
+class FCL_EXPORT GJKCache
+{
+public:
+
+  /// @brief The simplex cache of the pair (o1, o2); an empty one is added on
+  /// first use
+  GJKSimplexCache<S>& get(const CollisionGeometry<S>* o1,
+                          const CollisionGeometry<S>* o2);
+
+  /// @brief Forget the pairs involving o, e.g., before it is destroyed
+  void erase(const CollisionGeometry<S>* o);
+
+  /// @brief Forget all the pairs
+  void clear();
+
+  /// @brief Number of pairs in the cache
+  std::size_t size() const;
+
+private:
+
+  using GeometryPair =
+      std::pair<const CollisionGeometry<S>*, const CollisionGeometry<S>*>;
+
+  struct GeometryPairHash
+  {
+    std::size_t operator()(const GeometryPair& pair) const;
+  };
+
+  std::unordered_map<GeometryPair, GJKSimplexCache<S>, GeometryPairHash>
+      simplices;
+};
+
+using GJKSimplexCachef = GJKSimplexCache<float>;
+using GJKSimplexCached = GJKSimplexCache<double>;
+using GJKCachef = GJKCache<float>;
+using GJKCached = GJKCache<double>;
+
+} // namespace fcl
+
+#include "fcl/narrowphase/gjk_cache-inl.h"
+
+#endif
@@ -41,8 +41,9 @@
 namespace fcl
 {
 
-/// @brief Type of narrow phase GJK solver
-enum GJKSolverType {GST_LIBCCD, GST_INDEP};
+/// @brief Type of narrow phase GJK solver. GST_INLINE runs the GJK of
+/// GST_INDEP with the support functions of the shapes resolved at compile time.
+enum GJKSolverType {GST_LIBCCD, GST_INDEP, GST_INLINE};
 
 } // namespace fcl
 
@@ -0,0 +1,99 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FCL_NARROWPHASE_QUERYCACHE_INL_H
+#define FCL_NARROWPHASE_QUERYCACHE_INL_H
+
+#include "fcl/narrowphase/query_cache.h"
+
+namespace fcl
+{
+
+//==============================================================================
+extern template
+class FCL_EXPORT QueryCache<double>;
+
+//==============================================================================
+template <typename S>
+QueryCache<S>::QueryCache()
+  : o1(nullptr),
+    o2(nullptr),
+    distance_query(false)
+{
+  // Do nothing
+}
+
+//==============================================================================
+template <typename S>
+void QueryCache<S>::clear()
+{
+  front_list.clear();
+}
+
+//==============================================================================
+template <typename S>
+std::size_t QueryCache<S>::size() const
+{
+  return front_list.size();
+}
+
+//==============================================================================
+template <typename S>
+bool QueryCache<S>::empty() const
+{
+  return front_list.empty();
+}
+
+//==============================================================================
+template <typename S>
+detail::BVHFrontList* QueryCache<S>::getFrontList(
+    const CollisionGeometry<S>* o1_,
+    const CollisionGeometry<S>* o2_,
+    bool distance_query_)
+{
+  if(o1 != o1_ || o2 != o2_ || distance_query != distance_query_)
+  {
+    front_list.clear();
+    o1 = o1_;
+    o2 = o2_;
+    distance_query = distance_query_;
+  }
+
+  return &front_list;
+}
+
+} // namespace fcl
+
+#endif
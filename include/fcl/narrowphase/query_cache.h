@@ -0,0 +1,107 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FCL_NARROWPHASE_QUERYCACHE_H
+#define FCL_NARROWPHASE_QUERYCACHE_H
+
+#include "fcl/common/types.h"
+#include "fcl/geometry/bvh/detail/BVH_front.h"
+
+namespace fcl
+{
+
+template <typename S>
+class CollisionGeometry;
+
+/// @brief Temporal coherence cache for the queries repeated on the same pair
+/// of geometries, e.g., at each step of a simulation. The cache stores the
+/// front of the bounding volume test tree (BVTT) where the previous query
+/// stopped, and the next query restarts from that front instead of from the
+/// roots. The results are the same as without the cache, but collision
+/// queries do not stop early at the first contact.
+///
+/// A cache is passed to a query through CollisionRequest::query_cache or
+/// DistanceRequest::query_cache, and is used by the queries involving a
+/// BVHModel. It belongs to one pair of geometries and one kind of query: when
+/// it is used for another pair or kind, it is cleared and rebuilt. It must be
+/// cleared when one of the models is rebuilt; refitting a model keeps it
+/// valid. The front only moves down the BVTT, so it is worth clearing it after
+/// a large motion too. With a cache, the models whose BVs are not oriented
+/// (e.g., AABB), which the queries transform to the world frame, are refitted
+/// there instead of rebuilt, so that their tree stays the one of the front.
+template <typename S>
+class FCL_EXPORT QueryCache
+{
+public:
+
+  /// @brief Creating an empty cache
+  QueryCache();
+
+  /// @brief Forget the stored front, so that the next query traverses the
+  /// BVTT from the roots
+  void clear();
+
+  /// @brief Number of BVTT nodes in the stored front
+  std::size_t size() const;
+
+  /// @brief Whether no front is stored
+  bool empty() const;
+
+  /// @brief The front list to use for a query between o1 and o2; it is cleared
+  /// first if the stored front was built for other geometries or for the
+  /// other kind of query
+  detail::BVHFrontList* getFrontList(const CollisionGeometry<S>* o1,
+                                     const CollisionGeometry<S>* o2,
+                                     bool distance_query);
+
+private:
+
+  detail::BVHFrontList front_list;
+
+  const CollisionGeometry<S>* o1;
+
+  const CollisionGeometry<S>* o2;
+
+  bool distance_query;
+};
+
+using QueryCachef = QueryCache<float>;
+using QueryCached = QueryCache<double>;
+
+} // namespace fcl
+
+#include "fcl/narrowphase/query_cache-inl.h"
+
+#endif
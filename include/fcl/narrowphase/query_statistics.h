@@ -0,0 +1,121 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FCL_NARROWPHASE_QUERYSTATISTICS_H
+#define FCL_NARROWPHASE_QUERYSTATISTICS_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "fcl/export.h"
+
+namespace fcl
+{
+
+/// @brief Statistics of the traversal made by a collision or distance query,
+/// reported in the result when the request enables them
+struct FCL_EXPORT QueryStatistics
+{
+  /// @brief Number of BV overlap or distance tests
+  std::size_t num_bv_tests;
+
+  /// @brief Number of leaf tests, i.e., of narrowphase tests between two
+  /// primitives (triangles or shapes)
+  std::size_t num_leaf_tests;
+
+  /// @brief Largest number of node pairs waiting to be visited by the
+  /// traversal. A depth first traversal pushes at most one more pair per
+  /// level it descends, so this is a lower bound of the depth it reached.
+  std::size_t max_stack_size;
+
+  /// @brief Number of node pairs in the front list of the query cache after
+  /// the query; 0 if the query used no cache
+  std::size_t front_size;
+
+  /// @brief Wall time spent in the traversal
+  double time_seconds;
+
+  /// @brief Statistics of no query
+  QueryStatistics();
+
+  /// @brief Accumulate the statistics of another query: the counts and times
+  /// are summed, the sizes are the largest of both
+  QueryStatistics& operator += (const QueryStatistics& other);
+};
+
+/// @brief Thread safe accumulator of the statistics of many queries, e.g. to
+/// monitor the cost of the queries of an application in production. Recording
+/// is lock free, and costs a few atomic operations per query.
+class FCL_EXPORT QueryStatisticsSink
+{
+public:
+
+  QueryStatisticsSink();
+
+  /// @brief Accumulate the statistics of one query
+  void record(const QueryStatistics& statistics);
+
+  /// @brief Number of queries recorded since the last reset()
+  std::size_t numQueries() const;
+
+  /// @brief Sum of the statistics recorded since the last reset(), as
+  /// accumulated by QueryStatistics::operator+=
+  QueryStatistics total() const;
+
+  /// @brief Forget the recorded statistics
+  void reset();
+
+  /// @brief Set the sink to which every query whose request enables the
+  /// statistics reports them, in addition to its result; nullptr, the
+  /// default, for none. The sink must outlive the queries that use it.
+  static void setGlobal(QueryStatisticsSink* sink);
+
+  /// @brief The sink set by setGlobal()
+  static QueryStatisticsSink* global();
+
+private:
+
+  std::atomic<std::uint64_t> num_queries;
+  std::atomic<std::uint64_t> num_bv_tests;
+  std::atomic<std::uint64_t> num_leaf_tests;
+  std::atomic<std::uint64_t> max_stack_size;
+  std::atomic<std::uint64_t> front_size;
+  std::atomic<std::uint64_t> time_nanoseconds;
+};
+
+} // namespace fcl
+
+#endif
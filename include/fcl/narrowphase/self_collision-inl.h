@@ -0,0 +1,70 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FCL_SELFCOLLISION_INL_H
+#define FCL_SELFCOLLISION_INL_H
+
+#include "fcl/narrowphase/self_collision.h"
+
+#include "fcl/narrowphase/detail/traversal/collision_node.h"
+#include "fcl/narrowphase/detail/traversal/collision/mesh_self_collision_traversal_node.h"
+
+namespace fcl
+{
+
+//==============================================================================
+template <typename BV>
+std::size_t selfCollide(const BVHModel<BV>* model,
+                        const SelfCollisionRequest<typename BV::S>& request,
+                        CollisionResult<typename BV::S>& result)
+{
+  detail::MeshSelfCollisionTraversalNode<BV> node;
+  if(!model || !detail::initialize(node, *model, request, result))
+    return 0;
+
+  detail::ScopedQueryStatistics<detail::MeshSelfCollisionTraversalNode<BV>>
+      statistics(node);
+
+  if(request.num_threads != 1)
+    detail::selfCollideParallel(&node, request.num_threads);
+  else
+    detail::selfCollideStatic(&node);
+
+  return result.numContacts();
+}
+
+} // namespace fcl
+
+#endif
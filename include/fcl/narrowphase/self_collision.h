@@ -0,0 +1,64 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FCL_SELFCOLLISION_H
+#define FCL_SELFCOLLISION_H
+
+#include "fcl/geometry/bvh/BVH_model.h"
+#include "fcl/narrowphase/collision_result.h"
+#include "fcl/narrowphase/self_collision_request.h"
+
+namespace fcl
+{
+
+/// @brief Self collision interface: finds the pairs of triangles of model that
+/// intersect each other, e.g., for cloth or cables that must not pass through
+/// themselves. The query is performed in the frame of the model, on its
+/// current vertices, so it also applies to models deformed by
+/// beginUpdateModel() ... endUpdateModel(), whose tree is refitted. The
+/// contacts report the same model as both geometries. The BVH is traversed by
+/// request.num_threads threads. Return value is the number of contacts
+/// generated; 0 if model is not a built triangle mesh.
+template <typename BV>
+FCL_EXPORT
+std::size_t selfCollide(const BVHModel<BV>* model,
+                        const SelfCollisionRequest<typename BV::S>& request,
+                        CollisionResult<typename BV::S>& result);
+
+} // namespace fcl
+
+#include "fcl/narrowphase/self_collision-inl.h"
+
+#endif
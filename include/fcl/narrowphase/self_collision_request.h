@@ -0,0 +1,80 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FCL_SELFCOLLISIONREQUEST_H
+#define FCL_SELFCOLLISIONREQUEST_H
+
+#include "fcl/narrowphase/collision_request.h"
+
+namespace fcl
+{
+
+/// @brief Parameters for performing the self collision of one mesh; see
+/// selfCollide(). The members inherited from CollisionRequest have the same
+/// meaning, except query_cache, which is ignored.
+template <typename S>
+struct FCL_EXPORT SelfCollisionRequest : CollisionRequest<S>
+{
+  /// @brief If true, the triangles that share a vertex are not tested against
+  /// each other. They always touch at the shared vertex or edge, which is not
+  /// a self collision of the surface. Vertices are identified by their index,
+  /// so meshes whose coincident vertices are duplicated must be welded first.
+  bool enable_adjacency_culling;
+
+  /// @brief If true, the subtrees of the BVH whose triangles form a connected
+  /// patch with all the normals in a cone of half angle below pi / 2 are not
+  /// tested against themselves: such a patch is a height field over the plane
+  /// orthogonal to the cone axis. This is the normal cone test of Volino and
+  /// Magnenat-Thalmann without its contour test, so it assumes that the
+  /// patches do not wind around the cone axis and overlap themselves, as for
+  /// cloth regions that are nearly flat. The cones are recomputed from the
+  /// current vertices by each query.
+  bool enable_normal_cone_culling;
+
+  /// @brief Default constructor
+  SelfCollisionRequest(size_t num_max_contacts_ = 1,
+                       bool enable_contact_ = false,
+                       bool enable_adjacency_culling_ = true,
+                       bool enable_normal_cone_culling_ = false);
+};
+
+using SelfCollisionRequestf = SelfCollisionRequest<float>;
+using SelfCollisionRequestd = SelfCollisionRequest<double>;
+
+} // namespace fcl
+
+#include "fcl/narrowphase/self_collision_request-inl.h"
+
+#endif
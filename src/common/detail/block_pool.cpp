@@ -0,0 +1,136 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "fcl/common/detail/block_pool.h"
+
+#include <cassert>
+#include <memory>
+#include <new>
+
+namespace fcl {
+namespace detail {
+
+namespace {
+
+constexpr std::size_t kBlockAlignment = alignof(std::max_align_t);
+
+constexpr std::size_t kNumSizeClasses
+    = maxPooledBlockSize() / kBlockAlignment;
+
+} // namespace
+
+//==============================================================================
+BlockPool::BlockPool(std::size_t block_size)
+  : block_size_((block_size + kBlockAlignment - 1) / kBlockAlignment
+                * kBlockAlignment),
+    free_list_(nullptr),
+    capacity_(0)
+{
+  if (block_size_ == 0)
+    block_size_ = kBlockAlignment;
+}
+
+//==============================================================================
+BlockPool::~BlockPool()
+{
+  for (void* chunk : chunks_)
+    ::operator delete(chunk);
+}
+
+//==============================================================================
+void* BlockPool::allocate()
+{
+  if (!free_list_)
+    grow();
+
+  Block* block = free_list_;
+  free_list_ = block->next;
+  return block;
+}
+
+//==============================================================================
+void BlockPool::release(void* block)
+{
+  Block* b = static_cast<Block*>(block);
+  b->next = free_list_;
+  free_list_ = b;
+}
+
+//==============================================================================
+std::size_t BlockPool::blockSize() const
+{
+  return block_size_;
+}
+
+//==============================================================================
+std::size_t BlockPool::capacity() const
+{
+  return capacity_;
+}
+
+//==============================================================================
+void BlockPool::grow()
+{
+  const std::size_t n = capacity_ ? capacity_ : 32;
+
+  char* chunk = static_cast<char*>(::operator new(n * block_size_));
+  chunks_.push_back(chunk);
+  capacity_ += n;
+
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    Block* block = reinterpret_cast<Block*>(chunk + i * block_size_);
+    block->next = free_list_;
+    free_list_ = block;
+  }
+}
+
+//==============================================================================
+BlockPool& threadLocalBlockPool(std::size_t size)
+{
+  assert(size > 0 && size <= maxPooledBlockSize());
+
+  static thread_local std::unique_ptr<BlockPool> pools[kNumSizeClasses];
+
+  const std::size_t size_class = (size - 1) / kBlockAlignment;
+  std::unique_ptr<BlockPool>& pool = pools[size_class];
+  if (!pool)
+    pool.reset(new BlockPool((size_class + 1) * kBlockAlignment));
+
+  return *pool;
+}
+
+} // namespace detail
+} // namespace fcl
@@ -0,0 +1,139 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "fcl/common/detail/work_stealing_pool.h"
+
+#include <algorithm>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace fcl {
+namespace detail {
+
+namespace {
+
+struct TaskQueue
+{
+  std::mutex mutex;
+  std::deque<std::size_t> tasks;
+};
+
+} // namespace
+
+//==============================================================================
+WorkStealingPool::WorkStealingPool(unsigned int num_threads)
+  : num_threads_(num_threads)
+{
+  if(num_threads_ == 0)
+    num_threads_ = std::max(1u, std::thread::hardware_concurrency());
+}
+
+//==============================================================================
+unsigned int WorkStealingPool::numThreads() const
+{
+  return num_threads_;
+}
+
+//==============================================================================
+void WorkStealingPool::run(
+    std::size_t num_tasks, const std::function<void(std::size_t)>& task) const
+{
+  const unsigned int num_threads = static_cast<unsigned int>(
+        std::min<std::size_t>(num_threads_, num_tasks));
+
+  if(num_threads <= 1)
+  {
+    for(std::size_t i = 0; i < num_tasks; ++i)
+      task(i);
+    return;
+  }
+
+  std::unique_ptr<TaskQueue[]> queues(new TaskQueue[num_threads]);
+  for(std::size_t i = 0; i < num_tasks; ++i)
+    queues[i % num_threads].tasks.push_back(i);
+
+  // No task is queued once the threads are started, so a thread can stop as
+  // soon as it finds all the queues empty
+  auto worker = [&](unsigned int id)
+  {
+    while(true)
+    {
+      std::size_t i = 0;
+      bool found = false;
+
+      {
+        std::lock_guard<std::mutex> lock(queues[id].mutex);
+        if(!queues[id].tasks.empty())
+        {
+          i = queues[id].tasks.front();
+          queues[id].tasks.pop_front();
+          found = true;
+        }
+      }
+
+      for(unsigned int k = 1; k < num_threads && !found; ++k)
+      {
+        TaskQueue& victim = queues[(id + k) % num_threads];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if(!victim.tasks.empty())
+        {
+          i = victim.tasks.back();
+          victim.tasks.pop_back();
+          found = true;
+        }
+      }
+
+      if(!found) return;
+
+      task(i);
+    }
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(num_threads - 1);
+  for(unsigned int id = 1; id < num_threads; ++id)
+    threads.emplace_back(worker, id);
+
+  worker(0);
+
+  for(std::thread& thread : threads)
+    thread.join();
+}
+
+} // namespace detail
+} // namespace fcl
@@ -50,4 +50,8 @@ template
 void BVHExpand(
     BVHModel<RSS<double>>& model, const Variance3<double>* ucs, double r);
 
+//==============================================================================
+template
+void BVHRefitIfPending(const CollisionGeometry<double>* geom);
+
 } // namespace fcl
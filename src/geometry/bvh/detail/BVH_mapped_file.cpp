@@ -0,0 +1,149 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "fcl/geometry/bvh/detail/BVH_mapped_file.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace fcl
+{
+
+namespace detail
+{
+
+//==============================================================================
+MappedFile::MappedFile(const std::string& filename)
+  : data_(nullptr), size_(0), file_handle_(nullptr), mapping_handle_(nullptr)
+{
+#ifdef _WIN32
+  HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                            nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL,
+                            nullptr);
+  if(file == INVALID_HANDLE_VALUE)
+    return;
+
+  LARGE_INTEGER file_size;
+  if(!GetFileSizeEx(file, &file_size) || file_size.QuadPart == 0)
+  {
+    CloseHandle(file);
+    return;
+  }
+
+  HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_WRITECOPY, 0, 0,
+                                      nullptr);
+  if(!mapping)
+  {
+    CloseHandle(file);
+    return;
+  }
+
+  void* view = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+  if(!view)
+  {
+    CloseHandle(mapping);
+    CloseHandle(file);
+    return;
+  }
+
+  data_ = static_cast<char*>(view);
+  size_ = static_cast<std::size_t>(file_size.QuadPart);
+  file_handle_ = file;
+  mapping_handle_ = mapping;
+#else
+  int fd = open(filename.c_str(), O_RDONLY);
+  if(fd < 0)
+    return;
+
+  struct stat st;
+  if(fstat(fd, &st) != 0 || st.st_size == 0)
+  {
+    close(fd);
+    return;
+  }
+
+  void* view = mmap(nullptr, static_cast<std::size_t>(st.st_size),
+                    PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+  // The mapping keeps its own reference to the file
+  close(fd);
+  if(view == MAP_FAILED)
+    return;
+
+  data_ = static_cast<char*>(view);
+  size_ = static_cast<std::size_t>(st.st_size);
+#endif
+}
+
+//==============================================================================
+MappedFile::~MappedFile()
+{
+  if(!data_)
+    return;
+
+#ifdef _WIN32
+  UnmapViewOfFile(data_);
+  CloseHandle(static_cast<HANDLE>(mapping_handle_));
+  CloseHandle(static_cast<HANDLE>(file_handle_));
+#else
+  munmap(data_, size_);
+#endif
+}
+
+//==============================================================================
+bool MappedFile::isOpen() const
+{
+  return data_ != nullptr;
+}
+
+//==============================================================================
+char* MappedFile::data() const
+{
+  return data_;
+}
+
+//==============================================================================
+std::size_t MappedFile::size() const
+{
+  return size_;
+}
+
+} // namespace detail
+} // namespace fcl
@@ -71,6 +71,10 @@ void constructBox(const KDOP<double, 18>& bv, Box<double>& box, Transform3<doubl
 template
 void constructBox(const KDOP<double, 24>& bv, Box<double>& box, Transform3<double>& tf);
 
+//==============================================================================
+template
+void constructBox(const FloatAABB<double>& bv, Box<double>& box, Transform3<double>& tf);
+
 //==============================================================================
 template
 void constructBox(const AABB<double>& bv, const Transform3<double>& tf_bv, Box<double>& box, Transform3<double>& tf);
@@ -103,6 +107,10 @@ void constructBox(const KDOP<double, 18>& bv, const Transform3<double>& tf_bv, B
 template
 void constructBox(const KDOP<double, 24>& bv, const Transform3<double>& tf_bv, Box<double>& box, Transform3<double>& tf);
 
+//==============================================================================
+template
+void constructBox(const FloatAABB<double>& bv, const Transform3<double>& tf_bv, Box<double>& box, Transform3<double>& tf);
+
 //==============================================================================
 namespace detail {
 //==============================================================================
@@ -71,4 +71,28 @@ bool obbDisjoint(
     const Vector3<double>& a,
     const Vector3<double>& b);
 
+//==============================================================================
+template
+struct OBBPairBatch<double>;
+
+//==============================================================================
+template <>
+void obbDisjointBatch(const OBBPairBatch<double>& batch, int n, bool disjoint[])
+{
+  int i = 0;
+
+#if defined(__AVX__)
+  for(; i + detail::AVXLane::width <= n; i += detail::AVXLane::width)
+    detail::obbDisjointLanes<detail::AVXLane>(batch, i, disjoint);
+#endif
+
+#if defined(__SSE2__)
+  for(; i + detail::SSE2Lane::width <= n; i += detail::SSE2Lane::width)
+    detail::obbDisjointLanes<detail::SSE2Lane>(batch, i, disjoint);
+#endif
+
+  for(; i < n; ++i)
+    detail::obbDisjointLanes<detail::ScalarLane<double>>(batch, i, disjoint);
+}
+
 } // namespace fcl
@@ -46,5 +46,30 @@ namespace detail
 template
 class Intersect<double>;
 
+//==============================================================================
+template
+struct TrianglePairBatch<double>;
+
+//==============================================================================
+template <>
+void triangleDisjointBatch(
+    const TrianglePairBatch<double>& batch, int n, bool disjoint[])
+{
+  int i = 0;
+
+#if defined(__AVX__)
+  for(; i + AVXLane::width <= n; i += AVXLane::width)
+    triangleDisjointLanes<AVXLane>(batch, i, disjoint);
+#endif
+
+#if defined(__SSE2__)
+  for(; i + SSE2Lane::width <= n; i += SSE2Lane::width)
+    triangleDisjointLanes<SSE2Lane>(batch, i, disjoint);
+#endif
+
+  for(; i < n; ++i)
+    triangleDisjointLanes<ScalarLane<double>>(batch, i, disjoint);
+}
+
 } // namespace detail
 } // namespace fcl
@@ -55,6 +55,14 @@ void selfCollide(CollisionTraversalNodeBase<double>* node, BVHFrontList* front_l
 template
 void distance(DistanceTraversalNodeBase<double>* node, BVHFrontList* front_list, int qsize);
 
+//==============================================================================
+template
+void collide(QuantizedBVHCollisionTraversalNode<double>* node);
+
+//==============================================================================
+template
+void distance(QuantizedBVHDistanceTraversalNode<double>* node);
+
 //==============================================================================
 template
 void collide2(MeshCollisionTraversalNodeOBB<double>* node, BVHFrontList* front_list);
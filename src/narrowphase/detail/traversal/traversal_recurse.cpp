@@ -47,6 +47,10 @@ namespace detail
 template
 void collisionRecurse(CollisionTraversalNodeBase<double>* node, int b1, int b2, BVHFrontList* front_list);
 
+//==============================================================================
+template
+void breadthFirstCollisionRecurse(CollisionTraversalNodeBase<double>* node, int b1, int b2);
+
 //==============================================================================
 template
 void collisionRecurse(MeshCollisionTraversalNodeOBB<double>* node, int b1, int b2, const Matrix3<double>& R, const Vector3<double>& T, BVHFrontList* front_list);
@@ -55,6 +59,10 @@ void collisionRecurse(MeshCollisionTraversalNodeOBB<double>* node, int b1, int b
 template
 void collisionRecurse(MeshCollisionTraversalNodeRSS<double>* node, int b1, int b2, const Matrix3<double>& R, const Vector3<double>& T, BVHFrontList* front_list);
 
+//==============================================================================
+template
+void collisionRecurse(QuantizedBVHCollisionTraversalNode<double>* node, int b1, int b2, const AABB<double>& bv1, const AABB<double>& bv2);
+
 //==============================================================================
 template
 void selfCollisionRecurse(CollisionTraversalNodeBase<double>* node, int b, BVHFrontList* front_list);
@@ -63,6 +71,10 @@ void selfCollisionRecurse(CollisionTraversalNodeBase<double>* node, int b, BVHFr
 template
 void distanceRecurse(DistanceTraversalNodeBase<double>* node, int b1, int b2, BVHFrontList* front_list);
 
+//==============================================================================
+template
+void distanceRecurse(QuantizedBVHDistanceTraversalNode<double>* node, int b1, int b2, const AABB<double>& bv1, const AABB<double>& bv2);
+
 //==============================================================================
 template
 void distanceQueueRecurse(DistanceTraversalNodeBase<double>* node, int b1, int b2, BVHFrontList* front_list, int qsize);
@@ -71,5 +83,9 @@ void distanceQueueRecurse(DistanceTraversalNodeBase<double>* node, int b1, int b
 template
 void propagateBVHFrontListCollisionRecurse(CollisionTraversalNodeBase<double>* node, BVHFrontList* front_list);
 
+//==============================================================================
+template
+void propagateBVHFrontListDistanceRecurse(DistanceTraversalNodeBase<double>* node, BVHFrontList* front_list);
+
 } // namespace detail
 } // namespace fcl
@@ -0,0 +1,143 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "fcl/narrowphase/query_statistics.h"
+
+#include <algorithm>
+
+namespace fcl
+{
+
+namespace
+{
+
+std::atomic<QueryStatisticsSink*> global_sink(nullptr);
+
+//==============================================================================
+void atomicMax(std::atomic<std::uint64_t>& value, std::uint64_t other)
+{
+  std::uint64_t current = value.load(std::memory_order_relaxed);
+  while(current < other
+        && !value.compare_exchange_weak(current, other, std::memory_order_relaxed))
+  {
+    // current was reloaded by compare_exchange_weak()
+  }
+}
+
+} // namespace
+
+//==============================================================================
+QueryStatistics::QueryStatistics()
+  : num_bv_tests(0),
+    num_leaf_tests(0),
+    max_stack_size(0),
+    front_size(0),
+    time_seconds(0)
+{
+  // Do nothing
+}
+
+//==============================================================================
+QueryStatistics& QueryStatistics::operator += (const QueryStatistics& other)
+{
+  num_bv_tests += other.num_bv_tests;
+  num_leaf_tests += other.num_leaf_tests;
+  max_stack_size = std::max(max_stack_size, other.max_stack_size);
+  front_size = std::max(front_size, other.front_size);
+  time_seconds += other.time_seconds;
+  return *this;
+}
+
+//==============================================================================
+QueryStatisticsSink::QueryStatisticsSink()
+{
+  reset();
+}
+
+//==============================================================================
+void QueryStatisticsSink::record(const QueryStatistics& statistics)
+{
+  num_queries.fetch_add(1, std::memory_order_relaxed);
+  num_bv_tests.fetch_add(statistics.num_bv_tests, std::memory_order_relaxed);
+  num_leaf_tests.fetch_add(statistics.num_leaf_tests, std::memory_order_relaxed);
+  atomicMax(max_stack_size, statistics.max_stack_size);
+  atomicMax(front_size, statistics.front_size);
+  time_nanoseconds.fetch_add(
+        static_cast<std::uint64_t>(statistics.time_seconds * 1e9),
+        std::memory_order_relaxed);
+}
+
+//==============================================================================
+std::size_t QueryStatisticsSink::numQueries() const
+{
+  return num_queries.load(std::memory_order_relaxed);
+}
+
+//==============================================================================
+QueryStatistics QueryStatisticsSink::total() const
+{
+  QueryStatistics statistics;
+  statistics.num_bv_tests = num_bv_tests.load(std::memory_order_relaxed);
+  statistics.num_leaf_tests = num_leaf_tests.load(std::memory_order_relaxed);
+  statistics.max_stack_size = max_stack_size.load(std::memory_order_relaxed);
+  statistics.front_size = front_size.load(std::memory_order_relaxed);
+  statistics.time_seconds = time_nanoseconds.load(std::memory_order_relaxed) * 1e-9;
+  return statistics;
+}
+
+//==============================================================================
+void QueryStatisticsSink::reset()
+{
+  num_queries.store(0);
+  num_bv_tests.store(0);
+  num_leaf_tests.store(0);
+  max_stack_size.store(0);
+  front_size.store(0);
+  time_nanoseconds.store(0);
+}
+
+//==============================================================================
+void QueryStatisticsSink::setGlobal(QueryStatisticsSink* sink)
+{
+  global_sink.store(sink);
+}
+
+//==============================================================================
+QueryStatisticsSink* QueryStatisticsSink::global()
+{
+  return global_sink.load();
+}
+
+} // namespace fcl
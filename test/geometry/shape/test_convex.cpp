@@ -38,6 +38,9 @@
 
 #include "fcl/geometry/shape/convex.h"
 
+#include <algorithm>
+#include <limits>
+#include <random>
 #include <vector>
 
 #include <Eigen/StdVector>
@@ -513,6 +516,86 @@ GTEST_TEST(ConvexGeometry, CenterOfMass_Tetrahedron) {
   }
 }
 
+// Builds a polytope inscribed in the unit sphere, with `num_rings` rings of
+// `num_segments` vertices between the two poles, quadrilateral faces between
+// the rings, and triangles around the poles.
+template <typename S>
+Convex<S> MakeSpherePolytope(int num_rings, int num_segments) {
+  auto vertices = std::make_shared<std::vector<Vector3<S>>>();
+  auto faces = std::make_shared<std::vector<int>>();
+  const S pi = constants<S>::pi();
+  for (int i = 0; i < num_rings; ++i) {
+    const S theta = pi * (i + 1) / (num_rings + 1);
+    for (int j = 0; j < num_segments; ++j) {
+      const S phi = 2 * pi * j / num_segments;
+      vertices->emplace_back(std::sin(theta) * std::cos(phi),
+                             std::sin(theta) * std::sin(phi), std::cos(theta));
+    }
+  }
+  const int north = static_cast<int>(vertices->size());
+  vertices->emplace_back(0, 0, 1);
+  const int south = north + 1;
+  vertices->emplace_back(0, 0, -1);
+
+  int num_faces = 0;
+  auto ring_vertex = [num_segments](int ring, int j) {
+    return ring * num_segments + (j % num_segments);
+  };
+  for (int j = 0; j < num_segments; ++j) {
+    faces->insert(faces->end(),
+                  {3, north, ring_vertex(0, j), ring_vertex(0, j + 1)});
+    faces->insert(faces->end(), {3, south, ring_vertex(num_rings - 1, j + 1),
+                                 ring_vertex(num_rings - 1, j)});
+    num_faces += 2;
+    for (int i = 0; i + 1 < num_rings; ++i) {
+      faces->insert(faces->end(),
+                    {4, ring_vertex(i, j), ring_vertex(i + 1, j),
+                     ring_vertex(i + 1, j + 1), ring_vertex(i, j + 1)});
+      ++num_faces;
+    }
+  }
+
+  return Convex<S>(vertices, num_faces, faces);
+}
+
+// Confirms that the support vertex found by hill climbing, from any start,
+// projects as far as the support vertex found by a linear scan.
+template <typename S>
+void testFindExtremeVertex(int num_rings, int num_segments) {
+  const Convex<S> convex = MakeSpherePolytope<S>(num_rings, num_segments);
+  const std::vector<Vector3<S>>& vertices = convex.getVertices();
+  const int num_vertices = static_cast<int>(vertices.size());
+
+  std::mt19937 generator(1234);
+  std::normal_distribution<S> normal;
+  for (int k = 0; k < 200; ++k) {
+    const Vector3<S> dir(normal(generator), normal(generator),
+                         normal(generator));
+    S max_dot = -std::numeric_limits<S>::max();
+    for (const auto& vertex : vertices) {
+      max_dot = std::max(max_dot, dir.dot(vertex));
+    }
+
+    for (int start : {0, k % num_vertices, num_vertices - 1}) {
+      const int index = convex.findExtremeVertex(dir, start);
+      GTEST_ASSERT_GE(index, 0);
+      GTEST_ASSERT_LT(index, num_vertices);
+      EXPECT_EQ(dir.dot(vertices[index]), max_dot)
+          << "from vertex " << start << " of " << num_vertices
+          << " using scalar: " << ScalarString<S>::value();
+    }
+  }
+}
+
+GTEST_TEST(ConvexGeometry, FindExtremeVertex) {
+  // Small enough for the linear scan.
+  testFindExtremeVertex<double>(2, 8);
+  testFindExtremeVertex<float>(2, 8);
+  // Searched by hill climbing.
+  testFindExtremeVertex<double>(30, 60);
+  testFindExtremeVertex<float>(30, 60);
+}
+
 // TODO(SeanCurtis-TRI): Add Tetrahedron inertia unit test.
 
 // TODO(SeanCurtis-TRI): Extend the moment of inertia test.
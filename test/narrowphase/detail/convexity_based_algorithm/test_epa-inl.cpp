@@ -0,0 +1,202 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** Tests the EPA algorithm of GJKSolver_indep on deep penetrations between
+ * convex shapes with many vertices, where the polytope outgrows its initial
+ * capacity, and checks that its storage is reused across queries.
+ */
+
+#include "fcl/narrowphase/detail/convexity_based_algorithm/epa.h"
+
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "fcl/narrowphase/detail/gjk_solver_indep.h"
+
+namespace {
+
+std::atomic<long> num_allocations(0);
+
+void* countedAllocate(std::size_t size) {
+  ++num_allocations;
+  void* p = std::malloc(size == 0 ? 1 : size);
+  if (!p) throw std::bad_alloc();
+  return p;
+}
+
+}  // namespace
+
+void* operator new(std::size_t size) { return countedAllocate(size); }
+void* operator new[](std::size_t size) { return countedAllocate(size); }
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+  ++num_allocations;
+  return std::malloc(size == 0 ? 1 : size);
+}
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+  ++num_allocations;
+  return std::malloc(size == 0 ? 1 : size);
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+
+namespace fcl {
+namespace detail {
+namespace {
+
+// A convex polytope inscribed in a sphere of the given radius, with `rings`
+// rings of `segments` vertices each between the two poles.
+template <typename S>
+Convex<S> MakeSphere(S radius, int rings, int segments) {
+  const S pi = constants<S>::pi();
+  auto vertices = std::make_shared<std::vector<Vector3<S>>>();
+  vertices->emplace_back(0, 0, radius);
+  for (int i = 1; i <= rings; ++i) {
+    const S theta = pi * i / (rings + 1);
+    for (int j = 0; j < segments; ++j) {
+      const S phi = 2 * pi * j / segments;
+      vertices->emplace_back(radius * std::sin(theta) * std::cos(phi),
+                             radius * std::sin(theta) * std::sin(phi),
+                             radius * std::cos(theta));
+    }
+  }
+  vertices->emplace_back(0, 0, -radius);
+  const int south = static_cast<int>(vertices->size()) - 1;
+
+  auto ring_vertex = [segments](int ring, int j) {
+    return 1 + ring * segments + (j % segments);
+  };
+
+  auto faces = std::make_shared<std::vector<int>>();
+  int num_faces = 0;
+  for (int j = 0; j < segments; ++j) {
+    faces->insert(faces->end(),
+                  {3, 0, ring_vertex(0, j), ring_vertex(0, j + 1)});
+    faces->insert(faces->end(), {3, south, ring_vertex(rings - 1, j + 1),
+                                 ring_vertex(rings - 1, j)});
+    num_faces += 2;
+  }
+  for (int i = 0; i + 1 < rings; ++i) {
+    for (int j = 0; j < segments; ++j) {
+      faces->insert(faces->end(),
+                    {4, ring_vertex(i, j), ring_vertex(i + 1, j),
+                     ring_vertex(i + 1, j + 1), ring_vertex(i, j + 1)});
+      ++num_faces;
+    }
+  }
+  return Convex<S>(vertices, num_faces, faces);
+}
+
+// The penetration depth of two spheres of radius 1 at `distance` apart is
+// 2 - distance; the inscribed polytopes are slightly shallower.
+template <typename S>
+void CheckDeepPenetration(const GJKSolver_indep<S>& solver, S distance) {
+  const Convex<S> sphere = MakeSphere<S>(1, 16, 32);
+  const Vector3<S> axis = Vector3<S>(1, 2, 3).normalized();
+  Transform3<S> X_WB = Transform3<S>::Identity();
+  X_WB.translation() = axis * distance;
+
+  std::vector<ContactPoint<S>> contacts;
+  ASSERT_TRUE(solver.shapeIntersect(sphere, Transform3<S>::Identity(), sphere,
+                                    X_WB, &contacts));
+  GTEST_ASSERT_EQ(contacts.size(), 1u);
+  const ContactPoint<S>& contact = contacts[0];
+  EXPECT_NEAR(-contact.penetration_depth, 2 - distance, 0.03);
+  EXPECT_GT(contact.normal.dot(axis), 0.99);
+}
+
+template <typename S>
+void TestGrowth() {
+  GJKSolver_indep<S> solver;
+  solver.epa_max_face_num = 4;
+  solver.epa_max_vertex_num = 4;
+  solver.epa_max_iterations = 1000;
+  for (S distance : {0.1, 0.5, 1.0, 1.5}) {
+    CheckDeepPenetration(solver, distance);
+  }
+}
+
+GTEST_TEST(EPATest, GrowsBeyondInitialCapacity) {
+  TestGrowth<double>();
+  TestGrowth<float>();
+}
+
+template <typename S>
+void TestNoAllocation() {
+  const Convex<S> sphere = MakeSphere<S>(1, 16, 32);
+  Transform3<S> X_WB = Transform3<S>::Identity();
+  X_WB.translation() << 0.2, 0.3, 0.1;
+
+  GJKSolver_indep<S> solver;
+  solver.epa_max_face_num = 4;
+  solver.epa_max_vertex_num = 4;
+  solver.epa_max_iterations = 1000;
+
+  std::vector<ContactPoint<S>> contacts;
+  contacts.reserve(4);
+  // The first query grows the storage of the thread.
+  EXPECT_TRUE(solver.shapeIntersect(sphere, Transform3<S>::Identity(), sphere,
+                                    X_WB, &contacts));
+
+  const long allocations_before = num_allocations;
+  for (int i = 0; i < 3; ++i) {
+    contacts.clear();
+    EXPECT_TRUE(solver.shapeIntersect(sphere, Transform3<S>::Identity(),
+                                      sphere, X_WB, &contacts));
+  }
+  EXPECT_EQ(num_allocations - allocations_before, 0);
+}
+
+GTEST_TEST(EPATest, ReusesStorageAcrossQueries) {
+  TestNoAllocation<double>();
+  TestNoAllocation<float>();
+}
+
+}  // namespace
+}  // namespace detail
+}  // namespace fcl
+
+//==============================================================================
+int main(int argc, char* argv[]) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,162 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** Tests the warm start of the GJK algorithm of GJKSolver_indep from the
+ * simplex stored in a GJKSimplexCache.
+ */
+
+#include "fcl/narrowphase/detail/convexity_based_algorithm/gjk.h"
+
+#include <gtest/gtest.h>
+
+#include "fcl/geometry/shape/box.h"
+#include "fcl/geometry/shape/cylinder.h"
+
+namespace fcl {
+namespace detail {
+namespace {
+
+// A Minkowski difference counting the support evaluations of GJK.
+template <typename S>
+struct CountingMinkowskiDiff : public MinkowskiDiff<S> {
+  using MinkowskiDiff<S>::support;
+
+  Vector3<S> support(const Vector3<S>& d) const {
+    ++*count;
+    return MinkowskiDiff<S>::support(d);
+  }
+
+  int* count{nullptr};
+};
+
+template <typename S>
+struct GJKRun {
+  typename GJK<S, CountingMinkowskiDiff<S>>::Status status;
+  S distance;
+  int supports;
+};
+
+template <typename S>
+GJKRun<S> RunGJK(const ShapeBase<S>& s1, const Transform3<S>& tf1,
+                 const ShapeBase<S>& s2, const Transform3<S>& tf2,
+                 GJKSimplexCache<S>* cache) {
+  GJKRun<S> run;
+  run.supports = 0;
+
+  CountingMinkowskiDiff<S> shape;
+  shape.shapes[0] = &s1;
+  shape.shapes[1] = &s2;
+  shape.toshape1.noalias() = tf2.linear().transpose() * tf1.linear();
+  shape.toshape0 = tf1.inverse(Eigen::Isometry) * tf2;
+  shape.count = &run.supports;
+
+  GJK<S, CountingMinkowskiDiff<S>> gjk(128, 1e-6);
+  run.status = gjk.evaluate(shape, Vector3<S>(-1, 0, 0), cache);
+  run.distance = gjk.distance;
+  return run;
+}
+
+template <typename S>
+void TestWarmStart(const Vector3<S>& translation) {
+  const Box<S> box(1, 2, 3);
+  const Cylinder<S> cylinder(0.5, 2);
+  const Transform3<S> tf1 = Transform3<S>::Identity();
+  Transform3<S> tf2 = Transform3<S>::Identity();
+  tf2.translation() = translation;
+  tf2.linear() = AngleAxis<S>(0.3, Vector3<S>(1, 1, 0).normalized())
+                     .toRotationMatrix();
+
+  GJKSimplexCache<S> cache;
+  EXPECT_TRUE(cache.empty());
+  RunGJK(box, tf1, cylinder, tf2, &cache);
+  EXPECT_FALSE(cache.empty());
+
+  for (int step = 0; step < 10; ++step) {
+    tf2.translation() += Vector3<S>(1e-3, -2e-3, 1e-3);
+    tf2.linear() = tf2.linear() *
+                   AngleAxis<S>(0.01, Vector3<S>::UnitZ()).toRotationMatrix();
+
+    const GJKRun<S> cold = RunGJK<S>(box, tf1, cylinder, tf2, nullptr);
+    const GJKRun<S> warm = RunGJK<S>(box, tf1, cylinder, tf2, &cache);
+
+    EXPECT_EQ(cold.status, warm.status);
+    EXPECT_NEAR(cold.distance, warm.distance, 1e-5);
+    EXPECT_LT(warm.supports, cold.supports);
+  }
+}
+
+// A separated pair converges to the same distance from the cached simplex,
+// with fewer support evaluations.
+GTEST_TEST(GJKSimplexCache, WarmStartSeparated) {
+  TestWarmStart<double>(Vector3<double>(1.5, 0.5, 0.2));
+}
+
+// An intersecting pair is found inside from the cached tetrahedron.
+GTEST_TEST(GJKSimplexCache, WarmStartIntersecting) {
+  TestWarmStart<double>(Vector3<double>(1.1, 0.5, 0.2));
+}
+
+// A cache whose support points have merged, or stored for another pair, still
+// gives the result of a cold start.
+GTEST_TEST(GJKSimplexCache, DegenerateCache) {
+  const Box<double> box(1, 2, 3);
+  const Cylinder<double> cylinder(0.5, 2);
+  const Transform3d tf1 = Transform3d::Identity();
+  Transform3d tf2 = Transform3d::Identity();
+  tf2.translation() = Vector3d(2, 0.3, 0.1);
+
+  GJKSimplexCache<double> cache;
+  cache.rank = 3;
+  cache.directions[0] = cache.directions[1] = cache.directions[2] =
+      Vector3d(1, 1, 1).normalized();
+
+  const GJKRun<double> cold = RunGJK<double>(box, tf1, cylinder, tf2, nullptr);
+  const GJKRun<double> warm = RunGJK<double>(box, tf1, cylinder, tf2, &cache);
+  EXPECT_EQ(cold.status, warm.status);
+  EXPECT_NEAR(cold.distance, warm.distance, 1e-5);
+
+  cache.clear();
+  EXPECT_TRUE(cache.empty());
+}
+
+}  // namespace
+}  // namespace detail
+}  // namespace fcl
+
+//==============================================================================
+int main(int argc, char* argv[]) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
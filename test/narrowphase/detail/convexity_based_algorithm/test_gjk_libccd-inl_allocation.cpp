@@ -0,0 +1,168 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** Tests that the libccd solver does not allocate on the heap once the
+ * per-thread pools used by its GJK objects and EPA polytopes are warm.
+ */
+
+#include <atomic>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "fcl/narrowphase/detail/gjk_solver_libccd.h"
+
+namespace {
+
+std::atomic<long> num_allocations(0);
+
+void* countedAllocate(std::size_t size) {
+  ++num_allocations;
+  void* p = std::malloc(size == 0 ? 1 : size);
+  if (!p) throw std::bad_alloc();
+  return p;
+}
+
+}  // namespace
+
+// Every allocation of the process goes through these replacements, including
+// the ones made inside the fcl library.
+void* operator new(std::size_t size) { return countedAllocate(size); }
+void* operator new[](std::size_t size) { return countedAllocate(size); }
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+  ++num_allocations;
+  return std::malloc(size == 0 ? 1 : size);
+}
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+  ++num_allocations;
+  return std::malloc(size == 0 ? 1 : size);
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+
+namespace fcl {
+namespace detail {
+
+template <typename S>
+Convex<S> MakeCube(S half_size) {
+  auto vertices = std::make_shared<std::vector<Vector3<S>>>();
+  for (int i = 0; i < 8; ++i) {
+    vertices->emplace_back((i & 1) ? half_size : -half_size,
+                           (i & 2) ? half_size : -half_size,
+                           (i & 4) ? half_size : -half_size);
+  }
+  auto faces = std::make_shared<std::vector<int>>(std::vector<int>{
+      4, 0, 2, 3, 1,  4, 4, 5, 7, 6,  4, 0, 1, 5, 4,
+      4, 2, 6, 7, 3,  4, 0, 4, 6, 2,  4, 1, 3, 7, 5});
+  return Convex<S>(vertices, 6, faces);
+}
+
+// Runs a set of queries covering the MPR, GJK and EPA paths of the solver, at
+// a few poses, so that the EPA builds polytopes of different sizes.
+template <typename S>
+void RunQueries(const GJKSolver_libccd<S>& solver, const Convex<S>& cube,
+                std::vector<ContactPoint<S>>* contacts) {
+  const Box<S> box(1, 2, 3);
+  const Cylinder<S> cylinder(0.5, 2);
+  const Cone<S> cone(0.5, 1);
+  const Ellipsoid<S> ellipsoid(0.4, 0.6, 0.8);
+  const Vector3<S> P1(-1, -1, 0), P2(1, -1, 0), P3(0, 1, 0);
+
+  for (int i = 0; i < 8; ++i) {
+    Transform3<S> X_WA = Transform3<S>::Identity();
+    X_WA.linear() =
+        AngleAxis<S>(0.3 * i, Vector3<S>(1, 2, 3).normalized()).matrix();
+    Transform3<S> X_WB = Transform3<S>::Identity();
+    X_WB.translation() << 0.1 * i, 0.3, 0.2;
+    Transform3<S> X_WFar = Transform3<S>::Identity();
+    X_WFar.translation() << 5, 0.1 * i, 0;
+
+    S dist;
+    Vector3<S> p1, p2, point, normal;
+    S depth;
+
+    contacts->clear();
+    EXPECT_TRUE(solver.shapeIntersect(box, X_WA, cylinder, X_WB, contacts));
+    contacts->clear();
+    EXPECT_TRUE(solver.shapeIntersect(cube, X_WA, box, X_WB, contacts));
+    EXPECT_TRUE(solver.shapeTriangleIntersect(cone, X_WB, P1, P2, P3, &point,
+                                              &depth, &normal));
+    EXPECT_TRUE(solver.shapeTriangleIntersect(cube, X_WA, P1, P2, P3, X_WB,
+                                              &point, &depth, &normal));
+    EXPECT_TRUE(
+        solver.shapeDistance(box, X_WA, cylinder, X_WFar, &dist, &p1, &p2));
+    EXPECT_TRUE(
+        solver.shapeDistance(cube, X_WA, ellipsoid, X_WFar, &dist, &p1, &p2));
+    solver.shapeSignedDistance(box, X_WA, cylinder, X_WB, &dist, &p1, &p2);
+    EXPECT_LT(dist, 0);
+    solver.shapeSignedDistance(ellipsoid, X_WA, cube, X_WB, &dist, &p1, &p2);
+    EXPECT_LT(dist, 0);
+  }
+}
+
+template <typename S>
+void TestNoAllocationInSteadyState() {
+  GJKSolver_libccd<S> solver;
+  const Convex<S> cube = MakeCube<S>(0.5);
+  std::vector<ContactPoint<S>> contacts;
+  contacts.reserve(4);
+
+  // The first pass grows the pools to the working set of the queries.
+  RunQueries(solver, cube, &contacts);
+
+  const long before = num_allocations.load();
+  RunQueries(solver, cube, &contacts);
+  RunQueries(solver, cube, &contacts);
+  EXPECT_EQ(num_allocations.load() - before, 0);
+}
+
+GTEST_TEST(FCL_GJK_LIBCCD, NoAllocationInSteadyState) {
+  TestNoAllocationInSteadyState<double>();
+  TestNoAllocationInSteadyState<float>();
+}
+
+}  // namespace detail
+}  // namespace fcl
+
+//==============================================================================
+int main(int argc, char* argv[]) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -43,6 +43,8 @@
 
 #include <array>
 #include <memory>
+#include <unordered_map>
+#include <unordered_set>
 
 #include <gtest/gtest.h>
 
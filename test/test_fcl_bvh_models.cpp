@@ -38,8 +38,16 @@
 
 #include "fcl/config.h"
 #include "fcl/geometry/bvh/BVH_model.h"
+#include "fcl/geometry/bvh/BVH_quantized_model.h"
+#include "fcl/geometry/bvh/BVH_serialization.h"
+#include "fcl/geometry/geometric_shape_to_BVH_model.h"
+#include "fcl/narrowphase/collision.h"
+#include "fcl/narrowphase/distance.h"
 #include "test_fcl_utility.h"
+#include <cstdio>
+#include <functional>
 #include <iostream>
+#include <type_traits>
 
 using namespace fcl;
 
@@ -194,12 +202,184 @@ void testBVHModelSubModel()
   EXPECT_EQ(model->build_state, BVH_BUILD_STATE_PROCESSED);
 }
 
+template<typename BV>
+void testBVHModelSharedTopology()
+{
+  using S = typename BV::S;
+
+  std::shared_ptr<BVHModel<BV> > model(new BVHModel<BV>);
+  Box<S> box(1, 1, 1);
+  std::vector<Vector3<S>> points;
+  generateBVHModel(*model, box, Transform3<S>::Identity());
+  points.assign(model->vertices, model->vertices + model->num_vertices);
+
+  EXPECT_FALSE(model->isTopologyShared());
+
+  // Copies share the triangles but own their vertices and BV nodes
+  std::shared_ptr<BVHModel<BV> > instance(new BVHModel<BV>(*model));
+  EXPECT_TRUE(model->isTopologyShared());
+  EXPECT_TRUE(instance->isTopologyShared());
+  EXPECT_EQ(instance->tri_indices, model->tri_indices);
+  EXPECT_NE(instance->vertices, model->vertices);
+  EXPECT_EQ(instance->getNumBVs(), model->getNumBVs());
+
+  // Move the instance; the refit is deferred until the first query
+  const Vector3<S> offset(10, 0, 0);
+  std::shared_ptr<BVHModel<BV> > eager(new BVHModel<BV>(*model));
+  instance->lazy_refit = true;
+  EXPECT_EQ(instance->beginReplaceModel(), BVH_OK);
+  EXPECT_EQ(eager->beginReplaceModel(), BVH_OK);
+  for(std::size_t i = 0; i < points.size(); ++i)
+  {
+    EXPECT_EQ(instance->replaceVertex(points[i] + offset), BVH_OK);
+    EXPECT_EQ(eager->replaceVertex(points[i] + offset), BVH_OK);
+  }
+  EXPECT_EQ(instance->endReplaceModel(), BVH_OK);
+  EXPECT_EQ(eager->endReplaceModel(), BVH_OK);
+  EXPECT_TRUE(instance->isRefitPending());
+  EXPECT_FALSE(eager->isRefitPending());
+
+  // A small sphere touching the +x face of the moved box; the deferred refit
+  // gives the same answer as the immediate one
+  Sphere<S> sphere(0.1);
+  const Vector3<S> face(0.5, 0, 0);
+  CollisionRequest<S> request;
+  CollisionResult<S> result;
+  collide(eager.get(), Transform3<S>::Identity(),
+          &sphere, Transform3<S>(Translation3<S>(offset + face)),
+          request, result);
+  const bool eager_collision = result.isCollision();
+
+  result.clear();
+  collide(instance.get(), Transform3<S>::Identity(),
+          &sphere, Transform3<S>(Translation3<S>(offset + face)),
+          request, result);
+  EXPECT_FALSE(instance->isRefitPending());
+  EXPECT_EQ(result.isCollision(), eager_collision);
+  for(int i = 0; i < instance->getNumBVs(); ++i)
+  {
+    EXPECT_TRUE(instance->getBV(i).bv.center().isApprox(
+                  eager->getBV(i).bv.center()));
+  }
+
+  result.clear();
+  collide(model.get(), Transform3<S>::Identity(),
+          &sphere, Transform3<S>(Translation3<S>(offset + face)),
+          request, result);
+  EXPECT_FALSE(result.isCollision());
+
+  // Rebuilding the hierarchy of one instance does not affect the other one
+  EXPECT_EQ(instance->beginReplaceModel(), BVH_OK);
+  for(std::size_t i = 0; i < points.size(); ++i)
+    EXPECT_EQ(instance->replaceVertex(points[i]), BVH_OK);
+  EXPECT_EQ(instance->endReplaceModel(false), BVH_OK);
+  EXPECT_EQ(instance->tri_indices, model->tri_indices);
+
+  // The shared data outlives the model it was created from
+  model.reset();
+  eager.reset();
+  EXPECT_FALSE(instance->isTopologyShared());
+  result.clear();
+  collide(instance.get(), Transform3<S>::Identity(),
+          &sphere, Transform3<S>(Translation3<S>(face)), request, result);
+  EXPECT_TRUE(result.isCollision());
+}
+
+template<typename BV>
+void testBVHModelSerialization()
+{
+  using S = typename BV::S;
+
+  const std::string filename = "test_fcl_bvh_models.bvh";
+
+  std::shared_ptr<BVHModel<BV> > model(new BVHModel<BV>);
+  EXPECT_EQ(saveBVHModel(*model, filename), BVH_ERR_BUILD_OUT_OF_SEQUENCE);
+
+  Box<S> box(1, 1, 1);
+  generateBVHModel(*model, box, Transform3<S>::Identity());
+  EXPECT_EQ(saveBVHModel(*model, filename), BVH_OK);
+
+  std::shared_ptr<BVHModel<BV> > loaded = loadBVHModel<BV>(filename);
+  ASSERT_TRUE(loaded != nullptr);
+  EXPECT_EQ(loaded->build_state, BVH_BUILD_STATE_PROCESSED);
+  EXPECT_EQ(loaded->getModelType(), BVH_MODEL_TRIANGLES);
+  EXPECT_EQ(loaded->num_vertices, model->num_vertices);
+  EXPECT_EQ(loaded->num_tris, model->num_tris);
+  EXPECT_EQ(loaded->getNumBVs(), model->getNumBVs());
+  EXPECT_TRUE(loaded->aabb_local.equal(model->aabb_local));
+  EXPECT_EQ(loaded->aabb_radius, model->aabb_radius);
+  for(int i = 0; i < model->num_vertices; ++i)
+    EXPECT_EQ(loaded->vertices[i], model->vertices[i]);
+  for(int i = 0; i < model->num_tris; ++i)
+  {
+    for(int j = 0; j < 3; ++j)
+      EXPECT_EQ(loaded->tri_indices[i][j], model->tri_indices[i][j]);
+  }
+  for(int i = 0; i < model->getNumBVs(); ++i)
+  {
+    EXPECT_EQ(loaded->getBV(i).first_child, model->getBV(i).first_child);
+    EXPECT_EQ(loaded->getBV(i).first_primitive, model->getBV(i).first_primitive);
+    EXPECT_EQ(loaded->getBV(i).num_primitives, model->getBV(i).num_primitives);
+    EXPECT_EQ(loaded->getBV(i).bv.center(), model->getBV(i).bv.center());
+  }
+
+  Sphere<S> sphere(0.1);
+  const Transform3<S> pose(Translation3<S>(Vector3<S>(0.5, 0, 0)));
+  CollisionRequest<S> request;
+  CollisionResult<S> result;
+  collide(model.get(), Transform3<S>::Identity(), &sphere, pose, request, result);
+  const bool expected = result.isCollision();
+  result.clear();
+  collide(loaded.get(), Transform3<S>::Identity(), &sphere, pose, request, result);
+  EXPECT_EQ(result.isCollision(), expected);
+
+  // Updating the loaded model never writes to the file, and its copies outlive
+  // it
+  std::shared_ptr<BVHModel<BV> > copy(new BVHModel<BV>(*loaded));
+  EXPECT_EQ(copy->tri_indices, loaded->tri_indices);
+  EXPECT_EQ(loaded->beginReplaceModel(), BVH_OK);
+  for(int i = 0; i < model->num_vertices; ++i)
+    EXPECT_EQ(loaded->replaceVertex(model->vertices[i] * 2), BVH_OK);
+  EXPECT_EQ(loaded->endReplaceModel(), BVH_OK);
+  loaded.reset();
+
+  std::shared_ptr<BVHModel<BV> > reloaded = loadBVHModel<BV>(filename);
+  ASSERT_TRUE(reloaded != nullptr);
+  for(int i = 0; i < model->num_vertices; ++i)
+  {
+    EXPECT_EQ(reloaded->vertices[i], model->vertices[i]);
+    EXPECT_EQ(copy->vertices[i], model->vertices[i]);
+  }
+  for(int i = 0; i < model->num_tris; ++i)
+    EXPECT_EQ(copy->tri_indices[i][0], model->tri_indices[i][0]);
+
+  // Rebuilding a model on top of the mapping releases it
+  EXPECT_EQ(reloaded->beginModel(), BVH_ERR_BUILD_OUT_OF_SEQUENCE);
+  EXPECT_EQ(reloaded->beginModel(), BVH_OK);
+  EXPECT_EQ(reloaded->addSubModel(
+              std::vector<Vector3<S>>(model->vertices,
+                                      model->vertices + model->num_vertices),
+              std::vector<Triangle>(model->tri_indices,
+                                    model->tri_indices + model->num_tris)),
+            BVH_OK);
+  EXPECT_EQ(reloaded->endModel(), BVH_OK);
+  EXPECT_EQ(reloaded->getNumBVs(), model->getNumBVs());
+
+  EXPECT_TRUE(loadBVHModel<BV>("missing_file.bvh") == nullptr);
+  if(!std::is_same<BV, AABB<S>>::value)
+    EXPECT_TRUE(loadBVHModel<AABB<S>>(filename) == nullptr);
+
+  std::remove(filename.c_str());
+}
+
 template<typename BV>
 void testBVHModel()
 {
   testBVHModelTriangles<BV>();
   testBVHModelPointCloud<BV>();
   testBVHModelSubModel<BV>();
+  testBVHModelSharedTopology<BV>();
+  testBVHModelSerialization<BV>();
 }
 
 GTEST_TEST(FCL_BVH_MODELS, building_bvh_models)
@@ -221,6 +401,154 @@ GTEST_TEST(FCL_BVH_MODELS, building_bvh_models)
   testBVHModel<KDOP<double, 16> >();
   testBVHModel<KDOP<double, 18> >();
   testBVHModel<KDOP<double, 24> >();
+  testBVHModel<FloatAABB<double>>();
+}
+
+//==============================================================================
+template<typename S>
+void testFloatAABB()
+{
+  // Single precision bounds always enclose the double precision ones
+  const Vector3<S> p(0.1, -1.0 / 3.0, 1e-9);
+  const FloatAABB<S> point_box(p);
+  EXPECT_TRUE(point_box.contain(p));
+  EXPECT_TRUE(point_box.toAABB().contain(p));
+  for(int i = 0; i < 3; ++i)
+  {
+    EXPECT_LE(point_box.min_[i], p[i]);
+    EXPECT_GE(point_box.max_[i], p[i]);
+    EXPECT_LE(point_box.max_[i] - point_box.min_[i],
+              2 * std::numeric_limits<float>::epsilon() * std::abs(p[i])
+              + std::numeric_limits<float>::denorm_min());
+  }
+  const FloatAABB<S> exact_box(Vector3<S>(0.5, 1, 2));
+  EXPECT_EQ(exact_box.width(), 0);
+  EXPECT_TRUE(FloatAABB<S>(AABB<S>(Vector3<S>(-1, -1, -1), Vector3<S>(1, 1, 1))).equal(
+                FloatAABB<S>(Vector3<S>(1, 1, 1), Vector3<S>(-1, -1, -1))));
+
+  // Every node of a FloatAABB hierarchy contains the geometry below it
+  Box<S> box(1, 2, 3);
+  Transform3<S> pose = Transform3<S>::Identity();
+  pose.translation() << 0.1, 0.2, 0.3;
+  pose.linear() = AngleAxis<S>(0.3, Vector3<S>(1, 2, 3).normalized()).toRotationMatrix();
+  BVHModel<FloatAABB<S>> float_model;
+  generateBVHModel(float_model, box, pose);
+  for(int i = 0; i < float_model.getNumBVs(); ++i)
+  {
+    const BVNode<FloatAABB<S>>& node = float_model.getBV(i);
+    if(node.isLeaf())
+    {
+      const Triangle& tri = float_model.tri_indices[node.primitiveId()];
+      for(int k = 0; k < 3; ++k)
+        EXPECT_TRUE(node.bv.contain(float_model.vertices[tri[k]]));
+    }
+    else
+    {
+      EXPECT_TRUE(node.bv.contain(float_model.getBV(node.leftChild()).bv));
+      EXPECT_TRUE(node.bv.contain(float_model.getBV(node.rightChild()).bv));
+    }
+  }
+
+  // Collision results match the double precision AABB hierarchy
+  BVHModel<AABB<S>> double_model;
+  generateBVHModel(double_model, box, pose);
+  Sphere<S> sphere(0.5);
+  S extents[] = {-3, -3, -3, 3, 3, 3};
+  aligned_vector<Transform3<S>> transforms;
+  test::generateRandomTransforms(extents, transforms, 100);
+  CollisionRequest<S> request(100, true);
+  for(const Transform3<S>& tf : transforms)
+  {
+    CollisionResult<S> float_result;
+    CollisionResult<S> double_result;
+    collide(&float_model, Transform3<S>::Identity(), &sphere, tf, request, float_result);
+    collide(&double_model, Transform3<S>::Identity(), &sphere, tf, request, double_result);
+    EXPECT_EQ(float_result.numContacts(), double_result.numContacts());
+
+    float_result.clear();
+    double_result.clear();
+    collide(&float_model, tf, &float_model, Transform3<S>::Identity(), request, float_result);
+    collide(&double_model, tf, &double_model, Transform3<S>::Identity(), request, double_result);
+    EXPECT_EQ(float_result.numContacts(), double_result.numContacts());
+  }
+}
+
+//==============================================================================
+GTEST_TEST(FCL_BVH_MODELS, float_aabb)
+{
+  testFloatAABB<double>();
+}
+
+//==============================================================================
+template<typename S>
+void testQuantizedBVHModel()
+{
+  EXPECT_EQ(sizeof(QuantizedBVNode), 16u);
+
+  Sphere<S> sphere(1);
+  Transform3<S> pose = Transform3<S>::Identity();
+  pose.translation() << 0.1, 0.2, 0.3;
+  BVHModel<OBBRSS<S>> reference_model;
+  generateBVHModel(reference_model, sphere, pose, 16, 16);
+
+  QuantizedBVHModel<S> model;
+  EXPECT_EQ(model.build(reference_model), BVH_OK);
+  EXPECT_EQ(model.getNumBVs(), reference_model.getNumBVs());
+  EXPECT_EQ(model.getNumTriangles(), reference_model.num_tris);
+
+  // The dequantized boxes contain the geometry below them
+  std::function<void(int, const AABB<S>&)> check_node =
+      [&](int id, const AABB<S>& parent_bv)
+  {
+    const AABB<S> bv = model.dequantizeBV(id, parent_bv);
+    EXPECT_TRUE(parent_bv.contain(bv));
+    const QuantizedBVNode& node = model.getBV(id);
+    if(node.isLeaf())
+    {
+      const Triangle& tri = model.getTriangles()[node.primitiveId()];
+      for(int k = 0; k < 3; ++k)
+        EXPECT_TRUE(bv.contain(model.getVertices()[tri[k]]));
+      return;
+    }
+    check_node(node.leftChild(), bv);
+    check_node(node.rightChild(), bv);
+  };
+  check_node(0, model.getRootBV());
+
+  // Collision and distance results match the unquantized hierarchy
+  Box<S> box(0.5, 1, 1.5);
+  S extents[] = {-3, -3, -3, 3, 3, 3};
+  aligned_vector<Transform3<S>> transforms;
+  test::generateRandomTransforms(extents, transforms, 100);
+  CollisionRequest<S> request(1000, true);
+  DistanceRequest<S> distance_request;
+  for(const Transform3<S>& tf : transforms)
+  {
+    CollisionResult<S> quantized_result;
+    CollisionResult<S> reference_result;
+    collide(&model, Transform3<S>::Identity(), &box, tf, request, quantized_result);
+    collide(&reference_model, Transform3<S>::Identity(), &box, tf, request, reference_result);
+    EXPECT_EQ(quantized_result.numContacts(), reference_result.numContacts());
+
+    quantized_result.clear();
+    reference_result.clear();
+    collide(&model, tf, &model, Transform3<S>::Identity(), request, quantized_result);
+    collide(&reference_model, tf, &reference_model, Transform3<S>::Identity(), request, reference_result);
+    EXPECT_EQ(quantized_result.numContacts(), reference_result.numContacts());
+
+    DistanceResult<S> quantized_distance;
+    DistanceResult<S> reference_distance;
+    distance(&model, Transform3<S>::Identity(), &box, tf, distance_request, quantized_distance);
+    distance(&reference_model, Transform3<S>::Identity(), &box, tf, distance_request, reference_distance);
+    if(reference_distance.min_distance > 0)
+      EXPECT_NEAR(quantized_distance.min_distance, reference_distance.min_distance, 1e-6);
+  }
+}
+
+//==============================================================================
+GTEST_TEST(FCL_BVH_MODELS, quantized_bvh_model)
+{
+  testQuantizedBVHModel<double>();
 }
 
 //==============================================================================
@@ -35,13 +35,21 @@
 
 /** @author Jia Pan */
 
+#include <map>
+#include <set>
+
 #include <gtest/gtest.h>
 
 #include "fcl/math/bv/utility.h"
+#include "fcl/geometry/geometric_shape_to_BVH_model.h"
+#include "fcl/narrowphase/batch_collision.h"
 #include "fcl/narrowphase/collision.h"
+#include "fcl/narrowphase/distance.h"
+#include "fcl/narrowphase/self_collision.h"
 #include "fcl/narrowphase/detail/gjk_solver_indep.h"
 #include "fcl/narrowphase/detail/gjk_solver_libccd.h"
 #include "fcl/narrowphase/detail/traversal/collision_node.h"
+#include "fcl/narrowphase/detail/traversal/distance/mesh_distance_traversal_node.h"
 
 #include "test_fcl_utility.h"
 
@@ -1089,6 +1097,487 @@ bool test_collide_func(const Transform3<typename BV::S>& tf,
   else return false;
 }
 
+//==============================================================================
+template <typename BV, typename CollisionNode, typename DistanceNode>
+void test_static_dispatch()
+{
+  using S = typename BV::S;
+
+  BVHModel<BV> m1;
+  BVHModel<BV> m2;
+  generateBVHModel(m1, Sphere<S>(1), Transform3<S>::Identity(), 16, 16);
+  generateBVHModel(m2, Box<S>(1, 0.5, 2), Transform3<S>::Identity());
+
+  S extents[] = {-3, -3, -3, 3, 3, 3};
+  aligned_vector<Transform3<S>> transforms;
+  test::generateRandomTransforms(extents, transforms, 50);
+
+  // The statically dispatched traversal finds the same contacts as the
+  // virtual one; the distance traversal visits the same node pairs, while the
+  // collision traversal tests small subtrees as blocks of triangle pairs
+  // instead of descending into them
+  for(const Transform3<S>& tf : transforms)
+  {
+    CollisionRequest<S> request(1000, true);
+    CollisionResult<S> virtual_result;
+    CollisionResult<S> static_result;
+    CollisionNode virtual_node;
+    CollisionNode static_node;
+    detail::initialize(virtual_node, m1, tf, m2, Transform3<S>::Identity(), request, virtual_result);
+    detail::initialize(static_node, m1, tf, m2, Transform3<S>::Identity(), request, static_result);
+    virtual_node.enable_statistics = true;
+    static_node.enable_statistics = true;
+    detail::collide(&virtual_node);
+    detail::collideStatic(&static_node);
+    EXPECT_EQ(static_result.numContacts(), virtual_result.numContacts());
+    EXPECT_LE(static_node.num_bv_tests, virtual_node.num_bv_tests);
+
+    DistanceRequest<S> distance_request;
+    DistanceResult<S> virtual_distance;
+    DistanceResult<S> static_distance;
+    DistanceNode virtual_distance_node;
+    DistanceNode static_distance_node;
+    detail::initialize(virtual_distance_node, m1, tf, m2, Transform3<S>::Identity(), distance_request, virtual_distance);
+    detail::initialize(static_distance_node, m1, tf, m2, Transform3<S>::Identity(), distance_request, static_distance);
+    virtual_distance_node.enable_statistics = true;
+    static_distance_node.enable_statistics = true;
+    detail::distance(&virtual_distance_node);
+    detail::distanceStatic(&static_distance_node);
+    EXPECT_EQ(static_distance.min_distance, virtual_distance.min_distance);
+    EXPECT_EQ(static_distance_node.num_bv_tests, virtual_distance_node.num_bv_tests);
+    EXPECT_EQ(static_distance_node.num_leaf_tests, virtual_distance_node.num_leaf_tests);
+  }
+}
+
+GTEST_TEST(FCL_COLLISION, static_dispatch)
+{
+  test_static_dispatch<RSS<double>,
+      detail::MeshCollisionTraversalNodeRSS<double>,
+      detail::MeshDistanceTraversalNodeRSS<double>>();
+  test_static_dispatch<OBBRSS<double>,
+      detail::MeshCollisionTraversalNodeOBBRSS<double>,
+      detail::MeshDistanceTraversalNodeOBBRSS<double>>();
+}
+
+//==============================================================================
+template <typename S>
+void test_iterative_traversal()
+{
+  // The traversal stack spills to the heap and keeps its LIFO order
+  detail::TraversalStack<int, 4> stack;
+  for(int i = 0; i < 100; ++i)
+    stack.push(i);
+  EXPECT_EQ(stack.size(), 100u);
+  for(int i = 99; i >= 0; --i)
+    EXPECT_EQ(stack.pop(), i);
+  EXPECT_TRUE(stack.empty());
+
+  BVHModel<AABB<S>> m1;
+  BVHModel<AABB<S>> m2;
+  generateBVHModel(m1, Sphere<S>(1), Transform3<S>::Identity(), 16, 16);
+  generateBVHModel(m2, Box<S>(1, 0.5, 2), Transform3<S>::Identity());
+
+  S extents[] = {-2, -2, -2, 2, 2, 2};
+  aligned_vector<Transform3<S>> transforms;
+  test::generateRandomTransforms(extents, transforms, 50);
+
+  // The breadth first traversal tests the same pairs as the depth first one
+  for(const Transform3<S>& tf : transforms)
+  {
+    CollisionRequest<S> request(100000, true);
+    CollisionResult<S> depth_first_result;
+    CollisionResult<S> breadth_first_result;
+    detail::MeshCollisionTraversalNode<AABB<S>> depth_first_node;
+    detail::MeshCollisionTraversalNode<AABB<S>> breadth_first_node;
+    // initialize() transforms the vertices of non oriented models in place
+    BVHModel<AABB<S>> depth_first_m1(m1);
+    BVHModel<AABB<S>> depth_first_m2(m2);
+    BVHModel<AABB<S>> breadth_first_m1(m1);
+    BVHModel<AABB<S>> breadth_first_m2(m2);
+    Transform3<S> tf1 = tf;
+    Transform3<S> tf2 = Transform3<S>::Identity();
+    detail::initialize(depth_first_node, depth_first_m1, tf1, depth_first_m2, tf2, request, depth_first_result);
+    tf1 = tf;
+    tf2.setIdentity();
+    detail::initialize(breadth_first_node, breadth_first_m1, tf1, breadth_first_m2, tf2, request, breadth_first_result);
+    depth_first_node.enable_statistics = true;
+    breadth_first_node.enable_statistics = true;
+    detail::collisionRecurse<S>(&depth_first_node, 0, 0, nullptr);
+    detail::breadthFirstCollisionRecurse<S>(&breadth_first_node, 0, 0);
+    EXPECT_EQ(breadth_first_result.numContacts(), depth_first_result.numContacts());
+    EXPECT_EQ(breadth_first_node.num_bv_tests, depth_first_node.num_bv_tests);
+    EXPECT_EQ(breadth_first_node.num_leaf_tests, depth_first_node.num_leaf_tests);
+  }
+}
+
+GTEST_TEST(FCL_COLLISION, iterative_traversal)
+{
+  test_iterative_traversal<double>();
+}
+
+//==============================================================================
+template <typename BV>
+void test_parallel_traversal()
+{
+  using S = typename BV::S;
+
+  BVHModel<BV> m1;
+  BVHModel<BV> m2;
+  generateBVHModel(m1, Sphere<S>(1), Transform3<S>::Identity(), 32, 32);
+  generateBVHModel(m2, Box<S>(1, 0.5, 2), Transform3<S>::Identity());
+
+  S extents[] = {-2, -2, -2, 2, 2, 2};
+  aligned_vector<Transform3<S>> transforms;
+  test::generateRandomTransforms(extents, transforms, 20);
+
+  const Transform3<S> identity = Transform3<S>::Identity();
+
+  for(const Transform3<S>& tf : transforms)
+  {
+    for(unsigned int num_threads : {2u, 4u, 0u})
+    {
+      // The parallel traversal returns the contacts in the sequential order,
+      // up to the maximal number of contacts
+      for(std::size_t num_max_contacts : {std::size_t(1), std::size_t(100000)})
+      {
+        CollisionRequest<S> request(num_max_contacts, true);
+        CollisionResult<S> result;
+        collide(&m1, tf, &m2, identity, request, result);
+
+        request.num_threads = num_threads;
+        CollisionResult<S> parallel_result;
+        collide(&m1, tf, &m2, identity, request, parallel_result);
+
+        GTEST_ASSERT_EQ(parallel_result.numContacts(), result.numContacts());
+        for(std::size_t i = 0; i < result.numContacts(); ++i)
+        {
+          EXPECT_EQ(parallel_result.getContact(i).b1, result.getContact(i).b1);
+          EXPECT_EQ(parallel_result.getContact(i).b2, result.getContact(i).b2);
+        }
+      }
+
+      DistanceRequest<S> request(true);
+      DistanceResult<S> result;
+      distance(&m1, tf, &m2, identity, request, result);
+
+      request.num_threads = num_threads;
+      DistanceResult<S> parallel_result;
+      distance(&m1, tf, &m2, identity, request, parallel_result);
+
+      EXPECT_EQ(parallel_result.min_distance, result.min_distance);
+    }
+  }
+}
+
+GTEST_TEST(FCL_COLLISION, parallel_traversal)
+{
+  test_parallel_traversal<AABB<double>>();
+  test_parallel_traversal<OBBRSS<double>>();
+  test_parallel_traversal<RSS<double>>();
+}
+
+//==============================================================================
+template <typename BV>
+void test_self_collision()
+{
+  using S = typename BV::S;
+
+  BVHModel<BV> m1;
+  BVHModel<BV> m2;
+  generateBVHModel(m1, Sphere<S>(1), Transform3<S>::Identity(), 16, 16);
+  generateBVHModel(m2, Box<S>(1, 0.5, 2), Transform3<S>::Identity());
+
+  S extents[] = {-1.5, -1.5, -1.5, 1.5, 1.5, 1.5};
+  aligned_vector<Transform3<S>> transforms;
+  test::generateRandomTransforms(extents, transforms, 20);
+
+  for(const Transform3<S>& tf : transforms)
+  {
+    // A single mesh made of the sphere and of the box moved by tf
+    std::vector<Vector3<S>> vertices(m1.vertices, m1.vertices + m1.num_vertices);
+    std::vector<Triangle> triangles(m1.tri_indices, m1.tri_indices + m1.num_tris);
+    for(int i = 0; i < m2.num_vertices; ++i)
+      vertices.push_back(tf * m2.vertices[i]);
+    for(int i = 0; i < m2.num_tris; ++i)
+    {
+      const Triangle& t = m2.tri_indices[i];
+      triangles.emplace_back(t[0] + m1.num_vertices, t[1] + m1.num_vertices, t[2] + m1.num_vertices);
+    }
+
+    BVHModel<BV> model;
+    model.beginModel();
+    model.addSubModel(vertices, triangles);
+    model.endModel();
+
+    CollisionRequest<S> request(100000, false);
+    CollisionResult<S> result;
+    collide(&m1, Transform3<S>::Identity(), &m2, tf, request, result);
+
+    std::set<std::pair<int, int>> expected;
+    for(std::size_t i = 0; i < result.numContacts(); ++i)
+      expected.insert({result.getContact(i).b1, result.getContact(i).b2 + m1.num_tris});
+
+    // The self collisions are the intersections between the two shapes; the
+    // adjacent triangles of each shape are culled
+    SelfCollisionRequest<S> self_request(100000, false);
+    CollisionResult<S> self_result;
+    selfCollide(&model, self_request, self_result);
+
+    std::set<std::pair<int, int>> found;
+    for(std::size_t i = 0; i < self_result.numContacts(); ++i)
+    {
+      const Contact<S>& contact = self_result.getContact(i);
+      EXPECT_EQ(contact.o1, &model);
+      EXPECT_EQ(contact.o2, &model);
+      found.insert({std::min(contact.b1, contact.b2), std::max(contact.b1, contact.b2)});
+    }
+    EXPECT_EQ(found, expected);
+    EXPECT_EQ(found.size(), self_result.numContacts());
+
+    // Without adjacency culling, all the adjacent triangles collide
+    self_request.enable_adjacency_culling = false;
+    CollisionResult<S> adjacent_result;
+    selfCollide(&model, self_request, adjacent_result);
+    EXPECT_GT(adjacent_result.numContacts(), self_result.numContacts() + m1.num_tris);
+
+    // The normal cones only cull connected patches of a single shape
+    self_request.enable_adjacency_culling = true;
+    self_request.enable_normal_cone_culling = true;
+    CollisionResult<S> cone_result;
+    selfCollide(&model, self_request, cone_result);
+    EXPECT_EQ(cone_result.numContacts(), self_result.numContacts());
+
+    // The parallel traversal returns the contacts in the sequential order
+    self_request.enable_normal_cone_culling = false;
+    self_request.num_threads = 4;
+    CollisionResult<S> parallel_result;
+    selfCollide(&model, self_request, parallel_result);
+    GTEST_ASSERT_EQ(parallel_result.numContacts(), self_result.numContacts());
+    for(std::size_t i = 0; i < self_result.numContacts(); ++i)
+    {
+      EXPECT_EQ(parallel_result.getContact(i).b1, self_result.getContact(i).b1);
+      EXPECT_EQ(parallel_result.getContact(i).b2, self_result.getContact(i).b2);
+    }
+
+    // Moving the box away and refitting the tree removes the self collisions
+    for(int i = m1.num_vertices; i < model.num_vertices; ++i)
+      vertices[i] += Vector3<S>(10, 0, 0);
+    model.beginUpdateModel();
+    model.updateSubModel(vertices);
+    model.endUpdateModel();
+
+    self_request.num_threads = 1;
+    CollisionResult<S> moved_result;
+    EXPECT_EQ(selfCollide(&model, self_request, moved_result), 0u);
+  }
+
+  // The merged normal cones contain the normals of both cones
+  const detail::NormalCone<S> x(Vector3<S>::UnitX());
+  const detail::NormalCone<S> z(Vector3<S>(0, 0, 2));
+  const detail::NormalCone<S> xz = x + z;
+  EXPECT_NEAR(xz.half_angle, constants<S>::pi() / 4, 1e-12);
+  EXPECT_NEAR(xz.axis.dot(Vector3<S>(1, 0, 1).normalized()), 1, 1e-12);
+  EXPECT_NEAR((xz + x).half_angle, xz.half_angle, 1e-12);
+  EXPECT_EQ((x + detail::NormalCone<S>(-Vector3<S>::UnitX())).half_angle, constants<S>::pi());
+}
+
+GTEST_TEST(FCL_COLLISION, self_collision)
+{
+  test_self_collision<AABB<double>>();
+  test_self_collision<OBBRSS<double>>();
+}
+
+//==============================================================================
+template <typename BV>
+void test_query_statistics()
+{
+  using S = typename BV::S;
+
+  BVHModel<BV> m1;
+  BVHModel<BV> m2;
+  generateBVHModel(m1, Sphere<S>(1), Transform3<S>::Identity(), 16, 16);
+  generateBVHModel(m2, Box<S>(1, 0.5, 2), Transform3<S>::Identity());
+  const Transform3<S> tf(Translation3<S>(Vector3<S>(0.5, 0, 0)));
+
+  // No statistics are collected by default
+  CollisionRequest<S> request(100000, false);
+  CollisionResult<S> result;
+  collide(&m1, Transform3<S>::Identity(), &m2, tf, request, result);
+  EXPECT_GT(result.numContacts(), 0u);
+  EXPECT_EQ(result.statistics.num_bv_tests, 0u);
+  EXPECT_EQ(result.statistics.num_leaf_tests, 0u);
+
+  QueryStatisticsSink sink;
+  QueryStatisticsSink::setGlobal(&sink);
+
+  request.enable_statistics = true;
+  CollisionResult<S> stats_result;
+  collide(&m1, Transform3<S>::Identity(), &m2, tf, request, stats_result);
+  const QueryStatistics& statistics = stats_result.statistics;
+  EXPECT_EQ(stats_result.numContacts(), result.numContacts());
+  EXPECT_GT(statistics.num_bv_tests, 0u);
+  EXPECT_GE(statistics.num_leaf_tests, result.numContacts());
+  EXPECT_GT(statistics.max_stack_size, 0u);
+  EXPECT_EQ(statistics.front_size, 0u);
+  EXPECT_GE(statistics.time_seconds, 0);
+
+  // The parallel traversal visits the same pairs
+  request.num_threads = 4;
+  CollisionResult<S> parallel_result;
+  collide(&m1, Transform3<S>::Identity(), &m2, tf, request, parallel_result);
+  EXPECT_EQ(parallel_result.statistics.num_bv_tests, statistics.num_bv_tests);
+  EXPECT_EQ(parallel_result.statistics.num_leaf_tests, statistics.num_leaf_tests);
+
+  // A query with a cache reports the size of the front
+  request.num_threads = 1;
+  QueryCache<S> cache;
+  request.query_cache = &cache;
+  CollisionResult<S> cached_result;
+  collide(&m1, Transform3<S>::Identity(), &m2, tf, request, cached_result);
+  EXPECT_EQ(cached_result.statistics.front_size, cache.size());
+  EXPECT_GT(cached_result.statistics.front_size, 0u);
+  request.query_cache = nullptr;
+
+  // A query between two shapes makes a single leaf test
+  Sphere<S> sphere(1);
+  Box<S> box(1, 0.5, 2);
+  CollisionResult<S> shape_shape_result;
+  collide(&sphere, Transform3<S>::Identity(), &box, tf, request, shape_shape_result);
+  EXPECT_EQ(shape_shape_result.statistics.num_leaf_tests, 1u);
+
+  DistanceRequest<S> distance_request;
+  distance_request.enable_statistics = true;
+  DistanceResult<S> distance_result;
+  const Transform3<S> far(Translation3<S>(Vector3<S>(3, 0, 0)));
+  distance(&m1, Transform3<S>::Identity(), &m2, far, distance_request, distance_result);
+  EXPECT_GT(distance_result.statistics.num_bv_tests, 0u);
+  EXPECT_GT(distance_result.statistics.num_leaf_tests, 0u);
+
+  // The sink accumulates the statistics of every query that enables them
+  EXPECT_EQ(sink.numQueries(), 5u);
+  const QueryStatistics total = sink.total();
+  EXPECT_EQ(total.num_leaf_tests,
+            2 * statistics.num_leaf_tests
+            + cached_result.statistics.num_leaf_tests
+            + shape_shape_result.statistics.num_leaf_tests
+            + distance_result.statistics.num_leaf_tests);
+  EXPECT_EQ(total.front_size, cached_result.statistics.front_size);
+
+  QueryStatisticsSink::setGlobal(nullptr);
+  sink.reset();
+  CollisionResult<S> unrecorded_result;
+  collide(&m1, Transform3<S>::Identity(), &m2, tf, request, unrecorded_result);
+  EXPECT_EQ(sink.numQueries(), 0u);
+  EXPECT_EQ(sink.total().num_bv_tests, 0u);
+}
+
+GTEST_TEST(FCL_COLLISION, query_statistics)
+{
+  test_query_statistics<AABB<double>>();
+  test_query_statistics<OBBRSS<double>>();
+}
+
+//==============================================================================
+template <typename BV>
+void test_batch_collision()
+{
+  using S = typename BV::S;
+
+  BVHModel<BV> model;
+  generateBVHModel(model, Sphere<S>(2), Transform3<S>::Identity(), 32, 32);
+  Transform3<S> tf(AngleAxis<S>(0.3, Vector3<S>(1, 2, 3).normalized()));
+  tf.translation() = Vector3<S>(0.1, -0.2, 0.3);
+
+  const Box<S> box(0.4, 0.3, 0.5);
+  const Sphere<S> sphere(0.3);
+  const Capsule<S> capsule(0.1, 0.6);
+  const Cylinder<S> cylinder(0.2, 0.4);
+  const Halfspace<S> halfspace(Vector3<S>::UnitZ(), 1.5);
+
+  S extents[] = {-2.5, -2.5, -2.5, 2.5, 2.5, 2.5};
+  aligned_vector<Transform3<S>> tfs;
+  test::generateRandomTransforms(extents, tfs, 200);
+
+  std::vector<const CollisionGeometry<S>*> geometries;
+  for(std::size_t i = 0; i < tfs.size(); ++i)
+  {
+    switch(i % 4)
+    {
+    case 0: geometries.push_back(&box); break;
+    case 1: geometries.push_back(&sphere); break;
+    case 2: geometries.push_back(&capsule); break;
+    default: geometries.push_back(&cylinder); break;
+    }
+  }
+  geometries.back() = &halfspace;
+
+  for(bool enable_contact : {false, true})
+  {
+    CollisionRequest<S> request(100000, enable_contact);
+    request.enable_statistics = true;
+    std::vector<CollisionResult<S>> results;
+    const std::size_t num_collisions = collide(geometries, tfs, &model, tf, request, results);
+    GTEST_ASSERT_EQ(results.size(), geometries.size());
+
+    // Every shape gets the contacts of its own query
+    std::size_t expected_num_collisions = 0;
+    for(std::size_t i = 0; i + 1 < geometries.size(); ++i)
+    {
+      CollisionResult<S> result;
+      collide(geometries[i], tfs[i], &model, tf, request, result);
+      if(result.isCollision()) ++expected_num_collisions;
+
+      // The tree of a mesh with non oriented BVs is rebuilt in world space by
+      // collide(), so the contacts may come in another order, and the contact
+      // points of GJK may differ within its tolerance
+      std::map<int, Vector3<S>> expected;
+      for(std::size_t j = 0; j < result.numContacts(); ++j)
+        expected[result.getContact(j).b1] = result.getContact(j).pos;
+
+      GTEST_ASSERT_EQ(results[i].numContacts(), result.numContacts());
+      for(std::size_t j = 0; j < result.numContacts(); ++j)
+      {
+        const Contact<S>& contact = results[i].getContact(j);
+        EXPECT_EQ(contact.o1, &model);
+        EXPECT_EQ(contact.o2, geometries[i]);
+        GTEST_ASSERT_EQ(expected.count(contact.b1), 1u);
+        if(enable_contact)
+          EXPECT_LT((contact.pos - expected[contact.b1]).norm(), 1e-4);
+      }
+
+      EXPECT_GT(results[i].statistics.num_bv_tests, 0u);
+      EXPECT_GE(results[i].statistics.num_leaf_tests, results[i].numContacts());
+    }
+
+    // The halfspace cuts the sphere
+    EXPECT_TRUE(results.back().isCollision());
+    ++expected_num_collisions;
+
+    EXPECT_EQ(num_collisions, expected_num_collisions);
+    EXPECT_GT(num_collisions, 0u);
+    EXPECT_LT(num_collisions, geometries.size());
+  }
+
+  // The shapes whose result is already satisfied are not queried
+  CollisionRequest<S> request;
+  std::vector<CollisionResult<S>> results;
+  collide(geometries, tfs, &model, tf, request, results);
+  std::vector<std::size_t> num_contacts;
+  for(const CollisionResult<S>& result : results)
+    num_contacts.push_back(result.numContacts());
+  collide(geometries, tfs, &model, tf, request, results);
+  for(std::size_t i = 0; i < results.size(); ++i)
+    EXPECT_EQ(results[i].numContacts(), num_contacts[i]);
+}
+
+GTEST_TEST(FCL_COLLISION, batch_collision)
+{
+  test_batch_collision<AABB<double>>();
+  test_batch_collision<OBBRSS<double>>();
+  test_batch_collision<RSS<double>>();
+  test_batch_collision<KDOP<double, 16>>();
+}
+
 //==============================================================================
 int main(int argc, char* argv[])
 {
@@ -38,6 +38,9 @@
 #include <gtest/gtest.h>
 
 #include "fcl/narrowphase/detail/traversal/collision_node.h"
+#include "fcl/geometry/geometric_shape_to_BVH_model.h"
+#include "fcl/math/bv/utility.h"
+#include "fcl/narrowphase/distance.h"
 #include "test_fcl_utility.h"
 #include "eigen_matrix_compare.h"
 #include "fcl_resources/config.h"
@@ -384,6 +387,194 @@ GTEST_TEST(FCL_DISTANCE, NearestPointFromDegenerateSimplex) {
   NearestPointFromDegenerateSimplex<double>();
 }
 
+template <typename BV>
+void test_mesh_distance_lod()
+{
+  using S = typename BV::S;
+
+  Sphere<S> sphere(1);
+  auto model1 = std::make_shared<BVHModel<BV>>();
+  auto model2 = std::make_shared<BVHModel<BV>>();
+  generateBVHModel(*model1, sphere, Transform3<S>::Identity(), 64, 64);
+  generateBVHModel(*model2, sphere, Transform3<S>::Identity(), 64, 64);
+
+  Transform3<S> tf2 = Transform3<S>::Identity();
+  tf2.translation() = Vector3<S>(3, 0.5, 0);
+  tf2.linear() = AngleAxis<S>(0.3, Vector3<S>::UnitZ()).toRotationMatrix();
+
+  DistanceRequest<S> request(true);
+  DistanceResult<S> exact;
+  distance(model1.get(), Transform3<S>::Identity(), model2.get(), tf2,
+           request, exact);
+
+  // Without proxies, the tolerance has no effect
+  request.lod_tolerance = 0.1;
+  DistanceResult<S> result;
+  distance(model1.get(), Transform3<S>::Identity(), model2.get(), tf2,
+           request, result);
+  EXPECT_EQ(result.min_distance, exact.min_distance);
+
+  EXPECT_EQ(model1->computeLODProxies(), BVH_OK);
+  EXPECT_TRUE(model1->hasLODProxies());
+  // Copies share the proxies
+  auto copy2 = std::make_shared<BVHModel<BV>>(*model2);
+  EXPECT_EQ(model2->computeLODProxies(), BVH_OK);
+  EXPECT_FALSE(copy2->hasLODProxies());
+  copy2 = std::make_shared<BVHModel<BV>>(*model2);
+  EXPECT_TRUE(copy2->hasLODProxies());
+
+  // The proxy of the root contains the whole sphere, and the proxies of the
+  // leaves contain one triangle
+  EXPECT_GE(model1->getLODProxy(0).radius, 1);
+  EXPECT_LE(model1->getLODProxy(0).radius, 2);
+
+  for(S tolerance : {0.01, 0.05, 0.1, 0.5})
+  {
+    request.lod_tolerance = tolerance;
+    result.clear();
+    distance(model1.get(), Transform3<S>::Identity(), copy2.get(), tf2,
+             request, result);
+
+    // The answer is the distance between two points of the meshes, within the
+    // tolerance of the exact distance
+    EXPECT_GE(result.min_distance, exact.min_distance - 1e-12);
+    EXPECT_LE(result.min_distance, exact.min_distance + tolerance);
+    EXPECT_NEAR((result.nearest_points[0] - result.nearest_points[1]).norm(),
+                result.min_distance, 1e-12);
+  }
+
+  // Rebuilding the hierarchy discards the proxies
+  std::vector<Vector3<S>> points(model1->vertices,
+                                 model1->vertices + model1->num_vertices);
+  model1->beginReplaceModel();
+  model1->replaceSubModel(points);
+  model1->endReplaceModel(false);
+  EXPECT_FALSE(model1->hasLODProxies());
+}
+
+GTEST_TEST(FCL_DISTANCE, mesh_distance_lod)
+{
+  test_mesh_distance_lod<RSS<double>>();
+  test_mesh_distance_lod<kIOS<double>>();
+  test_mesh_distance_lod<OBBRSS<double>>();
+}
+
+template <typename BV>
+void test_mesh_distance_best_first()
+{
+  using S = typename BV::S;
+
+  std::vector<Vector3<S>> p1, p2;
+  std::vector<Triangle> t1, t2;
+  test::loadOBJFile(TEST_RESOURCES_DIR"/env.obj", p1, t1);
+  test::loadOBJFile(TEST_RESOURCES_DIR"/rob.obj", p2, t2);
+
+  auto model1 = std::make_shared<BVHModel<BV>>();
+  auto model2 = std::make_shared<BVHModel<BV>>();
+  model1->beginModel();
+  model1->addSubModel(p1, t1);
+  model1->endModel();
+  model2->beginModel();
+  model2->addSubModel(p2, t2);
+  model2->endModel();
+
+  aligned_vector<Transform3<S>> transforms;
+  S extents[] = {-3000, -3000, 0, 3000, 3000, 3000};
+  test::generateRandomTransforms(extents, transforms, 5);
+
+  for(const auto& tf : transforms)
+  {
+    DistanceRequest<S> request;
+    DistanceResult<S> depth_first;
+    distance(model1.get(), Transform3<S>::Identity(), model2.get(), tf,
+             request, depth_first);
+
+    // Small budgets fall back to depth first traversal on part of the tree
+    for(std::size_t queue_size : {2, 16, 1 << 20})
+    {
+      request.best_first_queue_size = queue_size;
+      DistanceResult<S> best_first;
+      distance(model1.get(), Transform3<S>::Identity(), model2.get(), tf,
+               request, best_first);
+      EXPECT_NEAR(best_first.min_distance, depth_first.min_distance, 1e-8);
+    }
+
+    // With a relative error, the answer is within it of the exact distance
+    request.rel_err = 0.1;
+    DistanceResult<S> approximate;
+    distance(model1.get(), Transform3<S>::Identity(), model2.get(), tf,
+             request, approximate);
+    EXPECT_GE(approximate.min_distance, depth_first.min_distance - 1e-8);
+    EXPECT_LE(approximate.min_distance * (1 - 0.1),
+              depth_first.min_distance + 1e-8);
+  }
+}
+
+GTEST_TEST(FCL_DISTANCE, mesh_distance_best_first)
+{
+  test_mesh_distance_best_first<AABB<double>>();
+  test_mesh_distance_best_first<OBB<double>>();
+  test_mesh_distance_best_first<RSS<double>>();
+  test_mesh_distance_best_first<KDOP<double, 16>>();
+  test_mesh_distance_best_first<KDOP<double, 24>>();
+  test_mesh_distance_best_first<OBBRSS<double>>();
+}
+
+template <typename BV>
+void test_bv_distance_lower_bound()
+{
+  using S = typename BV::S;
+
+  std::vector<Vector3<S>> points1(20), points2(20);
+  for(int trial = 0; trial < 100; ++trial)
+  {
+    const Matrix3<S> R1 = AngleAxis<S>(
+          trial, Vector3<S>::Random().normalized()).toRotationMatrix();
+    const Matrix3<S> R2 = AngleAxis<S>(
+          2 * trial, Vector3<S>::Random().normalized()).toRotationMatrix();
+    const Vector3<S> offset = Vector3<S>::Random() * 4;
+    for(std::size_t i = 0; i < points1.size(); ++i)
+    {
+      points1[i] = R1 * Vector3<S>::Random().cwiseProduct(Vector3<S>(2, 1, 0.5));
+      points2[i] = R2 * Vector3<S>::Random().cwiseProduct(Vector3<S>(1, 0.5, 0.2)) + offset;
+    }
+
+    BV bv1, bv2;
+    fit(points1.data(), static_cast<int>(points1.size()), bv1);
+    fit(points2.data(), static_cast<int>(points2.size()), bv2);
+
+    S min_distance = std::numeric_limits<S>::max();
+    for(const auto& a : points1)
+      for(const auto& b : points2)
+        min_distance = std::min(min_distance, (a - b).norm());
+
+    const S bound = bv1.distance(bv2);
+    EXPECT_GE(bound, 0);
+    EXPECT_LE(bound, min_distance + 1e-12);
+    if(bv1.overlap(bv2))
+      EXPECT_EQ(bound, 0);
+  }
+
+  // Far apart BVs give a positive bound
+  for(std::size_t i = 0; i < points1.size(); ++i)
+  {
+    points1[i] = Vector3<S>::Random();
+    points2[i] = Vector3<S>::Random() + Vector3<S>(10, 0, 0);
+  }
+  BV bv1, bv2;
+  fit(points1.data(), static_cast<int>(points1.size()), bv1);
+  fit(points2.data(), static_cast<int>(points2.size()), bv2);
+  EXPECT_GT(bv1.distance(bv2), 4);
+}
+
+GTEST_TEST(FCL_DISTANCE, bv_distance_lower_bound)
+{
+  test_bv_distance_lower_bound<OBB<double>>();
+  test_bv_distance_lower_bound<KDOP<double, 16>>();
+  test_bv_distance_lower_bound<KDOP<double, 18>>();
+  test_bv_distance_lower_bound<KDOP<double, 24>>();
+}
+
 template<typename BV, typename TraversalNode>
 void distance_Test_Oriented(const Transform3<typename BV::S>& tf,
                             const std::vector<Vector3<typename BV::S>>& vertices1, const std::vector<Triangle>& triangles1,
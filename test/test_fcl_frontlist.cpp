@@ -201,6 +201,95 @@ GTEST_TEST(FCL_FRONT_LIST, front_list)
   test_front_list<double>();
 }
 
+template <typename BV>
+void test_query_cache()
+{
+  using S = typename BV::S;
+
+  std::vector<Vector3<S>> p1, p2;
+  std::vector<Triangle> t1, t2;
+
+  test::loadOBJFile(TEST_RESOURCES_DIR"/env.obj", p1, t1);
+  test::loadOBJFile(TEST_RESOURCES_DIR"/rob.obj", p2, t2);
+
+  BVHModel<BV> m1;
+  BVHModel<BV> m2;
+  m1.beginModel();
+  m1.addSubModel(p1, t1);
+  m1.endModel();
+  m2.beginModel();
+  m2.addSubModel(p2, t2);
+  m2.endModel();
+
+  aligned_vector<Transform3<S>> transforms;
+  aligned_vector<Transform3<S>> transforms2;
+  S extents[] = {-3000, -3000, 0, 3000, 3000, 3000};
+  S delta_trans[] = {1, 1, 1};
+#ifdef NDEBUG
+  std::size_t n = 10;
+#else
+  std::size_t n = 1;
+#endif
+
+  test::generateRandomTransforms<S>(extents, delta_trans, 0.005 * 2 * 3.1415, transforms, transforms2, n);
+
+  QueryCache<S> collision_cache;
+  QueryCache<S> distance_cache;
+  const Transform3<S> identity = Transform3<S>::Identity();
+
+  for(std::size_t i = 0; i < transforms.size(); ++i)
+  {
+    // Each query on the perturbed transform starts from the front of the
+    // query on the initial one, and must give the same result as a query
+    // from the roots
+    for(const Transform3<S>& tf : {transforms[i], transforms2[i]})
+    {
+      CollisionRequest<S> request(100000, true);
+      CollisionResult<S> result;
+      collide(&m1, tf, &m2, identity, request, result);
+
+      CollisionRequest<S> cached_request(100000, true);
+      cached_request.query_cache = &collision_cache;
+      CollisionResult<S> cached_result;
+      collide(&m1, tf, &m2, identity, cached_request, cached_result);
+
+      EXPECT_EQ(result.numContacts(), cached_result.numContacts());
+      EXPECT_FALSE(collision_cache.empty());
+
+      DistanceRequest<S> distance_request;
+      DistanceResult<S> distance_result;
+      distance(&m1, tf, &m2, identity, distance_request, distance_result);
+
+      DistanceRequest<S> cached_distance_request;
+      cached_distance_request.query_cache = &distance_cache;
+      DistanceResult<S> cached_distance_result;
+      distance(&m1, tf, &m2, identity, cached_distance_request, cached_distance_result);
+
+      EXPECT_NEAR(distance_result.min_distance,
+                  cached_distance_result.min_distance,
+                  constants<S>::eps_34());
+      EXPECT_FALSE(distance_cache.empty());
+    }
+  }
+
+  // A cache used for another pair of geometries starts again from the roots
+  CollisionRequest<S> request(100000, true);
+  request.query_cache = &collision_cache;
+  CollisionResult<S> result;
+  collide(&m2, identity, &m1, transforms[0], request, result);
+  CollisionResult<S> uncached_result;
+  request.query_cache = nullptr;
+  collide(&m2, identity, &m1, transforms[0], request, uncached_result);
+  EXPECT_EQ(result.numContacts(), uncached_result.numContacts());
+}
+
+GTEST_TEST(FCL_FRONT_LIST, query_cache)
+{
+  test_query_cache<AABB<double>>();
+  test_query_cache<OBBRSS<double>>();
+  test_query_cache<RSS<double>>();
+}
+
 template<typename BV>
 bool collide_front_list_Test(const Transform3<typename BV::S>& tf1, const Transform3<typename BV::S>& tf2,
                              const std::vector<Vector3<typename BV::S>>& vertices1, const std::vector<Triangle>& triangles1,
@@ -52,8 +52,10 @@
 #include "fcl/geometry/shape/plane.h"
 
 #include "fcl/narrowphase/detail/gjk_solver_indep.h"
+#include "fcl/narrowphase/detail/gjk_solver_inline.h"
 #include "fcl/narrowphase/detail/gjk_solver_libccd.h"
 #include "fcl/narrowphase/collision.h"
+#include "fcl/narrowphase/distance.h"
 
 #include "test_fcl_utility.h"
 
@@ -174,6 +176,62 @@ GTEST_TEST(FCL_GEOMETRIC_SHAPES, gjkcache)
   test_gjkcache<double>();
 }
 
+template <typename S>
+void test_gjk_simplex_cache(GJKSolverType solver_type)
+{
+  Cylinder<S> s1(5, 10);
+  Cone<S> s2(5, 10);
+
+  GJKCache<S> cache;
+
+  CollisionRequest<S> collision_request;
+  collision_request.gjk_solver_type = solver_type;
+  DistanceRequest<S> distance_request;
+  distance_request.gjk_solver_type = solver_type;
+
+  TranslationMotion<S> motion(Transform3<S>(Translation3<S>(Vector3<S>(-20.0, -20.0, -20.0))), Transform3<S>(Translation3<S>(Vector3<S>(20.0, 20.0, 20.0))));
+
+  int N = 1000;
+  S dt = 1.0 / (N - 1);
+
+  for(int i = 0; i < N; ++i)
+  {
+    motion.integrate(dt * i);
+    Transform3<S> tf;
+    motion.getCurrentTransform(tf);
+
+    // The results are the same with and without the cache
+    CollisionResult<S> collision_result1;
+    CollisionResult<S> collision_result2;
+    collision_request.gjk_cache = nullptr;
+    collide(&s1, Transform3<S>::Identity(), &s2, tf, collision_request, collision_result1);
+    collision_request.gjk_cache = &cache;
+    collide(&s1, Transform3<S>::Identity(), &s2, tf, collision_request, collision_result2);
+    EXPECT_EQ(collision_result1.isCollision(), collision_result2.isCollision());
+
+    DistanceResult<S> distance_result1;
+    DistanceResult<S> distance_result2;
+    distance_request.gjk_cache = nullptr;
+    distance(&s1, Transform3<S>::Identity(), &s2, tf, distance_request, distance_result1);
+    distance_request.gjk_cache = &cache;
+    distance(&s1, Transform3<S>::Identity(), &s2, tf, distance_request, distance_result2);
+    EXPECT_NEAR(distance_result1.min_distance, distance_result2.min_distance, 1e-4);
+  }
+
+  // One entry for the pair, shared by the collision and distance queries
+  EXPECT_EQ(cache.size(), 1u);
+  EXPECT_FALSE(cache.get(&s1, &s2).empty());
+  cache.erase(&s2);
+  EXPECT_EQ(cache.size(), 0u);
+}
+
+GTEST_TEST(FCL_GEOMETRIC_SHAPES, gjkSimplexCache)
+{
+//  test_gjk_simplex_cache<float>(GST_INDEP);
+  test_gjk_simplex_cache<double>(GST_INDEP);
+  test_gjk_simplex_cache<double>(GST_INLINE);
+}
+
 template <typename Shape1, typename Shape2>
 void printComparisonError(const std::string& comparison_type,
                           const Shape1& s1, const Transform3<typename Shape1::S>& tf1,
@@ -5345,6 +5403,120 @@ GTEST_TEST(FCL_GEOMETRIC_SHAPES, reversibleShapeDistance_allshapes)
   test_reversibleShapeDistance_allshapes<double>();
 }
 
+template <typename S, typename Shape1, typename Shape2>
+void testInlineSolverMatchesIndep(
+    const Shape1& s1, const Shape2& s2,
+    const aligned_vector<Transform3<S>>& transforms)
+{
+  detail::GJKSolver_indep<S> indep;
+  detail::GJKSolver_inline<S> inl;
+  const S tol = 1e-9;
+
+  for (std::size_t i = 0; i + 1 < transforms.size(); ++i)
+  {
+    const Transform3<S>& tf1 = transforms[i];
+    const Transform3<S>& tf2 = transforms[i + 1];
+
+    std::vector<ContactPoint<S>> contacts_indep;
+    std::vector<ContactPoint<S>> contacts_inline;
+    EXPECT_EQ(indep.shapeIntersect(s1, tf1, s2, tf2, &contacts_indep),
+              inl.shapeIntersect(s1, tf1, s2, tf2, &contacts_inline));
+    GTEST_ASSERT_EQ(contacts_indep.size(), contacts_inline.size());
+    for (std::size_t j = 0; j < contacts_indep.size(); ++j)
+    {
+      EXPECT_TRUE(contacts_indep[j].pos.isApprox(contacts_inline[j].pos, tol));
+      EXPECT_TRUE(contacts_indep[j].normal.isApprox(contacts_inline[j].normal, tol));
+      EXPECT_NEAR(contacts_indep[j].penetration_depth,
+                  contacts_inline[j].penetration_depth, tol);
+    }
+
+    S dist_indep, dist_inline;
+    Vector3<S> p1_indep, p2_indep, p1_inline, p2_inline;
+    EXPECT_EQ(indep.shapeDistance(s1, tf1, s2, tf2, &dist_indep, &p1_indep, &p2_indep),
+              inl.shapeDistance(s1, tf1, s2, tf2, &dist_inline, &p1_inline, &p2_inline));
+    EXPECT_NEAR(dist_indep, dist_inline, tol);
+    if (dist_indep > 0)
+    {
+      EXPECT_TRUE(p1_indep.isApprox(p1_inline, tol));
+      EXPECT_TRUE(p2_indep.isApprox(p2_inline, tol));
+    }
+
+    const Vector3<S> P1 = tf2 * Vector3<S>(-5, -5, 0);
+    const Vector3<S> P2 = tf2 * Vector3<S>(5, -5, 0);
+    const Vector3<S> P3 = tf2 * Vector3<S>(0, 5, 0);
+    S depth_indep = 0, depth_inline = 0;
+    EXPECT_EQ(indep.shapeTriangleIntersect(s1, tf1, P1, P2, P3, tf2, nullptr, &depth_indep, nullptr),
+              inl.shapeTriangleIntersect(s1, tf1, P1, P2, P3, tf2, nullptr, &depth_inline, nullptr));
+    EXPECT_NEAR(depth_indep, depth_inline, tol);
+    EXPECT_EQ(indep.shapeTriangleDistance(s1, tf1, P1, P2, P3, &dist_indep),
+              inl.shapeTriangleDistance(s1, tf1, P1, P2, P3, &dist_inline));
+    EXPECT_NEAR(dist_indep, dist_inline, tol);
+  }
+}
+
+template <typename S>
+void test_inline_solver_matches_indep()
+{
+  Box<S> box(4, 6, 8);
+  Capsule<S> capsule(2, 6);
+  Cylinder<S> cylinder(3, 5);
+  Cone<S> cone(3, 6);
+  Ellipsoid<S> ellipsoid(2, 3, 4);
+
+  aligned_vector<Transform3<S>> transforms;
+  test::generateRandomTransforms(extents<S>().data(), transforms, 200);
+
+  testInlineSolverMatchesIndep<S>(box, capsule, transforms);
+  testInlineSolverMatchesIndep<S>(capsule, cylinder, transforms);
+  testInlineSolverMatchesIndep<S>(box, cylinder, transforms);
+  testInlineSolverMatchesIndep<S>(cylinder, cylinder, transforms);
+  testInlineSolverMatchesIndep<S>(cone, ellipsoid, transforms);
+  testInlineSolverMatchesIndep<S>(ellipsoid, box, transforms);
+
+  // Pairs solved in closed form give the same results too
+  Sphere<S> sphere(3);
+  testInlineSolverMatchesIndep<S>(sphere, box, transforms);
+  testInlineSolverMatchesIndep<S>(capsule, capsule, transforms);
+}
+
+GTEST_TEST(FCL_GEOMETRIC_SHAPES, inlineSolverMatchesIndep)
+{
+//  test_inline_solver_matches_indep<float>();
+  test_inline_solver_matches_indep<double>();
+}
+
+template <typename S>
+void test_collide_inline_solver()
+{
+  Box<S> box(4, 6, 8);
+  Cone<S> cone(3, 6);
+
+  aligned_vector<Transform3<S>> transforms;
+  test::generateRandomTransforms(extents<S>().data(), transforms, 200);
+
+  for (std::size_t i = 0; i + 1 < transforms.size(); ++i)
+  {
+    CollisionRequest<S> request;
+    request.enable_contact = true;
+    CollisionResult<S> result_indep;
+    CollisionResult<S> result_inline;
+
+    request.gjk_solver_type = GST_INDEP;
+    collide(&box, transforms[i], &cone, transforms[i + 1], request, result_indep);
+    request.gjk_solver_type = GST_INLINE;
+    collide(&box, transforms[i], &cone, transforms[i + 1], request, result_inline);
+
+    EXPECT_EQ(result_indep.isCollision(), result_inline.isCollision());
+    EXPECT_EQ(result_indep.numContacts(), result_inline.numContacts());
+  }
+}
+
+GTEST_TEST(FCL_GEOMETRIC_SHAPES, collideInlineSolver)
+{
+//  test_collide_inline_solver<float>();
+  test_collide_inline_solver<double>();
+}
+
 //==============================================================================
 int main(int argc, char* argv[])
 {
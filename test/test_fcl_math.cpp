@@ -39,6 +39,8 @@
 #include "fcl/broadphase/detail/morton.h"
 #include "fcl/config.h"
 #include "fcl/math/bv/AABB.h"
+#include "fcl/math/bv/OBB.h"
+#include "fcl/narrowphase/detail/traversal/collision/intersect.h"
 
 using namespace fcl;
 
@@ -129,6 +131,93 @@ GTEST_TEST(FCL_MATH, morton)
   test_morton<double>();
 }
 
+template <typename S>
+void test_obb_disjoint_batch()
+{
+  // The batched separating axis tests agree with obbDisjoint() on random
+  // boxes, including batches that do not fill all the lanes
+  std::srand(1);
+  auto random = [](S lo, S hi) { return lo + (hi - lo) * std::rand() / RAND_MAX; };
+
+  int num_disjoint = 0;
+  for(int iter = 0; iter < 200; ++iter)
+  {
+    const int n = 1 + iter % OBBPairBatch<S>::capacity;
+
+    OBBPairBatch<S> batch;
+    bool expected[OBBPairBatch<S>::capacity];
+    for(int i = 0; i < n; ++i)
+    {
+      const Matrix3<S> B = AngleAxis<S>(random(-3, 3), Vector3<S>(random(-1, 1), random(-1, 1), random(-1, 1)).normalized()).toRotationMatrix();
+      const Vector3<S> T(random(-3, 3), random(-3, 3), random(-3, 3));
+      const Vector3<S> a(random(0, 1.5), random(0, 1.5), random(0, 1.5));
+      const Vector3<S> b(random(0, 1.5), random(0, 1.5), random(0, 1.5));
+      batch.set(i, B, T, a, b);
+      expected[i] = obbDisjoint(B, T, a, b);
+      num_disjoint += expected[i];
+    }
+
+    bool disjoint[OBBPairBatch<S>::capacity];
+    obbDisjointBatch(batch, n, disjoint);
+    for(int i = 0; i < n; ++i)
+      EXPECT_EQ(disjoint[i], expected[i]);
+  }
+
+  // Both outcomes are exercised
+  EXPECT_GT(num_disjoint, 0);
+  EXPECT_LT(num_disjoint, 500);
+}
+
+GTEST_TEST(FCL_MATH, obb_disjoint_batch)
+{
+  test_obb_disjoint_batch<float>();
+  test_obb_disjoint_batch<double>();
+}
+
+template <typename S>
+void test_triangle_disjoint_batch()
+{
+  // The batched triangle tests agree with Intersect::intersect_Triangle() on
+  // random triangles, including batches that do not fill all the lanes
+  std::srand(1);
+  auto random = [](S lo, S hi) { return lo + (hi - lo) * std::rand() / RAND_MAX; };
+  auto random_point = [&random]() { return Vector3<S>(random(-1, 1), random(-1, 1), random(-1, 1)); };
+
+  int num_disjoint = 0;
+  int num_tests = 0;
+  for(int iter = 0; iter < 500; ++iter)
+  {
+    const int n = 1 + iter % detail::TrianglePairBatch<S>::capacity;
+
+    detail::TrianglePairBatch<S> batch;
+    bool expected[detail::TrianglePairBatch<S>::capacity];
+    for(int i = 0; i < n; ++i)
+    {
+      const Vector3<S> P[3] = {random_point(), random_point(), random_point()};
+      const Vector3<S> Q[3] = {random_point(), random_point(), random_point()};
+      batch.set(i, P[0], P[1], P[2], Q[0], Q[1], Q[2]);
+      expected[i] = !detail::Intersect<S>::intersect_Triangle(P[0], P[1], P[2], Q[0], Q[1], Q[2]);
+      num_disjoint += expected[i];
+      ++num_tests;
+    }
+
+    bool disjoint[detail::TrianglePairBatch<S>::capacity];
+    detail::triangleDisjointBatch(batch, n, disjoint);
+    for(int i = 0; i < n; ++i)
+      EXPECT_EQ(disjoint[i], expected[i]);
+  }
+
+  // Both outcomes are exercised
+  EXPECT_GT(num_disjoint, 0);
+  EXPECT_LT(num_disjoint, num_tests);
+}
+
+GTEST_TEST(FCL_MATH, triangle_disjoint_batch)
+{
+  test_triangle_disjoint_batch<float>();
+  test_triangle_disjoint_batch<double>();
+}
+
 //==============================================================================
 int main(int argc, char* argv[])
 {
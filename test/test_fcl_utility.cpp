@@ -152,6 +152,10 @@ std::string getNodeTypeName(NODE_TYPE node_type)
     return std::string("BV_KDOP18");
   else if (node_type == BV_KDOP24)
     return std::string("BV_KDOP24");
+  else if (node_type == BV_FloatAABB)
+    return std::string("BV_FloatAABB");
+  else if (node_type == BV_QuantizedAABB)
+    return std::string("BV_QuantizedAABB");
   else if (node_type == GEOM_BOX)
     return std::string("GEOM_BOX");
   else if (node_type == GEOM_SPHERE)